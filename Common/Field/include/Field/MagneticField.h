@@ -143,6 +143,16 @@ class MagneticField : public FairField
     bField[2] = bxyz[2];
   }
 
+  using FieldScratch = MagneticWrapperChebyshev::FieldScratch;
+
+  /// Reentrant method to calculate the field at point xyz, the temporary data of the measured map evaluation are
+  /// stored in the caller provided scratch. Several threads can query the same field with a scratch per thread
+  void Field(const Double_t* __restrict__ point, Double_t* __restrict__ bField, FieldScratch& scratch) const;
+
+  /// Reentrant method to calculate the field at np points, point[3 * ip + i] and bField[3 * ip + i] being the i-th
+  /// coordinate and field component of the ip-th point. The points in the measured map region are evaluated in batch
+  void Field(Int_t np, const Double_t* __restrict__ point, Double_t* __restrict__ bField, FieldScratch& scratch) const;
+
   /// 3d field query alias for Alias Method to calculate the field at point xyz
   void GetBxyz(const Double_t p[3], Double_t* b) override { MagneticField::Field(p, b); }
 
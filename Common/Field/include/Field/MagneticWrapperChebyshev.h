@@ -22,6 +22,8 @@
 #include "MathUtils/Chebyshev3D.h"     // for Chebyshev3D
 #include "MathUtils/Chebyshev3DCalc.h" // for _INC_CREATION_Chebyshev3D_
 #include "Rtypes.h"                    // for Double_t, Int_t, Float_t, etc
+#include <utility>                     // for std::pair
+#include <vector>                      // for std::vector
 
 namespace o2
 {
@@ -48,6 +50,9 @@ namespace field
 ///  cathod plane (+- 250 cm) use:
 ///  getTPCIntegral(double* xyz, double* bxyz);  for cartesian frame
 ///  or getTPCIntegralCylindrical(Double_t *rphiz, Double_t *b); for cylindrical frame
+///  The Field methods taking a FieldScratch are reentrant, a single instance can be used by several threads
+///  provided that each one has its own FieldScratch. The batched one evaluates the points falling in the same
+///  parameterization piece together.
 ///  The units are kiloGauss and cm.
 class MagneticWrapperChebyshev : public TNamed
 {
@@ -210,6 +215,24 @@ class MagneticWrapperChebyshev : public TNamed
   /// it gets it at closest valid point
   virtual void Field(const Double_t* xyz, Double_t* b) const;
 
+  /// Caller owned scratch space of the reentrant and batched field evaluations, one per thread
+  struct FieldScratch {
+    std::vector<Float_t> coefficients;           ///< temporary coefficients of the Chebyshev summations
+    std::vector<std::pair<Int_t, Int_t>> pieces; ///< parameterization piece and index of the points of a batch
+    std::vector<Double_t> rphiz;                 ///< cylindrical coordinates of the points of a batch
+    std::vector<Double_t> points;                ///< points of a batch in the measured map region (MagneticField)
+    std::vector<Double_t> fields;                ///< fields of the points in the measured map region (MagneticField)
+    std::vector<Int_t> indices;                  ///< indices of the points in the measured map region (MagneticField)
+  };
+
+  /// Reentrant version of Field, the temporary data are stored in the caller provided scratch
+  void Field(const Double_t* xyz, Double_t* b, FieldScratch& scratch) const;
+
+  /// Computes field in cartesian coordinates for np points, xyz[3 * ip + i] and b[3 * ip + i] being the i-th
+  /// coordinate and field component of the ip-th point. The points are grouped by parameterization piece and
+  /// evaluated in batches of Chebyshev3DCalc::sBatchSize points. Reentrant, like the single point version with scratch
+  void Field(Int_t np, const Double_t* xyz, Double_t* b, FieldScratch& scratch) const;
+
   /// Computes Bz for the point in cartesian coordinates. If point is outside of the parameterized region
   /// it gets it at closest valid point
   Double_t getBz(const Double_t* xyz) const;
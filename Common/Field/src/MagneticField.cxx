@@ -17,6 +17,7 @@
 #include <TFile.h>      // for TFile
 #include <TPRegexp.h>   // for TPRegexp
 #include <TSystem.h>    // for TSystem, gSystem
+#include <algorithm>    // for std::copy
 #include <fairlogger/Logger.h> // for FairLogger
 #include "FairParamList.h"
 #include "FairRun.h"
@@ -286,6 +287,69 @@ void MagneticField::Field(const Double_t* __restrict__ xyz, Double_t* __restrict
   }
 }
 
+void MagneticField::Field(const Double_t* __restrict__ xyz, Double_t* __restrict__ b, FieldScratch& scratch) const
+{
+  /*
+   * query field value at point, reentrant version
+   */
+
+  if (mFastField && mFastField->Field(xyz, b)) {
+    return;
+  }
+
+  if (mMeasuredMap && xyz[2] > mMeasuredMap->getMinZ() && xyz[2] < mMeasuredMap->getMaxZ()) {
+    mMeasuredMap->Field(xyz, b, scratch);
+    const Double_t factor = (xyz[2] > sSolenoidToDipoleZ || mDipoleOnOffFlag) ? mMultipicativeFactorSolenoid
+                                                                              : mMultipicativeFactorDipole;
+    for (int i = 3; i--;) {
+      b[i] *= factor;
+    }
+  } else {
+    MachineField(xyz, b);
+  }
+}
+
+void MagneticField::Field(Int_t np, const Double_t* __restrict__ xyz, Double_t* __restrict__ b,
+                          FieldScratch& scratch) const
+{
+  /*
+   * query field values at np points, the ones in the measured map region are evaluated in batch
+   */
+
+  auto& indices = scratch.indices;
+  indices.clear();
+  for (int ip = 0; ip < np; ip++) {
+    const Double_t* point = xyz + 3 * ip;
+    if (mFastField && mFastField->Field(point, b + 3 * ip)) {
+      continue;
+    }
+    if (mMeasuredMap && point[2] > mMeasuredMap->getMinZ() && point[2] < mMeasuredMap->getMaxZ()) {
+      indices.push_back(ip);
+    } else {
+      MachineField(point, b + 3 * ip);
+    }
+  }
+  if (indices.empty()) {
+    return;
+  }
+
+  const int nmap = indices.size();
+  scratch.points.resize(3 * nmap);
+  scratch.fields.resize(3 * nmap);
+  for (int i = 0; i < nmap; i++) {
+    std::copy(xyz + 3 * indices[i], xyz + 3 * indices[i] + 3, &scratch.points[3 * i]);
+  }
+  mMeasuredMap->Field(nmap, scratch.points.data(), scratch.fields.data(), scratch);
+  for (int i = 0; i < nmap; i++) {
+    const Double_t* point = xyz + 3 * indices[i];
+    const Double_t factor = (point[2] > sSolenoidToDipoleZ || mDipoleOnOffFlag) ? mMultipicativeFactorSolenoid
+                                                                                : mMultipicativeFactorDipole;
+    for (int j = 3; j--;) {
+      b[3 * indices[i] + j] = scratch.fields[3 * i + j] * factor;
+    }
+  }
+}
+
 Double_t MagneticField::getBz(const Double_t* xyz) const
 {
   /*
@@ -17,6 +17,7 @@
 #include <TArrayF.h>    // for TArrayF
 #include <TArrayI.h>    // for TArrayI
 #include <TSystem.h>    // for TSystem, gSystem
+#include <algorithm>    // for std::sort, std::min
 #include <cstdio>       // for printf, fprintf, fclose, fopen, FILE
 #include <cstring>      // for memcpy
 #include <fairlogger/Logger.h> // for FairLogger
@@ -467,6 +468,120 @@ Double_t MagneticWrapperChebyshev::getBz(const Double_t* xyz) const
   return par->Eval(xyz, 2);
 }
 
+void MagneticWrapperChebyshev::Field(const Double_t* xyz, Double_t* b, FieldScratch& scratch) const
+{
+  Double_t rphiz[3];
+
+#ifndef _BRING_TO_BOUNDARY_ // exact matching to fitted volume is requested
+  b[0] = b[1] = b[2] = 0;
+#endif
+
+  const Chebyshev3D* par = nullptr;
+  const Double_t* point = xyz;
+  if (xyz[2] > mMinZSolenoid) {
+    cartesianToCylindrical(xyz, rphiz);
+    int idsol = findSolenoidSegment(rphiz);
+    if (idsol < 0) {
+      return;
+    }
+    par = getParameterSolenoid(idsol);
+    point = rphiz;
+  } else {
+    int iddip = findDipoleSegment(xyz);
+    if (iddip < 0) {
+      return;
+    }
+    par = getParameterDipole(iddip);
+  }
+#ifndef _BRING_TO_BOUNDARY_
+  if (!par->isInside(point)) {
+    return;
+  }
+#endif
+  const size_t scratchSize = par->getScratchSize();
+  if (scratch.coefficients.size() < scratchSize) {
+    scratch.coefficients.resize(scratchSize);
+  }
+  par->Eval(point, b, scratch.coefficients.data());
+  if (point == rphiz) {
+    // convert field to cartesian system
+    cylindricalToCartesianCylB(rphiz, b, b);
+  }
+}
+
+void MagneticWrapperChebyshev::Field(Int_t np, const Double_t* xyz, Double_t* b, FieldScratch& scratch) const
+{
+  // find the parameterization piece of each point, the dipole pieces being numbered after the solenoid ones
+  auto& pieces = scratch.pieces;
+  pieces.clear();
+  scratch.rphiz.resize(3 * np);
+  for (int ip = 0; ip < np; ip++) {
+    const Double_t* point = xyz + 3 * ip;
+    b[3 * ip] = b[3 * ip + 1] = b[3 * ip + 2] = 0;
+    int id;
+    if (point[2] > mMinZSolenoid) {
+      Double_t* rphiz = &scratch.rphiz[3 * ip];
+      cartesianToCylindrical(point, rphiz);
+      id = findSolenoidSegment(rphiz);
+#ifndef _BRING_TO_BOUNDARY_
+      if (id >= 0 && !getParameterSolenoid(id)->isInside(rphiz)) {
+        continue;
+      }
+#endif
+    } else {
+      id = findDipoleSegment(point);
+#ifndef _BRING_TO_BOUNDARY_
+      if (id >= 0 && !getParameterDipole(id)->isInside(point)) {
+        continue;
+      }
+#endif
+      if (id >= 0) {
+        id += mNumberOfParameterizationSolenoid;
+      }
+    }
+    if (id >= 0) {
+      pieces.emplace_back(id, ip);
+    }
+  }
+
+  // evaluate together the points of the same piece
+  std::sort(pieces.begin(), pieces.end());
+  constexpr int batch = Chebyshev3DCalc::sBatchSize;
+  Double_t points[3 * batch], fields[3 * batch];
+  for (size_t first = 0; first < pieces.size();) {
+    const int id = pieces[first].first;
+    size_t last = first + 1;
+    while (last < pieces.size() && pieces[last].first == id) {
+      last++;
+    }
+    const bool solenoid = id < mNumberOfParameterizationSolenoid;
+    const Chebyshev3D* par = solenoid ? getParameterSolenoid(id) : getParameterDipole(id - mNumberOfParameterizationSolenoid);
+    const size_t scratchSize = par->getBatchScratchSize();
+    if (scratch.coefficients.size() < scratchSize) {
+      scratch.coefficients.resize(scratchSize);
+    }
+    for (size_t ib = first; ib < last; ib += batch) {
+      const int nb = std::min<size_t>(batch, last - ib);
+      for (int i = 0; i < nb; i++) {
+        const int ip = pieces[ib + i].second;
+        const Double_t* point = solenoid ? &scratch.rphiz[3 * ip] : xyz + 3 * ip;
+        std::copy(point, point + 3, points + 3 * i);
+      }
+      par->evaluateBatch(nb, points, fields, scratch.coefficients.data());
+      for (int i = 0; i < nb; i++) {
+        const int ip = pieces[ib + i].second;
+        if (solenoid) {
+          // convert field to cartesian system
+          cylindricalToCartesianCylB(&scratch.rphiz[3 * ip], fields + 3 * i, b + 3 * ip);
+        } else {
+          std::copy(fields + 3 * i, fields + 3 * i + 3, b + 3 * ip);
+        }
+      }
+    }
+    first = last;
+  }
+}
+
 void MagneticWrapperChebyshev::Print(Option_t*) const
 {
   printf("Alice magnetic field parameterized by Chebyshev polynomials\n");
@@ -0,0 +1,105 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  bench_MagneticField.cxx
+/// \brief benchmark of the measured field map evaluation, point by point and in batch
+///
+/// The argument is the number of points per query, along straight tracks from the vertex as queried by the propagation.
+/// The multi-threaded runs query the same field object, with a scratch per thread
+
+#include "benchmark/benchmark.h"
+#include "Field/MagneticField.h"
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <vector>
+
+using namespace o2::field;
+
+MagneticField* getField()
+{
+  static MagneticField field("Maps", "Maps", 1., 1., MagFieldParam::k5kG);
+  return &field;
+}
+
+/// create points along straight tracks of 100 steps from the vertex
+std::vector<double> createPoints(int nPoints)
+{
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  std::vector<double> xyz(3 * nPoints);
+  double dir[3] = {0.};
+  for (int ip = 0; ip < nPoints; ip++) {
+    if (ip % 100 == 0) {
+      double phi = 2. * M_PI * uniform(generator);
+      dir[0] = std::cos(phi);
+      dir[1] = std::sin(phi);
+      dir[2] = -1. + 2. * uniform(generator);
+    }
+    for (int i = 3; i--;) {
+      xyz[3 * ip + i] = 4. * (ip % 100 + 1) * dir[i];
+    }
+  }
+  return xyz;
+}
+
+static void BM_FieldSingle(benchmark::State& state)
+{
+  auto field = getField();
+  const int np = state.range(0);
+  const auto xyz = createPoints(np);
+  std::vector<double> b(3 * np);
+  static std::mutex mutex; // the single point query is not reentrant
+  for (auto _ : state) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int ip = 0; ip < np; ip++) {
+      field->Field(&xyz[3 * ip], &b[3 * ip]);
+    }
+    benchmark::DoNotOptimize(b.data());
+  }
+  state.SetItemsProcessed(state.iterations() * np);
+}
+
+static void BM_FieldReentrant(benchmark::State& state)
+{
+  auto field = getField();
+  const int np = state.range(0);
+  const auto xyz = createPoints(np);
+  std::vector<double> b(3 * np);
+  MagneticField::FieldScratch scratch;
+  for (auto _ : state) {
+    for (int ip = 0; ip < np; ip++) {
+      field->Field(&xyz[3 * ip], &b[3 * ip], scratch);
+    }
+    benchmark::DoNotOptimize(b.data());
+  }
+  state.SetItemsProcessed(state.iterations() * np);
+}
+
+static void BM_FieldBatch(benchmark::State& state)
+{
+  auto field = getField();
+  const int np = state.range(0);
+  const auto xyz = createPoints(np);
+  std::vector<double> b(3 * np);
+  MagneticField::FieldScratch scratch;
+  for (auto _ : state) {
+    field->Field(np, xyz.data(), b.data(), scratch);
+    benchmark::DoNotOptimize(b.data());
+  }
+  state.SetItemsProcessed(state.iterations() * np);
+}
+
+BENCHMARK(BM_FieldSingle)->RangeMultiplier(10)->Range(100, 10000)->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FieldReentrant)->RangeMultiplier(10)->Range(100, 10000)->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FieldBatch)->RangeMultiplier(10)->Range(100, 10000)->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -17,6 +17,8 @@
 #include "Field/MagneticField.h"
 #include "Field/MagFieldFast.h"
 #include <memory>
+#include <thread>
+#include <vector>
 #include <fairlogger/Logger.h> // for FairLogger
 #include <TStopwatch.h>
 #include <TRandom.h>
@@ -98,3 +100,74 @@ BOOST_AUTO_TEST_CASE(MagneticField_test)
     BOOST_CHECK(TMath::Abs(rms[i] / nomBz) < 1.e-3);
   }
 }
+
+BOOST_AUTO_TEST_CASE(MagneticField_batch_test)
+{
+  std::unique_ptr<MagneticField> fld = std::make_unique<MagneticField>("Maps", "Maps", 1., 1., o2::field::MagFieldParam::k5kG);
+
+  // points in the solenoid and dipole regions, and outside of the measured map
+  const int ntst = 10000;
+  float rnd[3];
+  std::vector<double> xyz(3 * ntst), bref(3 * ntst), bsingle(3 * ntst), bbatch(3 * ntst);
+  for (int it = ntst; it--;) {
+    gRandom->RndmArray(3, rnd);
+    xyz[3 * it] = (rnd[0] - 0.5) * 800.;
+    xyz[3 * it + 1] = (rnd[1] - 0.5) * 800.;
+    xyz[3 * it + 2] = -1800. + rnd[2] * 2500.;
+    fld->Field(&xyz[3 * it], &bref[3 * it]);
+  }
+
+  MagneticField::FieldScratch scratch;
+  for (int it = ntst; it--;) {
+    fld->Field(&xyz[3 * it], &bsingle[3 * it], scratch);
+  }
+  fld->Field(ntst, xyz.data(), bbatch.data(), scratch);
+  for (int i = 3 * ntst; i--;) {
+    BOOST_CHECK_EQUAL(bsingle[i], bref[i]);
+    BOOST_CHECK_SMALL(bbatch[i] - bref[i], 1.e-4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MagneticField_concurrent_test)
+{
+  std::unique_ptr<MagneticField> fld = std::make_unique<MagneticField>("Maps", "Maps", 1., 1., o2::field::MagFieldParam::k5kG);
+
+  // points along straight tracks from the vertex, as queried by the propagation
+  const int ntrk = 100, nstep = 100, ntst = ntrk * nstep;
+  float rnd[2];
+  std::vector<double> xyz(3 * ntst), bref(3 * ntst);
+  for (int itrk = ntrk; itrk--;) {
+    gRandom->RndmArray(2, rnd);
+    const double dir[3] = {TMath::Cos(rnd[0] * TMath::Pi() * 2), TMath::Sin(rnd[0] * TMath::Pi() * 2), -1. + 2. * rnd[1]};
+    for (int istep = nstep; istep--;) {
+      const int it = itrk * nstep + istep;
+      for (int i = 3; i--;) {
+        xyz[3 * it + i] = 4. * (istep + 1) * dir[i];
+      }
+      fld->Field(&xyz[3 * it], &bref[3 * it]);
+    }
+  }
+
+  // each thread evaluates all points with its own scratch, point by point and in batch
+  const int nthreads = 4;
+  std::vector<std::vector<double>> bsingle(nthreads, std::vector<double>(3 * ntst)), bbatch(nthreads, std::vector<double>(3 * ntst));
+  std::vector<std::thread> threads;
+  for (int ith = 0; ith < nthreads; ith++) {
+    threads.emplace_back([&, ith]() {
+      MagneticField::FieldScratch scratch;
+      for (int it = 0; it < ntst; it++) {
+        fld->Field(&xyz[3 * it], &bsingle[ith][3 * it], scratch);
+      }
+      fld->Field(ntst, xyz.data(), bbatch[ith].data(), scratch);
+    });
+  }
+  for (auto& th : threads) {
+    th.join();
+  }
+  for (int ith = 0; ith < nthreads; ith++) {
+    for (int i = 3 * ntst; i--;) {
+      BOOST_CHECK_EQUAL(bsingle[ith][i], bref[i]);
+      BOOST_CHECK_SMALL(bbatch[ith][i] - bref[i], 1.e-4);
+    }
+  }
+}
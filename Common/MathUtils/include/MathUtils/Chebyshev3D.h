@@ -18,6 +18,7 @@
 
 #include <TNamed.h>                    // for TNamed
 #include <TObjArray.h>                 // for TObjArray
+#include <algorithm>                   // for std::max
 #include <cstdio>                      // for FILE, stdout
 #include "MathUtils/Chebyshev3DCalc.h" // for Chebyshev3DCalc, etc
 #include "Rtypes.h"                    // for Float_t, Int_t, Double_t, Bool_t, etc
@@ -136,6 +137,20 @@ class Chebyshev3D : public TNamed
 
   Double_t Eval(const Double_t* par, int idim);
 
+  /// Reentrant evaluation: the temporary coefficients are stored in the caller provided scratch of getScratchSize()
+  /// elements, so that the same parameterization can be evaluated concurrently with a scratch per thread
+  void Eval(const Double_t* par, Double_t* res, Float_t* scratch) const;
+
+  /// Batched evaluation of np <= Chebyshev3DCalc::sBatchSize points, par[ip * 3 + i] being the i-th argument
+  /// and res[ip * DimOut + i] the i-th output of the ip-th point. scratch must provide getBatchScratchSize() elements
+  void evaluateBatch(Int_t np, const Double_t* par, Double_t* res, Float_t* scratch) const;
+
+  /// Number of Float_t elements of the scratch space needed by the reentrant evaluation
+  Int_t getScratchSize() const;
+
+  /// Number of Float_t elements of the scratch space needed by the batched evaluation
+  Int_t getBatchScratchSize() const;
+
   void evaluateDerivative(int dimd, const Float_t* par, Float_t* res);
 
   void evaluateDerivative2(int dimd1, int dimd2, const Float_t* par, Float_t* res);
@@ -311,6 +326,50 @@ inline void Chebyshev3D::Eval(const Double_t* par, Double_t* res)
   }
 }
 
+/// Evaluates Chebyshev parameterization for 3d->DimOut function with caller provided scratch
+inline void Chebyshev3D::Eval(const Double_t* par, Double_t* res, Float_t* scratch) const
+{
+  Float_t mapped[3];
+  for (int i = 3; i--;) {
+    mapped[i] = mapToInternal(par[i], i);
+  }
+  for (int i = mOutputArrayDimension; i--;) {
+    res[i] = getChebyshevCalc(i)->Eval(mapped, scratch);
+  }
+}
+
+/// Evaluates Chebyshev parameterization for 3d->DimOut function at np points with caller provided scratch
+inline void Chebyshev3D::evaluateBatch(Int_t np, const Double_t* par, Double_t* res, Float_t* scratch) const
+{
+  constexpr int batch = Chebyshev3DCalc::sBatchSize;
+  Float_t mapped[3 * batch], out[batch];
+  for (int ip = 0; ip < np; ip++) {
+    for (int i = 3; i--;) {
+      mapped[i * batch + ip] = mapToInternal(par[ip * 3 + i], i);
+    }
+  }
+  for (int i = mOutputArrayDimension; i--;) {
+    getChebyshevCalc(i)->evaluateBatch(np, mapped, out, scratch);
+    for (int ip = 0; ip < np; ip++) {
+      res[ip * mOutputArrayDimension + i] = out[ip];
+    }
+  }
+}
+
+inline Int_t Chebyshev3D::getScratchSize() const
+{
+  Int_t size = 0;
+  for (int i = mOutputArrayDimension; i--;) {
+    size = std::max(size, getChebyshevCalc(i)->getScratchSize());
+  }
+  return size;
+}
+
+inline Int_t Chebyshev3D::getBatchScratchSize() const
+{
+  return getScratchSize() * Chebyshev3DCalc::sBatchSize;
+}
+
 /// Evaluates Chebyshev parameterization for idim-th output dimension of 3d->DimOut function
 inline Double_t Chebyshev3D::Eval(const Double_t* par, int idim)
 {
@@ -169,7 +169,43 @@ class Chebyshev3DCalc : public TNamed
 
   Double_t Eval(const Double_t* par) const;
 
+  /// Number of points evaluated together by the batched evaluation
+  static constexpr Int_t sBatchSize = 16;
+
+  /// Number of Float_t elements of the scratch space needed by the reentrant evaluation
+  Int_t getScratchSize() const
+  {
+    return mNumberOfColumns + mNumberOfRows;
+  }
+
+  /// Number of Float_t elements of the scratch space needed by the batched evaluation
+  Int_t getBatchScratchSize() const
+  {
+    return (mNumberOfColumns + mNumberOfRows) * sBatchSize;
+  }
+
+  /// Reentrant evaluation, the temporary coefficients are stored in the getScratchSize() elements of the caller
+  /// provided scratch instead of the data members
+  Float_t Eval(const Float_t* par, Float_t* scratch) const;
+
+  /// Evaluates the parameterization for np <= sBatchSize points at once, par[idim * sBatchSize + ip] being the idim-th
+  /// argument of the ip-th point, ALREADY MAPPED to [-1:1] interval. The Chebyshev summations run over the points in
+  /// the innermost loop to be vectorized. scratch must provide getBatchScratchSize() elements
+  void evaluateBatch(Int_t np, const Float_t* par, Float_t* res, Float_t* scratch) const;
+
+  /// Evaluates 1D Chebyshev parameterization with the same coefficients for np <= sBatchSize arguments
+  static void chebyshevEvaluation1DBatch(Int_t np, const Float_t* x, const Float_t* array, int ncf, Float_t* res);
+
+  /// Evaluates 1D Chebyshev parameterization for np <= sBatchSize arguments, the i-th coefficient of the ip-th
+  /// argument being array[i * sBatchSize + ip]
+  static void chebyshevEvaluation1DBatchInterleaved(Int_t np, const Float_t* x, const Float_t* array, int ncf,
+                                                    Float_t* res);
+
  private:
+  /// Evaluates the parameterization with the temporary coefficients stored in tmp2D and tmp1D
+  template <typename T>
+  T evaluate(const T* par, Float_t* tmp2D, Float_t* tmp1D) const;
+
   Int_t mNumberOfCoefficients;    ///< total number of coeeficients
   Int_t mNumberOfRows;            ///< number of significant rows in the 3D coeffs matrix
   Int_t mNumberOfColumns;         ///< max number of significant cols in the 3D coeffs matrix
@@ -215,34 +251,115 @@ inline Float_t Chebyshev3DCalc::chebyshevEvaluation1D(Float_t x, const Float_t*
 
 /// Evaluates Chebyshev parameterization for 3D function.
 /// VERY IMPORTANT: par must contain the function arguments ALREADY MAPPED to [-1:1] interval
-inline Float_t Chebyshev3DCalc::Eval(const Float_t* par) const
+template <typename T>
+inline T Chebyshev3DCalc::evaluate(const T* par, Float_t* tmp2D, Float_t* tmp1D) const
 {
   for (int id0 = mNumberOfRows; id0--;) {
     int nCLoc = mNumberOfColumnsAtRow[id0]; // number of significant coefs on this row
     int col0 = mColumnAtRowBeginning[id0];  // beginning of local column in the 2D boundary matrix
     for (int id1 = nCLoc; id1--;) {
       int id = id1 + col0;
-      mTemporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id]);
+      tmp2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id]);
     }
-    mTemporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], mTemporaryCoefficients2D, nCLoc);
+    tmp1D[id0] = chebyshevEvaluation1D(par[1], tmp2D, nCLoc);
   }
-  return chebyshevEvaluation1D(par[0], mTemporaryCoefficients1D, mNumberOfRows);
+  return chebyshevEvaluation1D(par[0], tmp1D, mNumberOfRows);
+}
+
+/// Evaluates Chebyshev parameterization for 3D function.
+/// VERY IMPORTANT: par must contain the function arguments ALREADY MAPPED to [-1:1] interval
+inline Float_t Chebyshev3DCalc::Eval(const Float_t* par) const
+{
+  return evaluate(par, mTemporaryCoefficients2D, mTemporaryCoefficients1D);
 }
 
 /// Evaluates Chebyshev parameterization for 3D function.
 /// VERY IMPORTANT: par must contain the function arguments ALREADY MAPPED to [-1:1] interval
 inline Double_t Chebyshev3DCalc::Eval(const Double_t* par) const
 {
+  return evaluate(par, mTemporaryCoefficients2D, mTemporaryCoefficients1D);
+}
+
+/// Evaluates Chebyshev parameterization for 3D function.
+/// VERY IMPORTANT: par must contain the function arguments ALREADY MAPPED to [-1:1] interval
+inline Float_t Chebyshev3DCalc::Eval(const Float_t* par, Float_t* scratch) const
+{
+  return evaluate(par, scratch, scratch + mNumberOfColumns);
+}
+
+inline void Chebyshev3DCalc::chebyshevEvaluation1DBatch(Int_t np, const Float_t* x, const Float_t* array, int ncf,
+                                                        Float_t* res)
+{
+  if (ncf <= 0) {
+    for (int ip = 0; ip < np; ip++) {
+      res[ip] = 0;
+    }
+    return;
+  }
+  Float_t b0[sBatchSize], b1[sBatchSize], b2[sBatchSize];
+  const Float_t last = array[--ncf];
+  for (int ip = 0; ip < np; ip++) {
+    b0[ip] = last;
+    b1[ip] = b2[ip] = 0;
+  }
+  for (int i = ncf; i--;) {
+    const Float_t coef = array[i];
+    for (int ip = 0; ip < np; ip++) {
+      b2[ip] = b1[ip];
+      b1[ip] = b0[ip];
+      b0[ip] = coef + (x[ip] + x[ip]) * b1[ip] - b2[ip];
+    }
+  }
+  for (int ip = 0; ip < np; ip++) {
+    res[ip] = b0[ip] - x[ip] * b1[ip];
+  }
+}
+
+inline void Chebyshev3DCalc::chebyshevEvaluation1DBatchInterleaved(Int_t np, const Float_t* x, const Float_t* array,
+                                                                   int ncf, Float_t* res)
+{
+  if (ncf <= 0) {
+    for (int ip = 0; ip < np; ip++) {
+      res[ip] = 0;
+    }
+    return;
+  }
+  Float_t b0[sBatchSize], b1[sBatchSize], b2[sBatchSize];
+  const Float_t* last = array + (--ncf) * sBatchSize;
+  for (int ip = 0; ip < np; ip++) {
+    b0[ip] = last[ip];
+    b1[ip] = b2[ip] = 0;
+  }
+  for (int i = ncf; i--;) {
+    const Float_t* coef = array + i * sBatchSize;
+    for (int ip = 0; ip < np; ip++) {
+      b2[ip] = b1[ip];
+      b1[ip] = b0[ip];
+      b0[ip] = coef[ip] + (x[ip] + x[ip]) * b1[ip] - b2[ip];
+    }
+  }
+  for (int ip = 0; ip < np; ip++) {
+    res[ip] = b0[ip] - x[ip] * b1[ip];
+  }
+}
+
+/// Evaluates Chebyshev parameterization for 3D function at np <= sBatchSize points.
+/// VERY IMPORTANT: par must contain the function arguments ALREADY MAPPED to [-1:1] interval
+inline void Chebyshev3DCalc::evaluateBatch(Int_t np, const Float_t* par, Float_t* res, Float_t* scratch) const
+{
+  Float_t* tmp2D = scratch;
+  Float_t* tmp1D = scratch + mNumberOfColumns * sBatchSize;
   for (int id0 = mNumberOfRows; id0--;) {
     int nCLoc = mNumberOfColumnsAtRow[id0]; // number of significant coefs on this row
     int col0 = mColumnAtRowBeginning[id0];  // beginning of local column in the 2D boundary matrix
     for (int id1 = nCLoc; id1--;) {
       int id = id1 + col0;
-      mTemporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id]);
+      chebyshevEvaluation1DBatch(np, par + 2 * sBatchSize, mCoefficients + mCoefficientBound2D1[id],
+                                 mCoefficientBound2D0[id], tmp2D + id1 * sBatchSize);
     }
-    mTemporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], mTemporaryCoefficients2D, nCLoc);
+    chebyshevEvaluation1DBatchInterleaved(np, par + sBatchSize, tmp2D, nCLoc, tmp1D + id0 * sBatchSize);
   }
-  return chebyshevEvaluation1D(par[0], mTemporaryCoefficients1D, mNumberOfRows);
+  chebyshevEvaluation1DBatchInterleaved(np, par, tmp1D, mNumberOfRows, res);
 }
 } // namespace math_utils
 } // namespace o2
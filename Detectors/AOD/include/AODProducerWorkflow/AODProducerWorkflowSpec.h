@@ -53,13 +53,11 @@ class BunchCrossings
   BunchCrossings() = default;
 
   /// initialize this container (to be ready for lookup/search queries)
-  void init(std::map<uint64_t, int> const& bcs)
+  void init(std::vector<uint64_t> const& bcs)
   {
     clear();
     // init the structures
-    for (auto& key : bcs) {
-      mBCTimeVector.emplace_back(key.first);
-    }
+    mBCTimeVector = bcs;
     initTimeWindows();
   }
 
@@ -118,7 +116,6 @@ class BunchCrossings
   /// clear/reset this container
   void clear()
   {
-    mBCs.clear();
     mBCTimeVector.clear();
     mTimeWindows.clear();
   }
@@ -139,7 +136,6 @@ class BunchCrossings
   }
 
  private:
-  std::map<uint64_t, int> mBCs;
   std::vector<uint64_t> mBCTimeVector; // simple sorted vector of BC times
 
   /// initialize the internal acceleration structure
@@ -323,7 +319,8 @@ class AODProducerWorkflowDPL : public Task
   // Container used to mark MC particles to store/transfer to AOD.
   // Mapping of eventID, sourceID, trackID to some integer.
   // The first two indices are not sparse whereas the trackID index is sparse which explains
-  // the combination of vector and map
+  // the combination of vector and map. The maps are handed to aodmchelpers::updateParticles,
+  // shared with the MC-only producer, which distinguishes absent tracks from stored ones.
   std::vector<std::vector<std::unordered_map<int, int>>> mToStore;
   o2::steer::MCKinematicsReader* mMCKineReader = nullptr; //!
 
@@ -410,6 +407,14 @@ class AODProducerWorkflowDPL : public Task
     bool isTPConly = false; // not to be written out
   };
 
+  // helper struct for the barrel track quantities computed in parallel before filling the tables in fillTrackTablesPerCollision()
+  struct BarrelTrackInfo {
+    TrackExtraInfo extraInfo;
+    o2::track::TrackParCov trackPar; // track propagated to the PV
+    int8_t propStatus = -1;          // -1: propagation not attempted, 0: failed, 1: done
+  };
+  std::vector<BarrelTrackInfo> mBarrelTracksInfo; // for the tracks of the collision and source being filled
+
   struct TrackQA {
     GID trackID;
     float tpcTime0{};
@@ -501,11 +506,11 @@ class AODProducerWorkflowDPL : public Task
   void updateTimeDependentParams(ProcessingContext& pc);
 
   void addRefGlobalBCsForTOF(const o2::dataformats::VtxTrackRef& trackRef, const gsl::span<const GIndex>& GIndices,
-                             const o2::globaltracking::RecoContainer& data, std::map<uint64_t, int>& bcsMap);
+                             const o2::globaltracking::RecoContainer& data, std::vector<uint64_t>& globalBCs);
   void createCTPReadout(const o2::globaltracking::RecoContainer& recoData, std::vector<o2::ctp::CTPDigit>& ctpDigits, ProcessingContext& pc);
   void collectBCs(const o2::globaltracking::RecoContainer& data,
                   const std::vector<o2::InteractionTimeRecord>& mcRecords,
-                  std::map<uint64_t, int>& bcsMap);
+                  std::vector<uint64_t>& globalBCs);
 
   template <typename TracksCursorType, typename TracksCovCursorType>
   void addToTracksTable(TracksCursorType& tracksCursor, TracksCovCursorType& tracksCovCursor,
@@ -520,14 +525,16 @@ class AODProducerWorkflowDPL : public Task
   template <typename mftTracksCursorType, typename AmbigMFTTracksCursorType>
   void addToMFTTracksTable(mftTracksCursorType& mftTracksCursor, AmbigMFTTracksCursorType& ambigMFTTracksCursor,
                            GIndex trackID, const o2::globaltracking::RecoContainer& data, int collisionID,
-                           std::uint64_t collisionBC, const std::map<uint64_t, int>& bcsMap);
+                           std::uint64_t collisionBC, const std::vector<uint64_t>& globalBCs);
 
   template <typename fwdTracksCursorType, typename fwdTracksCovCursorType, typename AmbigFwdTracksCursorType, typename mftTracksCovCursorType>
   void addToFwdTracksTable(fwdTracksCursorType& fwdTracksCursor, fwdTracksCovCursorType& fwdTracksCovCursor, AmbigFwdTracksCursorType& ambigFwdTracksCursor, mftTracksCovCursorType& mftTracksCovCursor,
-                           GIndex trackID, const o2::globaltracking::RecoContainer& data, int collisionID, std::uint64_t collisionBC, const std::map<uint64_t, int>& bcsMap);
+                           GIndex trackID, const o2::globaltracking::RecoContainer& data, int collisionID, std::uint64_t collisionBC, const std::vector<uint64_t>& globalBCs);
 
-  TrackExtraInfo processBarrelTrack(int collisionID, std::uint64_t collisionBC, GIndex trackIndex, const o2::globaltracking::RecoContainer& data, const std::map<uint64_t, int>& bcsMap);
-  TrackQA processBarrelTrackQA(int collisionID, std::uint64_t collisionBC, GIndex trackIndex, const o2::globaltracking::RecoContainer& data, const std::map<uint64_t, int>& bcsMap);
+  TrackExtraInfo processBarrelTrack(int collisionID, std::uint64_t collisionBC, GIndex trackIndex, const o2::globaltracking::RecoContainer& data, const std::vector<uint64_t>& globalBCs);
+  void processBarrelTracks(int collisionID, std::uint64_t collisionBC, int src, int start, int end, const gsl::span<const GIndex>& GIndices,
+                           const o2::globaltracking::RecoContainer& data, const std::vector<uint64_t>& globalBCs);
+  TrackQA processBarrelTrackQA(int collisionID, std::uint64_t collisionBC, GIndex trackIndex, const o2::globaltracking::RecoContainer& data, const std::vector<uint64_t>& globalBCs);
 
   bool propagateTrackToPV(o2::track::TrackParametrizationWithError<float>& trackPar, const o2::globaltracking::RecoContainer& data, int colID);
   void extrapolateToCalorimeters(TrackExtraInfo& extraInfoHolder, const o2::track::TrackPar& track);
@@ -556,7 +563,7 @@ class AODProducerWorkflowDPL : public Task
                                    FwdTracksCovCursorType& fwdTracksCovCursor,
                                    AmbigFwdTracksCursorType& ambigFwdTracksCursor,
                                    FwdTrkClsCursorType& fwdTrkClsCursor,
-                                   const std::map<uint64_t, int>& bcsMap);
+                                   const std::vector<uint64_t>& globalBCs);
 
   template <typename FwdTrkClsCursorType>
   void addClustersToFwdTrkClsTable(const o2::globaltracking::RecoContainer& recoData, FwdTrkClsCursorType& fwdTrkClsCursor, GIndex trackID, int fwdTrackId);
@@ -649,9 +656,12 @@ class AODProducerWorkflowDPL : public Task
                               const o2::globaltracking::RecoContainer& data,
                               int vertexId = -1);
 
-  std::uint64_t fillBCSlice(int (&slice)[2], double tmin, double tmax, const std::map<uint64_t, int>& bcsMap) const;
+  std::uint64_t fillBCSlice(int (&slice)[2], double tmin, double tmax, const std::vector<uint64_t>& globalBCs) const;
+
+  // index of the BC in the sorted BCs of the TF, i.e. its BC ID, or -1 if absent
+  static int getBCIndex(const std::vector<uint64_t>& globalBCs, uint64_t bc);
 
-  std::vector<uint8_t> fillBCFlags(const o2::globaltracking::RecoContainer& data, std::map<uint64_t, int>& bcsMap) const;
+  std::vector<uint8_t> fillBCFlags(const o2::globaltracking::RecoContainer& data, const std::vector<uint64_t>& globalBCs) const;
 
   // helper for tpc clusters
   void countTPCClusters(const o2::globaltracking::RecoContainer& data);
@@ -665,7 +675,7 @@ class AODProducerWorkflowDPL : public Task
 
   template <typename TCaloCursor, typename TCaloTRGCursor, typename TMCCaloLabelCursor>
   void fillCaloTable(TCaloCursor& caloCellCursor, TCaloTRGCursor& caloTRGCursor,
-                     TMCCaloLabelCursor& mcCaloCellLabelCursor, const std::map<uint64_t, int>& bcsMap,
+                     TMCCaloLabelCursor& mcCaloCellLabelCursor, const std::vector<uint64_t>& globalBCs,
                      const o2::globaltracking::RecoContainer& data);
 
   std::set<uint64_t> filterEMCALIncomplete(const gsl::span<const o2::emcal::TriggerRecord> triggers);
@@ -215,7 +215,7 @@ void AODProducerWorkflowDPL::createCTPReadout(const o2::globaltracking::RecoCont
 
 void AODProducerWorkflowDPL::collectBCs(const o2::globaltracking::RecoContainer& data,
                                         const std::vector<o2::InteractionTimeRecord>& mcRecords,
-                                        std::map<uint64_t, int>& bcsMap)
+                                        std::vector<uint64_t>& globalBCs)
 {
   const auto& primVertices = data.getPrimaryVertices();
   const auto& fddRecPoints = data.getFDDRecPoints();
@@ -227,66 +227,65 @@ void AODProducerWorkflowDPL::collectBCs(const o2::globaltracking::RecoContainer&
   const auto& ctpDigits = data.getCTPDigits();
   const auto& zdcBCRecData = data.getZDCBCRecData();
 
-  bcsMap[mStartIR.toLong()] = 1; // store the start of TF
+  globalBCs.clear();
+  globalBCs.push_back(mStartIR.toLong()); // store the start of TF
 
   // collecting non-empty BCs and enumerating them
   for (auto& rec : mcRecords) {
     uint64_t globalBC = rec.toLong();
-    bcsMap[globalBC] = 1;
+    globalBCs.push_back(globalBC);
   }
 
   for (auto& fddRecPoint : fddRecPoints) {
     uint64_t globalBC = fddRecPoint.getInteractionRecord().toLong();
-    bcsMap[globalBC] = 1;
+    globalBCs.push_back(globalBC);
   }
 
   for (auto& ft0RecPoint : ft0RecPoints) {
     uint64_t globalBC = ft0RecPoint.getInteractionRecord().toLong();
-    bcsMap[globalBC] = 1;
+    globalBCs.push_back(globalBC);
   }
 
   for (auto& fv0RecPoint : fv0RecPoints) {
     uint64_t globalBC = fv0RecPoint.getInteractionRecord().toLong();
-    bcsMap[globalBC] = 1;
+    globalBCs.push_back(globalBC);
   }
 
   for (auto& zdcRecData : zdcBCRecData) {
     uint64_t globalBC = zdcRecData.ir.toLong();
-    bcsMap[globalBC] = 1;
+    globalBCs.push_back(globalBC);
   }
 
   for (auto& vertex : primVertices) {
     auto& timeStamp = vertex.getTimeStamp();
     double tsTimeStamp = timeStamp.getTimeStamp() * 1E3; // mus to ns
     uint64_t globalBC = relativeTime_to_GlobalBC(tsTimeStamp);
-    bcsMap[globalBC] = 1;
+    globalBCs.push_back(globalBC);
   }
 
   for (auto& emcaltrg : caloEMCCellsTRGR) {
     uint64_t globalBC = emcaltrg.getBCData().toLong();
-    bcsMap[globalBC] = 1;
+    globalBCs.push_back(globalBC);
   }
 
   for (auto& phostrg : caloPHOSCellsTRGR) {
     uint64_t globalBC = phostrg.getBCData().toLong();
-    bcsMap[globalBC] = 1;
+    globalBCs.push_back(globalBC);
   }
 
   for (auto& cpvtrg : cpvTRGR) {
     uint64_t globalBC = cpvtrg.getBCData().toLong();
-    bcsMap[globalBC] = 1;
+    globalBCs.push_back(globalBC);
   }
 
   for (auto& ctpDigit : ctpDigits) {
     uint64_t globalBC = ctpDigit.intRecord.toLong();
-    bcsMap[globalBC] = 1;
+    globalBCs.push_back(globalBC);
   }
 
-  int bcID = 0;
-  for (auto& item : bcsMap) {
-    item.second = bcID;
-    bcID++;
-  }
+  // the BC ID is the index of the BC in the sorted vector of unique BCs
+  std::sort(globalBCs.begin(), globalBCs.end());
+  globalBCs.erase(std::unique(globalBCs.begin(), globalBCs.end()), globalBCs.end());
 }
 
 template <typename TracksCursorType, typename TracksCovCursorType>
@@ -390,7 +389,7 @@ void AODProducerWorkflowDPL::addToTracksQATable(TracksQACursorType& tracksQACurs
 template <typename mftTracksCursorType, typename AmbigMFTTracksCursorType>
 void AODProducerWorkflowDPL::addToMFTTracksTable(mftTracksCursorType& mftTracksCursor, AmbigMFTTracksCursorType& ambigMFTTracksCursor,
                                                  GIndex trackID, const o2::globaltracking::RecoContainer& data, int collisionID,
-                                                 std::uint64_t collisionBC, const std::map<uint64_t, int>& bcsMap)
+                                                 std::uint64_t collisionBC, const std::vector<uint64_t>& globalBCs)
 {
   // mft tracks
   int bcSlice[2] = {-1, -1};
@@ -402,7 +401,7 @@ void AODProducerWorkflowDPL::addToMFTTracksTable(mftTracksCursorType& mftTracksC
   std::uint64_t bcOfTimeRef;
   if (needBCSlice) {
     double error = mTimeMarginTrackTime + trackTimeRes;
-    bcOfTimeRef = fillBCSlice(bcSlice, trackTime - error, trackTime + error, bcsMap);
+    bcOfTimeRef = fillBCSlice(bcSlice, trackTime - error, trackTime + error, globalBCs);
   } else {
     bcOfTimeRef = collisionBC - mStartIR.toLong(); // by default (unambiguous) track time is wrt collision BC
   }
@@ -448,7 +447,7 @@ void AODProducerWorkflowDPL::fillTrackTablesPerCollision(int collisionID,
                                                          FwdTracksCovCursorType& fwdTracksCovCursor,
                                                          AmbigFwdTracksCursorType& ambigFwdTracksCursor,
                                                          FwdTrkClsCursorType& fwdTrkClsCursor,
-                                                         const std::map<uint64_t, int>& bcsMap)
+                                                         const std::vector<uint64_t>& globalBCs)
 {
   for (int src = GIndex::NSources; src--;) {
     if (!GIndex::isTrackSource(src)) {
@@ -469,6 +468,10 @@ void AODProducerWorkflowDPL::fillTrackTablesPerCollision(int collisionID,
       tracksCursor.reserve(nToReserve + tracksCursor.lastIndex());
       tracksCovCursor.reserve(nToReserve + tracksCovCursor.lastIndex());
       tracksExtraCursor.reserve(nToReserve + tracksExtraCursor.lastIndex());
+      if (GIndex::includesSource(src, mInputSources)) {
+        // the quantities derived from the barrel tracks do not depend on the filling of the tables, compute them beforehand
+        processBarrelTracks(collisionID, collisionBC, src, start, end, GIndices, data, globalBCs);
+      }
     }
     for (int ti = start; ti < end; ti++) {
       const auto& trackIndex = GIndices[ti];
@@ -477,14 +480,14 @@ void AODProducerWorkflowDPL::fillTrackTablesPerCollision(int collisionID,
           if (trackIndex.isAmbiguous() && mGIDToTableMFTID.find(trackIndex) != mGIDToTableMFTID.end()) { // was it already stored ?
             continue;
           }
-          addToMFTTracksTable(mftTracksCursor, ambigMFTTracksCursor, trackIndex, data, collisionID, collisionBC, bcsMap);
+          addToMFTTracksTable(mftTracksCursor, ambigMFTTracksCursor, trackIndex, data, collisionID, collisionBC, globalBCs);
           mGIDToTableMFTID.emplace(trackIndex, mTableTrMFTID);
           mTableTrMFTID++;
         } else if (src == GIndex::Source::MCH || src == GIndex::Source::MFTMCH || src == GIndex::Source::MCHMID) { // FwdTracks tracks are treated separately since they are stored in a different table
           if (trackIndex.isAmbiguous() && mGIDToTableFwdID.find(trackIndex) != mGIDToTableFwdID.end()) {           // was it already stored ?
             continue;
           }
-          addToFwdTracksTable(fwdTracksCursor, fwdTracksCovCursor, ambigFwdTracksCursor, mftTracksCovCursor, trackIndex, data, collisionID, collisionBC, bcsMap);
+          addToFwdTracksTable(fwdTracksCursor, fwdTracksCovCursor, ambigFwdTracksCursor, mftTracksCovCursor, trackIndex, data, collisionID, collisionBC, globalBCs);
           mGIDToTableFwdID.emplace(trackIndex, mTableTrFwdID);
           addClustersToFwdTrkClsTable(data, fwdTrkClsCursor, trackIndex, mTableTrFwdID);
           mTableTrFwdID++;
@@ -497,10 +500,11 @@ void AODProducerWorkflowDPL::fillTrackTablesPerCollision(int collisionID,
           float weight = 0;
           static std::uniform_real_distribution<> distr(0., 1.);
           bool writeQAData = o2::math_utils::Tsallis::downsampleTsallisCharged(data.getTrackParam(trackIndex).getPt(), mTrackQCFraction, mSqrtS, weight, distr(mGenerator));
-          auto extraInfoHolder = processBarrelTrack(collisionID, collisionBC, trackIndex, data, bcsMap);
+          auto& barrelInfo = mBarrelTracksInfo[ti - start];
+          auto& extraInfoHolder = barrelInfo.extraInfo;
 
           if (writeQAData) {
-            auto trackQAInfoHolder = processBarrelTrackQA(collisionID, collisionBC, trackIndex, data, bcsMap);
+            auto trackQAInfoHolder = processBarrelTrackQA(collisionID, collisionBC, trackIndex, data, globalBCs);
             if (std::bitset<8>(trackQAInfoHolder.tpcClusterByteMask).count() >= mTrackQCNTrCut) {
               trackQAInfoHolder.trackID = mTableTrID;
               // LOGP(info, "orig time0 in bc: {} diffBCRef: {}, ttime: {} -> {}", trackQAInfoHolder.tpcTime0*8, extraInfoHolder.diffBCRef, extraInfoHolder.trackTime, (trackQAInfoHolder.tpcTime0 * 8 - extraInfoHolder.diffBCRef) * o2::constants::lhc::LHCBunchSpacingNS - extraInfoHolder.trackTime);
@@ -527,10 +531,13 @@ void AODProducerWorkflowDPL::fillTrackTablesPerCollision(int collisionID,
           if (mPropTracks && trOrig.getX() < mMinPropR &&
               mGIDUsedBySVtx.find(trackIndex) == mGIDUsedBySVtx.end() &&
               mGIDUsedByStr.find(trackIndex) == mGIDUsedByStr.end()) { // Do not propagate track assoc. to V0s and str. tracking
-            auto trackPar(trOrig);
-            isProp = propagateTrackToPV(trackPar, data, collisionID);
+            if (barrelInfo.propStatus < 0) { // not done beforehand for the tracks which could be thinned
+              barrelInfo.trackPar = trOrig;
+              barrelInfo.propStatus = propagateTrackToPV(barrelInfo.trackPar, data, collisionID);
+            }
+            isProp = barrelInfo.propStatus > 0;
             if (isProp) {
-              addToTracksTable(tracksCursor, tracksCovCursor, trackPar, collisionID, aod::track::Track);
+              addToTracksTable(tracksCursor, tracksCovCursor, barrelInfo.trackPar, collisionID, aod::track::Track);
             }
           }
           if (!isProp) {
@@ -609,7 +616,7 @@ template <typename FwdTracksCursorType, typename FwdTracksCovCursorType, typenam
 void AODProducerWorkflowDPL::addToFwdTracksTable(FwdTracksCursorType& fwdTracksCursor, FwdTracksCovCursorType& fwdTracksCovCursor,
                                                  AmbigFwdTracksCursorType& ambigFwdTracksCursor, mftTracksCovCursorType& mftTracksCovCursor, GIndex trackID,
                                                  const o2::globaltracking::RecoContainer& data, int collisionID, std::uint64_t collisionBC,
-                                                 const std::map<uint64_t, int>& bcsMap)
+                                                 const std::vector<uint64_t>& globalBCs)
 {
   const auto& mchTracks = data.getMCHTracks();
   const auto& midTracks = data.getMIDTracks();
@@ -816,7 +823,7 @@ void AODProducerWorkflowDPL::addToFwdTracksTable(FwdTracksCursorType& fwdTracksC
   bool needBCSlice = collisionID < 0;
   if (needBCSlice) { // need to store BC slice
     float err = mTimeMarginTrackTime + fwdInfo.trackTimeRes;
-    bcOfTimeRef = fillBCSlice(bcSlice, fwdInfo.trackTime - err, fwdInfo.trackTime + err, bcsMap);
+    bcOfTimeRef = fillBCSlice(bcSlice, fwdInfo.trackTime - err, fwdInfo.trackTime + err, globalBCs);
   } else {
     bcOfTimeRef = collisionBC - mStartIR.toLong(); // by default track time is wrt collision BC (unless no collision assigned)
   }
@@ -1575,7 +1582,7 @@ void AODProducerWorkflowDPL::addToCaloTable(TCaloHandler& caloHandler, TCaloCurs
 // fill calo related tables (cells and calotrigger table)
 template <typename TCaloCursor, typename TCaloTRGCursor, typename TMCCaloLabelCursor>
 void AODProducerWorkflowDPL::fillCaloTable(TCaloCursor& caloCellCursor, TCaloTRGCursor& caloTRGCursor,
-                                           TMCCaloLabelCursor& mcCaloCellLabelCursor, const std::map<uint64_t, int>& bcsMap,
+                                           TMCCaloLabelCursor& mcCaloCellLabelCursor, const std::vector<uint64_t>& globalBCs,
                                            const o2::globaltracking::RecoContainer& data)
 {
   // get calo information
@@ -1636,11 +1643,8 @@ void AODProducerWorkflowDPL::fillCaloTable(TCaloCursor& caloCellCursor, TCaloTRG
     uint64_t globalBC = std::get<0>(caloEvents[i]);
     int8_t caloType = std::get<1>(caloEvents[i]);
     int eventID = std::get<2>(caloEvents[i]);
-    auto item = bcsMap.find(globalBC);
-    int bcID = -1;
-    if (item != bcsMap.end()) {
-      bcID = item->second;
-    } else {
+    int bcID = getBCIndex(globalBCs, globalBC);
+    if (bcID < 0) {
       LOG(warn) << "Error: could not find a corresponding BC ID for a calo point; globalBC = " << globalBC << ", caloType = " << (int)caloType;
     }
     if (caloType == 0) { // phos
@@ -1885,14 +1889,14 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
   if (mUseMC) {
     mcReader = std::make_unique<o2::steer::MCKinematicsReader>("collisioncontext.root");
   }
-  mMCKineReader = mcReader.get(); // for use in different functions
-  std::map<uint64_t, int> bcsMap;
-  collectBCs(recoData, mUseMC ? mcReader->getDigitizationContext()->getEventRecords() : std::vector<o2::InteractionTimeRecord>{}, bcsMap);
+  mMCKineReader = mcReader.get();  // for use in different functions
+  std::vector<uint64_t> globalBCs; // sorted non-empty BCs of the TF, the BC ID being the index in this vector
+  collectBCs(recoData, mUseMC ? mcReader->getDigitizationContext()->getEventRecords() : std::vector<o2::InteractionTimeRecord>{}, globalBCs);
   if (!primVer2TRefs.empty()) { // if the vertexing was done, the last slot refers to orphan tracks
-    addRefGlobalBCsForTOF(primVer2TRefs.back(), primVerGIs, recoData, bcsMap);
+    addRefGlobalBCsForTOF(primVer2TRefs.back(), primVerGIs, recoData, globalBCs);
   }
   // initialize the bunch crossing container for further use below
-  mBCLookup.init(bcsMap);
+  mBCLookup.init(globalBCs);
 
   uint64_t tfNumber;
   const int runNumber = (mRunNumber == -1) ? int(tinfo.runNumber) : mRunNumber;
@@ -1919,11 +1923,8 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
       }
     }
     uint64_t bc = fv0RecPoint.getInteractionRecord().toLong();
-    auto item = bcsMap.find(bc);
-    int bcID = -1;
-    if (item != bcsMap.end()) {
-      bcID = item->second;
-    } else {
+    int bcID = getBCIndex(globalBCs, bc);
+    if (bcID < 0) {
       LOG(fatal) << "Error: could not find a corresponding BC ID for a FV0 rec. point; BC = " << bc;
     }
     fv0aCursor(bcID,
@@ -1943,11 +1944,8 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
   zdcCursor.reserve(zdcBCRecData.size());
   for (auto zdcRecData : zdcBCRecData) {
     uint64_t bc = zdcRecData.ir.toLong();
-    auto item = bcsMap.find(bc);
-    int bcID = -1;
-    if (item != bcsMap.end()) {
-      bcID = item->second;
-    } else {
+    int bcID = getBCIndex(globalBCs, bc);
+    if (bcID < 0) {
       LOG(fatal) << "Error: could not find a corresponding BC ID for a ZDC rec. point; BC = " << bc;
     }
     int fe, ne, ft, nt, fi, ni;
@@ -1999,11 +1997,8 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
     for (int iCol = 0; iCol < nMCCollisions; iCol++) {
       const auto time = mcRecords[iCol].getTimeOffsetWrtBC();
       auto globalBC = mcRecords[iCol].toLong();
-      auto item = bcsMap.find(globalBC);
-      int bcID = -1;
-      if (item != bcsMap.end()) {
-        bcID = item->second;
-      } else {
+      int bcID = getBCIndex(globalBCs, globalBC);
+      if (bcID < 0) {
         LOG(fatal) << "Error: could not find a corresponding BC ID "
                    << "for MC collision; BC = " << globalBC
                    << ", mc collision = " << iCol;
@@ -2052,11 +2047,8 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
     }
     uint64_t globalBC = fddRecPoint.getInteractionRecord().toLong();
     uint64_t bc = globalBC;
-    auto item = bcsMap.find(bc);
-    int bcID = -1;
-    if (item != bcsMap.end()) {
-      bcID = item->second;
-    } else {
+    int bcID = getBCIndex(globalBCs, bc);
+    if (bcID < 0) {
       LOG(fatal) << "Error: could not find a corresponding BC ID for a FDD rec. point; BC = " << bc;
     }
     const auto channelData = fddRecPoint.getBunchChannelData(fddChData);
@@ -2112,11 +2104,8 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
     }
     uint64_t globalBC = ft0RecPoint.getInteractionRecord().toLong();
     uint64_t bc = globalBC;
-    auto item = bcsMap.find(bc);
-    int bcID = -1;
-    if (item != bcsMap.end()) {
-      bcID = item->second;
-    } else {
+    int bcID = getBCIndex(globalBCs, bc);
+    if (bcID < 0) {
       LOG(fatal) << "Error: could not find a corresponding BC ID for a FT0 rec. point; BC = " << bc;
     }
     ft0Cursor(bcID,
@@ -2201,7 +2190,7 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
   // fixme: interaction time is undefined for unassigned tracks (?)
   fillTrackTablesPerCollision(-1, std::uint64_t(-1), trackRef, primVerGIs, recoData, tracksCursor, tracksCovCursor, tracksExtraCursor, tracksQACursor,
                               ambigTracksCursor, mftTracksCursor, mftTracksCovCursor, ambigMFTTracksCursor,
-                              fwdTracksCursor, fwdTracksCovCursor, ambigFwdTracksCursor, fwdTrkClsCursor, bcsMap);
+                              fwdTracksCursor, fwdTracksCovCursor, ambigFwdTracksCursor, fwdTrkClsCursor, globalBCs);
 
   // filling collisions and tracks into tables
   collisionID = 0;
@@ -2215,11 +2204,8 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
     LOG(debug) << "global BC " << globalBC << " local BC " << localBC << " relative interaction time " << interactionTime;
     // collision timestamp in ns wrt the beginning of collision BC
     const float relInteractionTime = static_cast<float>(localBC * o2::constants::lhc::LHCBunchSpacingNS - interactionTime);
-    auto item = bcsMap.find(globalBC);
-    int bcID = -1;
-    if (item != bcsMap.end()) {
-      bcID = item->second;
-    } else {
+    int bcID = getBCIndex(globalBCs, globalBC);
+    if (bcID < 0) {
       LOG(fatal) << "Error: could not find a corresponding BC ID for a collision; BC = " << globalBC << ", collisionID = " << collisionID;
     }
     collisionsCursor(bcID,
@@ -2243,7 +2229,7 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
     // passing interaction time in [ps]
     fillTrackTablesPerCollision(collisionID, globalBC, trackRef, primVerGIs, recoData, tracksCursor, tracksCovCursor, tracksExtraCursor, tracksQACursor, ambigTracksCursor,
                                 mftTracksCursor, mftTracksCovCursor, ambigMFTTracksCursor,
-                                fwdTracksCursor, fwdTracksCovCursor, ambigFwdTracksCursor, fwdTrkClsCursor, bcsMap);
+                                fwdTracksCursor, fwdTracksCovCursor, ambigFwdTracksCursor, fwdTrkClsCursor, globalBCs);
     collisionID++;
   }
 
@@ -2272,9 +2258,8 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
   }
 
   // filling BC table
-  bcCursor.reserve(bcsMap.size());
-  for (auto& item : bcsMap) {
-    uint64_t bc = item.first;
+  bcCursor.reserve(globalBCs.size());
+  for (auto bc : globalBCs) {
     std::pair<uint64_t, uint64_t> masks{0, 0};
     if (mInputSources[GID::CTP]) {
       auto bcClassPair = bcToClassMask.find(bc);
@@ -2291,7 +2276,7 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
   bcToClassMask.clear();
 
   // filling BC flags table:
-  auto bcFlags = fillBCFlags(recoData, bcsMap);
+  auto bcFlags = fillBCFlags(recoData, globalBCs);
   bcFlagsCursor.reserve(bcFlags.size());
   for (auto f : bcFlags) {
     bcFlagsCursor(f);
@@ -2303,11 +2288,8 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
     cpvClustersCursor.reserve(cpvTrigRecs.size());
     for (auto& cpvEvent : cpvTrigRecs) {
       uint64_t bc = cpvEvent.getBCData().toLong();
-      auto item = bcsMap.find(bc);
-      int bcID = -1;
-      if (item != bcsMap.end()) {
-        bcID = item->second;
-      } else {
+      int bcID = getBCIndex(globalBCs, bc);
+      if (bcID < 0) {
         LOG(fatal) << "Error: could not find a corresponding BC ID for a CPV Trigger Record; BC = " << bc;
       }
       for (int iClu = cpvEvent.getFirstEntry(); iClu < cpvEvent.getFirstEntry() + cpvEvent.getNumberOfObjects(); iClu++) {
@@ -2349,10 +2331,10 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
 
   // Fill calo tables and if MC also the MCCaloTable, therefore, has to be after fillMCParticlesTable call!
   if (mInputSources[GIndex::PHS] || mInputSources[GIndex::EMC]) {
-    fillCaloTable(caloCellsCursor, caloCellsTRGTableCursor, mcCaloLabelsCursor, bcsMap, recoData);
+    fillCaloTable(caloCellsCursor, caloCellsTRGTableCursor, mcCaloLabelsCursor, globalBCs, recoData);
   }
 
-  bcsMap.clear();
+  globalBCs.clear();
   clearMCKeepStore(mToStore);
   mGIDToTableID.clear();
   mTableTrID = 0;
@@ -2462,7 +2444,7 @@ void AODProducerWorkflowDPL::cacheTriggers(const o2::globaltracking::RecoContain
 }
 
 AODProducerWorkflowDPL::TrackExtraInfo AODProducerWorkflowDPL::processBarrelTrack(int collisionID, std::uint64_t collisionBC, GIndex trackIndex,
-                                                                                  const o2::globaltracking::RecoContainer& data, const std::map<uint64_t, int>& bcsMap)
+                                                                                  const o2::globaltracking::RecoContainer& data, const std::vector<uint64_t>& globalBCs)
 {
   TrackExtraInfo extraInfoHolder;
   if (collisionID < 0) {
@@ -2480,7 +2462,7 @@ AODProducerWorkflowDPL::TrackExtraInfo AODProducerWorkflowDPL::processBarrelTrac
     extraInfoHolder.trackTimeRes = terr;
     if (needBCSlice) { // need to define BC slice
       double error = this->mTimeMarginTrackTime + (gaussian ? extraInfoHolder.trackTimeRes * this->mNSigmaTimeTrack : extraInfoHolder.trackTimeRes);
-      bcOfTimeRef = fillBCSlice(extraInfoHolder.bcSlice, t - error, t + error, bcsMap);
+      bcOfTimeRef = fillBCSlice(extraInfoHolder.bcSlice, t - error, t + error, globalBCs);
     }
     extraInfoHolder.trackTime = float(t - bcOfTimeRef * o2::constants::lhc::LHCBunchSpacingNS);
     extraInfoHolder.diffBCRef = int(bcOfTimeRef);
@@ -2556,7 +2538,7 @@ AODProducerWorkflowDPL::TrackExtraInfo AODProducerWorkflowDPL::processBarrelTrac
         double t = (tpcOrig.getTime0() + 0.5 * (tpcOrig.getDeltaTFwd() - tpcOrig.getDeltaTBwd())) * mTPCBinNS; // central value
         double terr = 0.5 * (tpcOrig.getDeltaTFwd() + tpcOrig.getDeltaTBwd()) * mTPCBinNS;
         double err = mTimeMarginTrackTime + terr;
-        bcOfTimeRef = fillBCSlice(extraInfoHolder.bcSlice, t - err, t + err, bcsMap);
+        bcOfTimeRef = fillBCSlice(extraInfoHolder.bcSlice, t - err, t + err, globalBCs);
       }
       aod::track::extensions::TPCTimeErrEncoding p;
       p.setDeltaTFwd(tpcOrig.getDeltaTFwd());
@@ -2581,8 +2563,38 @@ AODProducerWorkflowDPL::TrackExtraInfo AODProducerWorkflowDPL::processBarrelTrac
   return extraInfoHolder;
 }
 
+void AODProducerWorkflowDPL::processBarrelTracks(int collisionID, std::uint64_t collisionBC, int src, int start, int end, const gsl::span<const GIndex>& GIndices,
+                                                 const o2::globaltracking::RecoContainer& data, const std::vector<uint64_t>& globalBCs)
+{
+  // process the barrel tracks of given source and collision and propagate them to the PV, if requested, filling mBarrelTracksInfo.
+  // The tracks which may be thinned are propagated only if they are stored, at the filling of the tables.
+  // The MFT and forward tracks, the calorimeters and the MC tables are still filled sequentially.
+  int ntr = end - start;
+  mBarrelTracksInfo.clear();
+  mBarrelTracksInfo.resize(ntr);
+  bool mayThin = mThinTracks && src == GIndex::Source::TPC;
+#ifdef WITH_OPENMP
+  int ngroup = std::min(50, std::max(1, ntr / mNThreads));
+#pragma omp parallel for schedule(dynamic, ngroup) num_threads(mNThreads)
+#endif
+  for (int itr = 0; itr < ntr; itr++) {
+    const auto& trackIndex = GIndices[start + itr];
+    if (trackIndex.isAmbiguous() && mGIDToTableID.find(trackIndex) != mGIDToTableID.end()) { // was it already stored ?
+      continue;
+    }
+    auto& barrelInfo = mBarrelTracksInfo[itr];
+    barrelInfo.extraInfo = processBarrelTrack(collisionID, collisionBC, trackIndex, data, globalBCs);
+    const auto& trOrig = data.getTrackParam(trackIndex);
+    bool usedBySVtxOrStr = mGIDUsedBySVtx.find(trackIndex) != mGIDUsedBySVtx.end() || mGIDUsedByStr.find(trackIndex) != mGIDUsedByStr.end();
+    if (mPropTracks && trOrig.getX() < mMinPropR && !usedBySVtxOrStr && !mayThin) {
+      barrelInfo.trackPar = trOrig;
+      barrelInfo.propStatus = propagateTrackToPV(barrelInfo.trackPar, data, collisionID);
+    }
+  }
+}
+
 AODProducerWorkflowDPL::TrackQA AODProducerWorkflowDPL::processBarrelTrackQA(int collisionID, std::uint64_t collisionBC, GIndex trackIndex,
-                                                                             const o2::globaltracking::RecoContainer& data, const std::map<uint64_t, int>& bcsMap)
+                                                                             const o2::globaltracking::RecoContainer& data, const std::vector<uint64_t>& globalBCs)
 {
   TrackQA trackQAHolder;
   auto contributorsGID = data.getTPCContributorGID(trackIndex);
@@ -2939,7 +2951,7 @@ void AODProducerWorkflowDPL::finaliseCCDB(ConcreteDataMatcher& matcher, void* ob
 }
 
 void AODProducerWorkflowDPL::addRefGlobalBCsForTOF(const o2::dataformats::VtxTrackRef& trackRef, const gsl::span<const GIndex>& GIndices,
-                                                   const o2::globaltracking::RecoContainer& data, std::map<uint64_t, int>& bcsMap)
+                                                   const o2::globaltracking::RecoContainer& data, std::vector<uint64_t>& globalBCs)
 {
   // Orphan tracks need to refer to some globalBC and for tracks with TOF this BC should be whithin an orbit
   // from the track abs time (to guarantee time precision). Therefore, we may need to insert some dummy globalBCs
@@ -2991,9 +3003,9 @@ void AODProducerWorkflowDPL::addRefGlobalBCsForTOF(const o2::dataformats::VtxTra
       auto tofSignal = (tofMatch.getSignal() - exp) * 1e-3; // time in ns wrt TF start
       auto bc = relativeTime_to_GlobalBC(tofSignal);
 
-      auto it = bcsMap.lower_bound(bc);
-      if (it == bcsMap.end() || it->first > bc + maxGapBC) {
-        bcsMap.emplace_hint(it, bc, 1);
+      auto it = std::lower_bound(globalBCs.begin(), globalBCs.end(), bc);
+      if (it == globalBCs.end() || *it > bc + maxGapBC) { // the dummy BCs are rare, insertion in the sorted vector is fine
+        globalBCs.insert(it, bc);
         LOG(debug) << "adding dummy BC " << bc;
       }
       if (bc > maxBC) {
@@ -3002,18 +3014,12 @@ void AODProducerWorkflowDPL::addRefGlobalBCsForTOF(const o2::dataformats::VtxTra
     }
   }
   // make sure there is a globalBC exceeding the max encountered bc
-  if ((--bcsMap.end())->first <= maxBC) {
-    bcsMap.emplace_hint(bcsMap.end(), maxBC + 1, 1);
-  }
-  // renumber BCs
-  int bcID = 0;
-  for (auto& item : bcsMap) {
-    item.second = bcID;
-    bcID++;
+  if (globalBCs.back() <= maxBC) {
+    globalBCs.push_back(maxBC + 1);
   }
 }
 
-std::uint64_t AODProducerWorkflowDPL::fillBCSlice(int (&slice)[2], double tmin, double tmax, const std::map<uint64_t, int>& bcsMap) const
+std::uint64_t AODProducerWorkflowDPL::fillBCSlice(int (&slice)[2], double tmin, double tmax, const std::vector<uint64_t>& globalBCs) const
 {
   // for ambiguous tracks (no or multiple vertices) we store the BC slice corresponding to track time window used for track-vertex matching,
   // see VertexTrackMatcher::extractTracks creator method, i.e. central time estimated +- uncertainty defined as:
@@ -3022,23 +3028,23 @@ std::uint64_t AODProducerWorkflowDPL::fillBCSlice(int (&slice)[2], double tmin,
   // The track time in the TrackExtraInfo is stored in ns wrt the collision BC for unambigous tracks and wrt bcSlice[0] for ambiguous ones,
   // with convention for errors: trackSigma in case (1) and half of the time interval for case (2) above.
 
-  // find indices of widest slice of global BCs in the map compatible with provided BC range. bcsMap is guaranteed to be non-empty.
+  // find indices of widest slice of global BCs in the vector compatible with provided BC range. globalBCs is guaranteed to be non-empty.
   // We also assume that tmax >= tmin.
 
   uint64_t bcMin = relativeTime_to_GlobalBC(tmin), bcMax = relativeTime_to_GlobalBC(tmax);
 
   /*
-    // brute force way of searching bcs via direct binary search in the map
-    auto lower = bcsMap.lower_bound(bcMin), upper = bcsMap.upper_bound(bcMax);
+    // brute force way of searching bcs via direct binary search in the vector
+    auto lower = std::lower_bound(globalBCs.begin(), globalBCs.end(), bcMin), upper = std::upper_bound(globalBCs.begin(), globalBCs.end(), bcMax);
 
-    if (lower == bcsMap.end()) {
+    if (lower == globalBCs.end()) {
       --lower;
     }
     if (upper != lower) {
       --upper;
     }
-    slice[0] = std::distance(bcsMap.begin(), lower);
-    slice[1] = std::distance(bcsMap.begin(), upper);
+    slice[0] = std::distance(globalBCs.begin(), lower);
+    slice[1] = std::distance(globalBCs.begin(), upper);
   */
 
   // faster way to search in bunch crossing via the accelerated bunch crossing lookup structure
@@ -3065,12 +3071,18 @@ std::uint64_t AODProducerWorkflowDPL::fillBCSlice(int (&slice)[2], double tmin,
   return bcOfTimeRef;
 }
 
-std::vector<uint8_t> AODProducerWorkflowDPL::fillBCFlags(const o2::globaltracking::RecoContainer& data, std::map<uint64_t, int>& bcsMap) const
+int AODProducerWorkflowDPL::getBCIndex(const std::vector<uint64_t>& globalBCs, uint64_t bc)
+{
+  auto it = std::lower_bound(globalBCs.begin(), globalBCs.end(), bc);
+  return (it != globalBCs.end() && *it == bc) ? int(std::distance(globalBCs.begin(), it)) : -1;
+}
+
+std::vector<uint8_t> AODProducerWorkflowDPL::fillBCFlags(const o2::globaltracking::RecoContainer& data, const std::vector<uint64_t>& globalBCs) const
 {
-  std::vector<uint8_t> flags(bcsMap.size());
+  std::vector<uint8_t> flags(globalBCs.size());
 
   // flag BCs belonging to UPC mode ITS ROFs
-  auto bcIt = bcsMap.begin();
+  auto bcIt = globalBCs.cbegin();
   auto itsrofs = data.getITSTracksROFRecords();
   auto lROF = o2::itsmft::DPLAlpideParam<o2::detectors::DetID::ITS>::Instance().roFrameLengthInBC;
   auto bROF = o2::itsmft::DPLAlpideParam<o2::detectors::DetID::ITS>::Instance().roFrameBiasInBC;
@@ -3080,15 +3092,15 @@ std::vector<uint8_t> AODProducerWorkflowDPL::fillBCFlags(const o2::globaltrackin
     }
     uint64_t globalBC0 = rof.getBCData().toLong() + bROF, globalBC1 = globalBC0 + lROF - 1;
     // BCs are sorted, iterate until the start of ROF
-    while (bcIt != bcsMap.end()) {
-      if (bcIt->first < globalBC0) {
+    while (bcIt != globalBCs.cend()) {
+      if (*bcIt < globalBC0) {
         ++bcIt;
         continue;
       }
-      if (bcIt->first > globalBC1) {
+      if (*bcIt > globalBC1) {
         break;
       }
-      flags[bcIt->second] |= o2::aod::bc::ITSUPCMode;
+      flags[std::distance(globalBCs.cbegin(), bcIt)] |= o2::aod::bc::ITSUPCMode;
       ++bcIt;
     }
   }
@@ -0,0 +1,96 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file MatBudgetCache.h
+/// \brief Declarations for the cache of material budget queries to the MatLayerCylSet
+
+#ifndef ALICEO2_MATBUDGETCACHE_H
+#define ALICEO2_MATBUDGETCACHE_H
+
+#include "DetectorsBase/MatCell.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace o2
+{
+namespace base
+{
+
+class MatLayerCylSet;
+
+/**********************************************************************
+ *                                                                    *
+ * Direct-mapped cache of the material budget between 2 points,       *
+ * keyed by the endpoints rounded to a quantum and by the range of    *
+ * layers crossed by the segment. Iterative fits query nearly the     *
+ * same segments again and again, a hit returns the cached mean       *
+ * density and X/X0 per unit length rescaled to the actual segment    *
+ * length. Not thread safe, use one cache per thread. The entries     *
+ * of all threads are dropped by invalidate(), e.g. on LUT change.    *
+ *                                                                    *
+ **********************************************************************/
+class MatBudgetCache
+{
+ public:
+  static constexpr int NBits = 12;            ///< log2 of the number of cache entries
+  static constexpr int NEntries = 1 << NBits; ///< number of cache entries
+
+  /// get the material budget between 2 points, querying the LUT in case of a cache miss.
+  /// The endpoints are rounded to the quantum (cm) to build the key, 0 requires them to match exactly.
+  /// Since the key contains the innermost and outermost crossed layers, a hit never adds or removes a layer:
+  /// the error is limited to the material variation within the phi and z cells of the crossed layers over
+  /// a shift of the endpoints by at most quantum/2 per coordinate
+  MatBudget getMatBudget(const MatLayerCylSet& lut, float x0, float y0, float z0, float x1, float y1, float z1, float quantum);
+
+  /// invalidate all the entries and reset the counters
+  void clear();
+
+  /// invalidate the entries of the caches of all threads, to be called when a LUT is replaced,
+  /// since a new LUT may reuse the address of a deleted one. The counters are preserved
+  static void invalidate() { sGeneration++; }
+
+  std::size_t getNQueries() const { return mNQueries; }
+  std::size_t getNHits() const { return mNHits; }
+  float getHitRate() const { return mNQueries ? float(mNHits) / mNQueries : 0.f; }
+  void print() const;
+
+  /// cache of the calling thread
+  static MatBudgetCache& instance();
+
+ private:
+  using Key = std::array<int32_t, 8>; ///< rounded endpoints, innermost and outermost crossed layers
+
+  struct Entry {
+    Key key{};                           ///< endpoints rounded to the quantum and crossed layers
+    float quantum = -1.f;                ///< quantum of the key, negative for invalid entry
+    const MatLayerCylSet* lut = nullptr; ///< LUT the budget was obtained from
+    MatBudget budget;                    ///< cached budget
+  };
+
+  void dropEntries();
+  static Key makeKey(const MatLayerCylSet& lut, float x0, float y0, float z0, float x1, float y1, float z1, float quantum);
+  static std::size_t hashKey(const Key& key);
+
+  std::vector<Entry> mEntries = std::vector<Entry>(NEntries); ///< cache entries
+  std::size_t mNQueries = 0;                                  ///< number of queries
+  std::size_t mNHits = 0;                                     ///< number of queries served from the cache
+  uint32_t mGeneration = 0;                                   ///< generation of the entries
+
+  static std::atomic<uint32_t> sGeneration; ///< incremented at every invalidation
+};
+
+} // namespace base
+} // namespace o2
+
+#endif
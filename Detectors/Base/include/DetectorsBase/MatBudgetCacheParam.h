@@ -0,0 +1,35 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file MatBudgetCacheParam.h
+/// \brief Configurable parameters of the cache of the MatLUT queries of the Propagator
+
+#ifndef ALICEO2_MATBUDGETCACHEPARAM_H
+#define ALICEO2_MATBUDGETCACHEPARAM_H
+
+#include "CommonUtils/ConfigurableParam.h"
+#include "CommonUtils/ConfigurableParamHelper.h"
+
+namespace o2
+{
+namespace base
+{
+
+struct MatBudgetCacheParam : public o2::conf::ConfigurableParamHelper<MatBudgetCacheParam> {
+  float quantum = -1.f; ///< rounding (cm) of the segment endpoints in the cache key, 0: exact match, < 0: cache disabled
+
+  O2ParamDef(MatBudgetCacheParam, "MatBudgetCache");
+};
+
+} // namespace base
+} // namespace o2
+
+#endif
@@ -27,6 +27,11 @@
 #ifndef GPUCA_GPUCODE
 #include <string>
 #endif
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+#include <vector>
+#include <gsl/span>
+#include "DetectorsBase/MatBudgetCache.h"
+#endif
 
 namespace o2
 {
@@ -119,6 +124,30 @@ class PropagatorImpl
                                    gpu::gpustd::array<value_type, 2>* dca = nullptr, track::TrackLTIntegral* tofInfo = nullptr,
                                    int signCorr = 0, value_type maxD = 999.f) const;
 
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+  // Batched propagation of a set of tracks to the common X. The tracks are propagated in lockstep and, at each step,
+  // the field is queried for all the tracks still being propagated at once (batched and reentrant measured map
+  // evaluation when the fast field is not available or not used). status[i] is set to 1 if the i-th track was propagated
+  // successfully, the results are the same as with the single track methods up to the rounding of the batched field
+  // map evaluation. Returns the number of propagated tracks.
+  // The optional tofInfo span must provide one TrackLTIntegral per track.
+  int PropagateToXBxByBz(gsl::span<TrackParCov_t> tracks, value_type x, std::vector<uint8_t>& status,
+                         value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP, MatCorrType matCorr = MatCorrType::USEMatCorrLUT,
+                         gsl::span<track::TrackLTIntegral> tofInfo = {}, int signCorr = 0) const;
+
+  int PropagateToXBxByBz(gsl::span<TrackPar_t> tracks, value_type x, std::vector<uint8_t>& status,
+                         value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP, MatCorrType matCorr = MatCorrType::USEMatCorrLUT,
+                         gsl::span<track::TrackLTIntegral> tofInfo = {}, int signCorr = 0) const;
+
+  int propagateToX(gsl::span<TrackParCov_t> tracks, value_type x, value_type bZ, std::vector<uint8_t>& status,
+                   value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP, MatCorrType matCorr = MatCorrType::USEMatCorrLUT,
+                   gsl::span<track::TrackLTIntegral> tofInfo = {}, int signCorr = 0) const;
+
+  int propagateToX(gsl::span<TrackPar_t> tracks, value_type x, value_type bZ, std::vector<uint8_t>& status,
+                   value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP, MatCorrType matCorr = MatCorrType::USEMatCorrLUT,
+                   gsl::span<track::TrackLTIntegral> tofInfo = {}, int signCorr = 0) const;
+#endif
+
   PropagatorImpl(PropagatorImpl const&) = delete;
   PropagatorImpl(PropagatorImpl&&) = delete;
   PropagatorImpl& operator=(PropagatorImpl const&) = delete;
@@ -129,12 +158,30 @@ class PropagatorImpl
   GPUd() value_type getNominalBz() const { return mNominalBz; }
   GPUd() void setTGeoFallBackAllowed(bool v) { mTGeoFallBackAllowed = v; }
   GPUd() bool isTGeoFallBackAllowed() const { return mTGeoFallBackAllowed; }
-  GPUd() void setMatLUT(const o2::base::MatLayerCylSet* lut) { mMatLUT = lut; }
+  GPUd() void setMatLUT(const o2::base::MatLayerCylSet* lut)
+  {
+    mMatLUT = lut;
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+    MatBudgetCache::invalidate(); // the new LUT may reuse the address of the old one
+#endif
+  }
   GPUd() const o2::base::MatLayerCylSet* getMatLUT() const { return mMatLUT; }
   GPUd() void setGPUField(const o2::gpu::GPUTPCGMPolynomialField* field) { mGPUField = field; }
   GPUd() const o2::gpu::GPUTPCGMPolynomialField* getGPUField() const { return mGPUField; }
   GPUd() void setNominalBz(value_type bz) { mNominalBz = bz; }
+  // cache the MatLUT queries in a per-thread MatBudgetCache, with the segment endpoints rounded to quantum (cm) in the
+  // cache key (0: exact match). A negative quantum disables the cache. Host only. The GRPGeomHelper sets it from
+  // the MatBudgetCache.quantum configurable param when it loads the MatLUT.
+  // The key also contains the range of crossed layers, so a hit never misses or adds a layer: the approximation is
+  // limited to the material variation within the layer cells over an endpoint shift of at most quantum/2 per coordinate
+  GPUd() void setMatBudgetCacheQuantum(float quantum) { mMatBudgetCacheQuantum = quantum; }
+  GPUd() float getMatBudgetCacheQuantum() const { return mMatBudgetCacheQuantum; }
   GPUd() bool hasMagFieldSet() const { return mField != nullptr; }
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+  // use the fast parametrization of the field when the field provides one (default), or always the measured map
+  void setUseFastField(bool v);
+#endif
+  GPUd() bool isFastFieldUsed() const { return mFieldFast != nullptr; }
 
   GPUd() value_type estimateLTFast(o2::track::TrackLTIntegral& lt, const o2::track::TrackParametrization<value_type>& trc) const;
   GPUd() float estimateLTIncrement(const o2::track::TrackParametrization<value_type>& trc, const o2::math_utils::Point3D<value_type>& postStart, const o2::math_utils::Point3D<value_type>& posEnd) const;
@@ -165,6 +212,11 @@ class PropagatorImpl
   static constexpr value_type Epsilon = 0.00001; // precision of propagation to X
   template <typename T>
   GPUd() void getFieldXYZImpl(const math_utils::Point3D<T> xyz, T* bxyz) const;
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+  template <typename track_T>
+  int propagateToXBatch(gsl::span<track_T> tracks, value_type xToGo, bool bzOnly, value_type bZ, std::vector<uint8_t>& status,
+                        value_type maxSnp, value_type maxStep, MatCorrType matCorr, gsl::span<track::TrackLTIntegral> tofInfo, int signCorr) const;
+#endif
 
   const o2::field::MagFieldFast* mFieldFast = nullptr; ///< External fast field map (barrel only for the moment)
   o2::field::MagneticField* mField = nullptr;          ///< External nominal field map
@@ -173,6 +225,7 @@ class PropagatorImpl
   bool mTGeoFallBackAllowed = true;                            ///< allow fall back to TGeo if requested MatLUT is not available
   const o2::base::MatLayerCylSet* mMatLUT = nullptr;           // externally set LUT
   const o2::gpu::GPUTPCGMPolynomialField* mGPUField = nullptr; // externally set GPU Field
+  float mMatBudgetCacheQuantum = -1.f;                         // quantum of the MatLUT query cache, disabled if negative
 
   ClassDefNV(PropagatorImpl, 0);
 };
@@ -25,6 +25,7 @@
 #include "Framework/TimingInfo.h"
 #include "Framework/CCDBParamSpec.h"
 #include "DetectorsBase/MatLayerCylSet.h"
+#include "DetectorsBase/MatBudgetCacheParam.h"
 #include "DetectorsBase/Propagator.h"
 #include "DetectorsCommonDataFormats/AlignParam.h"
 #include "DataFormatsParameters/GRPLHCIFData.h"
@@ -147,9 +148,15 @@ bool GRPGeomHelper::finaliseCCDB(ConcreteDataMatcher& matcher, void* obj)
   if (mRequest->askMatLUT && matcher == ConcreteDataMatcher("GLO", "MATLUT", 0)) {
     LOG(info) << "material LUT updated";
     mMatLUT = o2::base::MatLayerCylSet::rectifyPtrFromFile((o2::base::MatLayerCylSet*)obj);
+    const auto cacheQuantum = o2::base::MatBudgetCacheParam::Instance().quantum;
     o2::base::Propagator::Instance(false)->setMatLUT(mMatLUT);
+    o2::base::Propagator::Instance(false)->setMatBudgetCacheQuantum(cacheQuantum);
     if (mRequest->needPropagatorD) {
       o2::base::PropagatorD::Instance(false)->setMatLUT(mMatLUT);
+      o2::base::PropagatorD::Instance(false)->setMatBudgetCacheQuantum(cacheQuantum);
+    }
+    if (cacheQuantum >= 0.f) {
+      LOGP(info, "MatLUT queries are cached with the quantum {} cm", cacheQuantum);
     }
     return true;
   }
@@ -0,0 +1,119 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file MatBudgetCache.cxx
+/// \brief Implementation of the cache of material budget queries to the MatLayerCylSet
+
+#include "DetectorsBase/MatBudgetCache.h"
+#include "DetectorsBase/MatLayerCylSet.h"
+#include "DetectorsBase/Ray.h"
+#include <fairlogger/Logger.h>
+#include <cmath>
+#include <cstring>
+
+using namespace o2::base;
+
+std::atomic<uint32_t> MatBudgetCache::sGeneration{0};
+
+//________________________________________________________________________________
+MatBudget MatBudgetCache::getMatBudget(const MatLayerCylSet& lut, float x0, float y0, float z0, float x1, float y1, float z1, float quantum)
+{
+  mNQueries++;
+  if (const auto generation = sGeneration.load(std::memory_order_relaxed); generation != mGeneration) {
+    dropEntries();
+    mGeneration = generation;
+  }
+  auto key = makeKey(lut, x0, y0, z0, x1, y1, z1, quantum);
+  auto& entry = mEntries[hashKey(key)];
+  if (entry.quantum == quantum && entry.lut == &lut && entry.key == key) {
+    mNHits++;
+    if (quantum == 0.f) {
+      return entry.budget;
+    }
+    // rescale the X/X0 integral to the actual length of the segment
+    MatBudget rval(entry.budget);
+    float dx = x1 - x0, dy = y1 - y0, dz = z1 - z0;
+    rval.length = std::sqrt(dx * dx + dy * dy + dz * dz);
+    if (entry.budget.length > 0.f) {
+      rval.meanX2X0 *= rval.length / entry.budget.length;
+    }
+    return rval;
+  }
+  entry.key = key;
+  entry.quantum = quantum;
+  entry.lut = &lut;
+  entry.budget = lut.getMatBudget(x0, y0, z0, x1, y1, z1);
+  return entry.budget;
+}
+
+//________________________________________________________________________________
+void MatBudgetCache::clear()
+{
+  dropEntries();
+  mNQueries = mNHits = 0;
+}
+
+//________________________________________________________________________________
+void MatBudgetCache::dropEntries()
+{
+  for (auto& entry : mEntries) {
+    entry.quantum = -1.f;
+    entry.lut = nullptr;
+  }
+}
+
+//________________________________________________________________________________
+void MatBudgetCache::print() const
+{
+  LOGP(info, "MatBudgetCache: {} queries, {} hits, hit rate {:.3f}", mNQueries, mNHits, getHitRate());
+}
+
+//________________________________________________________________________________
+MatBudgetCache& MatBudgetCache::instance()
+{
+  static thread_local MatBudgetCache cache;
+  return cache;
+}
+
+//________________________________________________________________________________
+MatBudgetCache::Key MatBudgetCache::makeKey(const MatLayerCylSet& lut, float x0, float y0, float z0, float x1, float y1, float z1, float quantum)
+{
+  const float coordinates[6] = {x0, y0, z0, x1, y1, z1};
+  Key key;
+  if (quantum > 0.f) {
+    const float invQuantum = 1.f / quantum;
+    for (int i = 0; i < 6; i++) {
+      key[i] = int32_t(std::lround(coordinates[i] * invQuantum));
+    }
+    // segments rounded to the same endpoints but crossing a different set of layers must not share the entry
+    short lmin = -1, lmax = -1;
+    Ray ray(x0, y0, z0, x1, y1, z1);
+    if (ray.isTooShort() || !lut.getLayersRange(ray, lmin, lmax)) {
+      lmin = lmax = -1;
+    }
+    key[6] = lmin;
+    key[7] = lmax;
+  } else {
+    std::memcpy(key.data(), coordinates, sizeof(coordinates));
+    key[6] = key[7] = 0; // exact endpoints define the crossed layers
+  }
+  return key;
+}
+
+//________________________________________________________________________________
+std::size_t MatBudgetCache::hashKey(const Key& key)
+{
+  uint64_t hash = 0;
+  for (auto k : key) {
+    hash = (hash ^ uint32_t(k)) * 0x9E3779B97F4A7C15ull;
+  }
+  return (hash >> (64 - NBits)) & (NEntries - 1);
+}
@@ -16,6 +16,10 @@
 #include "GPUTPCGMPolynomialField.h"
 #include "MathUtils/Utils.h"
 #include "ReconstructionDataFormats/Vertex.h"
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+#include <algorithm>
+#include <type_traits>
+#endif
 
 using namespace o2::base;
 using namespace o2::gpu;
@@ -29,6 +33,7 @@ using namespace o2::gpu;
 #include "DataFormatsParameters/GRPObject.h"
 #include "DataFormatsParameters/GRPMagField.h"
 #include "DetectorsBase/GeometryManager.h"
+#include "DetectorsBase/MatBudgetCache.h"
 #include <FairRunAna.h> // eventually will get rid of it
 #include <TGeoGlobalMagField.h>
 
@@ -68,6 +73,22 @@ void PropagatorImpl<value_T>::updateField()
   }
 }
 
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+//____________________________________________________________
+template <typename value_T>
+void PropagatorImpl<value_T>::setUseFastField(bool v)
+{
+  if (!mField) {
+    LOG(error) << "Magnetic field is not initialized";
+    return;
+  }
+  if (v && !mField->getFastField() && mField->fastFieldExists()) {
+    mField->AllowFastField(true);
+  }
+  mFieldFast = v ? mField->getFastField() : nullptr;
+}
+#endif
+
 //____________________________________________________________
 template <typename value_T>
 int PropagatorImpl<value_T>::initFieldFromGRP(const std::string grpFileName, bool verbose)
@@ -721,6 +742,166 @@ GPUd() value_T PropagatorImpl<value_T>::estimateLTFast(o2::track::TrackLTIntegra
   return dcaT;
 }
 
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+//_______________________________________________________________________
+template <typename value_T>
+template <typename track_T>
+int PropagatorImpl<value_T>::propagateToXBatch(gsl::span<track_T> tracks, value_type xToGo, bool bzOnly, value_type bZ, std::vector<uint8_t>& status,
+                                               value_type maxSnp, value_type maxStep, MatCorrType matCorr, gsl::span<track::TrackLTIntegral> tofInfo, int signCorr) const
+{
+  //----------------------------------------------------------------
+  //
+  // Propagates the tracks to the plane X=xk (cm) in lockstep: each iteration
+  // makes one step for all the tracks still being propagated, with a single
+  // field query for all of them. Each track goes through the same steps and
+  // corrections as with the single track methods.
+  //
+  // bzOnly   - use the bZ value instead of the 3 components of the field
+  //----------------------------------------------------------------
+  const int ntracks = tracks.size();
+  status.assign(ntracks, 1);
+  std::vector<int> active;
+  active.reserve(ntracks);
+  for (int it = 0; it < ntracks; it++) {
+    if (math_utils::detail::abs<value_type>(xToGo - tracks[it].getX()) > Epsilon) {
+      active.push_back(it);
+    } else {
+      tracks[it].setX(xToGo);
+    }
+  }
+
+  // the field is kept per track since, as in the single track methods, the previous value is used if the fast field
+  // does not cover the current position
+  std::vector<math_utils::Point3D<value_type>> xyz0(ntracks);
+  std::vector<value_type> bxyz(bzOnly ? 0 : 3 * ntracks);
+  // without fast field the measured map is evaluated in batch, with a local scratch since the propagator is shared
+  const bool batchField = !bzOnly && !mGPUField && !mFieldFast && mField;
+  o2::field::MagneticField::FieldScratch fieldScratch;
+  std::vector<double> points, fields;
+  while (!active.empty()) {
+    const int nactive = active.size();
+    for (int i = 0; i < nactive; i++) {
+      xyz0[i] = tracks[active[i]].getXYZGlo();
+    }
+    if (batchField) {
+      points.resize(3 * nactive);
+      fields.resize(3 * nactive);
+      for (int i = 0; i < nactive; i++) {
+        points[3 * i] = xyz0[i].X();
+        points[3 * i + 1] = xyz0[i].Y();
+        points[3 * i + 2] = xyz0[i].Z();
+      }
+      mField->Field(nactive, points.data(), fields.data(), fieldScratch);
+      for (int i = 0; i < nactive; i++) {
+        std::copy(&fields[3 * i], &fields[3 * i] + 3, &bxyz[3 * active[i]]);
+      }
+    } else if (!bzOnly) {
+      for (int i = 0; i < nactive; i++) {
+        getFieldXYZ(xyz0[i], &bxyz[3 * active[i]]);
+      }
+    }
+
+    int nkeep = 0;
+    for (int i = 0; i < nactive; i++) {
+      const int it = active[i];
+      auto& track = tracks[it];
+      auto* ltInfo = tofInfo.empty() ? nullptr : &tofInfo[it];
+      auto dx = xToGo - track.getX();
+      int dir = dx > 0.f ? 1 : -1;
+      int sign = signCorr ? signCorr : -dir; // sign of eloss correction is not imposed
+      auto step = math_utils::detail::min<value_type>(math_utils::detail::abs<value_type>(dx), maxStep);
+      if (dir < 0) {
+        step = -step;
+      }
+      auto x = track.getX() + step;
+
+      auto correct = [&track, &xyz = xyz0[i], ltInfo, matCorr, sign, this]() {
+        bool res = true;
+        if (matCorr != MatCorrType::USEMatCorrNONE) {
+          auto xyz1 = track.getXYZGlo();
+          auto mb = this->getMatBudget(matCorr, xyz, xyz1);
+          if constexpr (std::is_same_v<track_T, TrackParCov_t>) {
+            res = track.correctForMaterial(mb.meanX2X0, mb.getXRho(sign));
+          } else {
+            res = track.correctForELoss(mb.getXRho(sign));
+          }
+          if (ltInfo) {
+            ltInfo->addStep(mb.length, track.getP2Inv()); // fill L,ToF info using already calculated step length
+            ltInfo->addX2X0(mb.meanX2X0);
+            ltInfo->addXRho(mb.getXRho(sign));
+          }
+        } else if (ltInfo) { // if tofInfo filling was requested w/o material correction, we need to calculate the step lenght
+          auto xyz1 = track.getXYZGlo();
+          math_utils::Vector3D<value_type> stepV(xyz1.X() - xyz.X(), xyz1.Y() - xyz.Y(), xyz1.Z() - xyz.Z());
+          ltInfo->addStep(stepV.R(), track.getP2Inv());
+        }
+        return res;
+      };
+
+      bool propagated;
+      if (bzOnly) {
+        propagated = track.propagateTo(x, bZ);
+      } else {
+        const gpu::gpustd::array<value_type, 3> b{bxyz[3 * it], bxyz[3 * it + 1], bxyz[3 * it + 2]};
+        propagated = track.propagateTo(x, b);
+      }
+      if (!propagated) {
+        status[it] = 0;
+        continue;
+      }
+      if (maxSnp > 0 && math_utils::detail::abs<value_type>(track.getSnp()) >= maxSnp) {
+        correct();
+        status[it] = 0;
+        continue;
+      }
+      if (!correct()) {
+        status[it] = 0;
+        continue;
+      }
+      if (math_utils::detail::abs<value_type>(xToGo - track.getX()) > Epsilon) {
+        active[nkeep++] = it;
+      } else {
+        track.setX(xToGo);
+      }
+    }
+    active.resize(nkeep);
+  }
+  return std::count(status.begin(), status.end(), 1);
+}
+
+//_______________________________________________________________________
+template <typename value_T>
+int PropagatorImpl<value_T>::PropagateToXBxByBz(gsl::span<TrackParCov_t> tracks, value_type x, std::vector<uint8_t>& status, value_type maxSnp, value_type maxStep,
+                                                MatCorrType matCorr, gsl::span<track::TrackLTIntegral> tofInfo, int signCorr) const
+{
+  return propagateToXBatch(tracks, x, false, 0, status, maxSnp, maxStep, matCorr, tofInfo, signCorr);
+}
+
+//_______________________________________________________________________
+template <typename value_T>
+int PropagatorImpl<value_T>::PropagateToXBxByBz(gsl::span<TrackPar_t> tracks, value_type x, std::vector<uint8_t>& status, value_type maxSnp, value_type maxStep,
+                                                MatCorrType matCorr, gsl::span<track::TrackLTIntegral> tofInfo, int signCorr) const
+{
+  return propagateToXBatch(tracks, x, false, 0, status, maxSnp, maxStep, matCorr, tofInfo, signCorr);
+}
+
+//_______________________________________________________________________
+template <typename value_T>
+int PropagatorImpl<value_T>::propagateToX(gsl::span<TrackParCov_t> tracks, value_type x, value_type bZ, std::vector<uint8_t>& status, value_type maxSnp, value_type maxStep,
+                                          MatCorrType matCorr, gsl::span<track::TrackLTIntegral> tofInfo, int signCorr) const
+{
+  return propagateToXBatch(tracks, x, true, bZ, status, maxSnp, maxStep, matCorr, tofInfo, signCorr);
+}
+
+//_______________________________________________________________________
+template <typename value_T>
+int PropagatorImpl<value_T>::propagateToX(gsl::span<TrackPar_t> tracks, value_type x, value_type bZ, std::vector<uint8_t>& status, value_type maxSnp, value_type maxStep,
+                                          MatCorrType matCorr, gsl::span<track::TrackLTIntegral> tofInfo, int signCorr) const
+{
+  return propagateToXBatch(tracks, x, true, bZ, status, maxSnp, maxStep, matCorr, tofInfo, signCorr);
+}
+#endif
+
 //____________________________________________________________
 template <typename value_T>
 GPUd() MatBudget PropagatorImpl<value_T>::getMatBudget(PropagatorImpl<value_type>::MatCorrType corrType, const math_utils::Point3D<value_type>& p0, const math_utils::Point3D<value_type>& p1) const
@@ -736,6 +917,9 @@ GPUd() MatBudget PropagatorImpl<value_T>::getMatBudget(PropagatorImpl<value_type
       throw std::runtime_error("requested MatLUT is absent and fall-back to TGeo is disabled");
     }
   }
+  if (mMatBudgetCacheQuantum >= 0.f) {
+    return MatBudgetCache::instance().getMatBudget(*mMatLUT, p0.X(), p0.Y(), p0.Z(), p1.X(), p1.Y(), p1.Z(), mMatBudgetCacheQuantum);
+  }
 #endif
   return mMatLUT->getMatBudget(p0.X(), p0.Y(), p0.Z(), p1.X(), p1.Y(), p1.Z());
 }
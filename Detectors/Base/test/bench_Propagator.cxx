@@ -0,0 +1,146 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  bench_Propagator.cxx
+/// \brief benchmark of the propagation of a set of tracks to a common X, track by track and in batch
+///
+/// The arguments are the number of tracks and the field mode (0 = full field, 1 = Bz only). The tracks
+/// start at the TPC inner radius and are propagated to the beam pipe. The material corrections use the
+/// LUT given by the PROPAGATOR_BENCH_MATLUT environment variable, if set, and its queries are cached with
+/// the quantum (cm) given by the PROPAGATOR_BENCH_MATCACHE environment variable, if set.
+
+#include "benchmark/benchmark.h"
+#include "DetectorsBase/Propagator.h"
+#include "DetectorsBase/MatBudgetCache.h"
+#include "DetectorsBase/MatLayerCylSet.h"
+#include "Field/MagneticField.h"
+#include <TGeoGlobalMagField.h>
+#include <cmath>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace o2::base;
+using TrackParCov = o2::track::TrackParCov;
+
+static constexpr float XSTART = 83.f; // X of the tracks before the propagation
+static constexpr float XEND = 2.f;    // common X to propagate the tracks to
+
+Propagator* getPropagator()
+{
+  static std::once_flag flag;
+  std::call_once(flag, [] {
+    auto field = new o2::field::MagneticField("Maps", "Maps", 1., 1., o2::field::MagFieldParam::k5kG);
+    TGeoGlobalMagField::Instance()->SetField(field);
+    TGeoGlobalMagField::Instance()->Lock();
+    auto propagator = Propagator::Instance();
+    if (const auto lutFile = std::getenv("PROPAGATOR_BENCH_MATLUT")) {
+      propagator->setMatLUT(MatLayerCylSet::loadFromFile(lutFile));
+    }
+    if (const auto quantum = std::getenv("PROPAGATOR_BENCH_MATCACHE")) {
+      propagator->setMatBudgetCacheQuantum(std::atof(quantum));
+    }
+  });
+  return Propagator::Instance();
+}
+
+/// create tracks with random direction, charge and pt above 0.2 GeV
+std::vector<TrackParCov> createTracks(int nTracks)
+{
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<float> uniform(0.f, 1.f);
+  std::vector<TrackParCov> tracks;
+  tracks.reserve(nTracks);
+  const std::array<float, 15> cov = {1e-2, 0., 1e-2, 0., 0., 1e-4, 0., 0., 0., 1e-4, 0., 0., 0., 0., 1e-3};
+  for (int it = 0; it < nTracks; it++) {
+    float alpha = (std::floor(18.f * uniform(generator)) + 0.5f) * M_PI / 9.f;
+    std::array<float, 5> par = {-5.f + 10.f * uniform(generator), -50.f + 100.f * uniform(generator),
+                                -0.3f + 0.6f * uniform(generator), -1.f + 2.f * uniform(generator),
+                                (uniform(generator) > 0.5f ? 1.f : -1.f) * (0.1f + 4.9f * uniform(generator))};
+    tracks.emplace_back(XSTART, alpha, par, cov);
+  }
+  return tracks;
+}
+
+Propagator::MatCorrType getMatCorr(const Propagator* propagator)
+{
+  return propagator->getMatLUT() ? Propagator::MatCorrType::USEMatCorrLUT : Propagator::MatCorrType::USEMatCorrNONE;
+}
+
+void setLabel(benchmark::State& state, const Propagator* propagator)
+{
+  if (!propagator->getMatLUT()) {
+    state.SetLabel("no material");
+  } else if (propagator->getMatBudgetCacheQuantum() < 0.f) {
+    state.SetLabel("LUT");
+  } else {
+    state.SetLabel("LUT, cache hit rate " + std::to_string(MatBudgetCache::instance().getHitRate()));
+  }
+}
+
+static void BM_PropagateSingle(benchmark::State& state)
+{
+  auto propagator = getPropagator();
+  const auto matCorr = getMatCorr(propagator);
+  const bool bzOnly = state.range(1);
+  const auto input = createTracks(state.range(0));
+  std::vector<TrackParCov> tracks;
+  for (auto _ : state) {
+    state.PauseTiming();
+    tracks = input;
+    state.ResumeTiming();
+    for (auto& track : tracks) {
+      benchmark::DoNotOptimize(propagator->propagateTo(track, XEND, bzOnly, Propagator::MAX_SIN_PHI, Propagator::MAX_STEP, matCorr));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * input.size());
+  setLabel(state, propagator);
+}
+
+static void BM_PropagateBatch(benchmark::State& state)
+{
+  auto propagator = getPropagator();
+  const auto matCorr = getMatCorr(propagator);
+  const bool bzOnly = state.range(1);
+  const auto input = createTracks(state.range(0));
+  std::vector<TrackParCov> tracks;
+  std::vector<uint8_t> status;
+  for (auto _ : state) {
+    state.PauseTiming();
+    tracks = input;
+    state.ResumeTiming();
+    if (bzOnly) {
+      propagator->propagateToX(tracks, XEND, propagator->getNominalBz(), status, Propagator::MAX_SIN_PHI, Propagator::MAX_STEP, matCorr);
+    } else {
+      propagator->PropagateToXBxByBz(tracks, XEND, status, Propagator::MAX_SIN_PHI, Propagator::MAX_STEP, matCorr);
+    }
+    benchmark::DoNotOptimize(status.data());
+  }
+  state.SetItemsProcessed(state.iterations() * input.size());
+  setLabel(state, propagator);
+}
+
+static void CustomArguments(benchmark::internal::Benchmark* bench)
+{
+  // number of tracks, full field (0) or Bz only (1)
+  for (const auto nTracks : {100, 1000, 10000}) {
+    for (const auto bzOnly : {0, 1}) {
+      bench->Args({nTracks, bzOnly});
+    }
+  }
+}
+
+BENCHMARK(BM_PropagateSingle)->Apply(CustomArguments)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PropagateBatch)->Apply(CustomArguments)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
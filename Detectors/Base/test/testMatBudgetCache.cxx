@@ -0,0 +1,130 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test MatBudgetCache
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "DetectorsBase/MatBudgetCache.h"
+#include "DetectorsBase/MatLayerCylSet.h"
+#include "DetectorsBase/Ray.h"
+#include <cmath>
+#include <random>
+
+using namespace o2::base;
+
+// LUT of 3 layers with random material in every cell, no geometry needed
+const MatLayerCylSet& getLUT()
+{
+  static MatLayerCylSet lut;
+  if (!lut.getNLayers()) {
+    const float layers[3][2] = {{2.f, 3.f}, {10.f, 12.f}, {30.f, 34.f}};
+    for (const auto& lr : layers) {
+      lut.addLayer(lr[0], lr[1], 50.f, 5.f, 2.f);
+    }
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<float> uniform(0.f, 1.f);
+    for (int il = 0; il < lut.getNLayers(); il++) {
+      auto& lr = lut.getLayer(il);
+      for (int ip = 0; ip < lr.getNPhiBins(); ip++) {
+        for (int iz = 0; iz < lr.getNZBins(); iz++) {
+          auto& cell = lr.getCellPhiBin(ip, iz);
+          cell.meanRho = 0.1f + 2.f * uniform(generator);
+          cell.meanX2X0 = 1e-3f + 1e-2f * uniform(generator);
+        }
+      }
+    }
+    lut.finalizeStructures();
+    lut.flatten();
+    lut.initLayerVoxelLU();
+  }
+  return lut;
+}
+
+void checkEqual(const MatBudget& cached, const MatBudget& direct)
+{
+  BOOST_CHECK_EQUAL(cached.meanRho, direct.meanRho);
+  BOOST_CHECK_EQUAL(cached.meanX2X0, direct.meanX2X0);
+  BOOST_CHECK_EQUAL(cached.length, direct.length);
+}
+
+// with quantum 0 the cache must return exactly the LUT budget, both on a miss and on a hit
+BOOST_AUTO_TEST_CASE(MatBudgetCache_exact)
+{
+  const auto& lut = getLUT();
+  MatBudgetCache cache;
+  std::mt19937 generator(4321);
+  std::uniform_real_distribution<float> uniform(-1.f, 1.f);
+  const int nSegments = 1000;
+  for (int is = 0; is < nSegments; is++) {
+    const float x0 = uniform(generator), y0 = uniform(generator), z0 = uniform(generator);
+    const float x1 = 40.f * uniform(generator), y1 = 40.f * uniform(generator), z1 = 40.f * uniform(generator);
+    const auto direct = lut.getMatBudget(x0, y0, z0, x1, y1, z1);
+    checkEqual(cache.getMatBudget(lut, x0, y0, z0, x1, y1, z1, 0.f), direct); // miss
+    checkEqual(cache.getMatBudget(lut, x0, y0, z0, x1, y1, z1, 0.f), direct); // hit
+  }
+  BOOST_CHECK_EQUAL(cache.getNQueries(), 2 * nSegments);
+  BOOST_CHECK_EQUAL(cache.getNHits(), nSegments);
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.getNQueries(), 0);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 0);
+}
+
+// with a finite quantum, segments rounded to the same endpoints share the entry only if they cross the same layers
+BOOST_AUTO_TEST_CASE(MatBudgetCache_layers)
+{
+  const auto& lut = getLUT();
+  MatBudgetCache cache;
+  const float quantum = 1.f;
+  // all the endpoints are rounded to (0, 0, 0) and (2, 0, 0), the 1st segment stops before the innermost layer
+  const float xEnd[3] = {1.6f, 2.4f, 2.3f};
+  short lmin = -1, lmax = -1;
+  BOOST_CHECK(!lut.getLayersRange(Ray(0.2f, 0.1f, 0.1f, xEnd[0], 0.1f, 0.1f), lmin, lmax) || lmin > lmax);
+  BOOST_REQUIRE(lut.getLayersRange(Ray(0.2f, 0.1f, 0.1f, xEnd[1], 0.1f, 0.1f), lmin, lmax));
+
+  const auto outside = lut.getMatBudget(0.2f, 0.1f, 0.1f, xEnd[0], 0.1f, 0.1f);
+  checkEqual(cache.getMatBudget(lut, 0.2f, 0.1f, 0.1f, xEnd[0], 0.1f, 0.1f, quantum), outside);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 0);
+
+  // same rounded endpoints, different layers: must be a miss
+  const auto inside = lut.getMatBudget(0.2f, 0.1f, 0.1f, xEnd[1], 0.1f, 0.1f);
+  BOOST_CHECK_GT(inside.meanX2X0, 0.f);
+  checkEqual(cache.getMatBudget(lut, 0.2f, 0.1f, 0.1f, xEnd[1], 0.1f, 0.1f, quantum), inside);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 0);
+
+  // same rounded endpoints and layers: hit, with the X/X0 rescaled to the actual segment length
+  const auto cached = cache.getMatBudget(lut, 0.2f, 0.1f, 0.1f, xEnd[2], 0.1f, 0.1f, quantum);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 1);
+  BOOST_CHECK_EQUAL(cached.meanRho, inside.meanRho);
+  BOOST_CHECK_CLOSE(cached.length, xEnd[2] - 0.2f, 1e-4);
+  BOOST_CHECK_CLOSE(cached.meanX2X0, inside.meanX2X0 * cached.length / inside.length, 1e-4);
+
+  // the entry is keyed on the quantum
+  checkEqual(cache.getMatBudget(lut, 0.2f, 0.1f, 0.1f, xEnd[1], 0.1f, 0.1f, 0.5f * quantum), inside);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 1);
+  BOOST_CHECK_EQUAL(cache.getNQueries(), 4);
+}
+
+// the entries of a cache are dropped when the caches are invalidated, e.g. by Propagator::setMatLUT
+BOOST_AUTO_TEST_CASE(MatBudgetCache_invalidate)
+{
+  const auto& lut = getLUT();
+  MatBudgetCache cache;
+  cache.getMatBudget(lut, 0.1f, 0.2f, 0.3f, 20.f, 5.f, 10.f, 0.f);
+  cache.getMatBudget(lut, 0.1f, 0.2f, 0.3f, 20.f, 5.f, 10.f, 0.f);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 1);
+  MatBudgetCache::invalidate();
+  cache.getMatBudget(lut, 0.1f, 0.2f, 0.3f, 20.f, 5.f, 10.f, 0.f);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 1);
+  cache.getMatBudget(lut, 0.1f, 0.2f, 0.3f, 20.f, 5.f, 10.f, 0.f);
+  BOOST_CHECK_EQUAL(cache.getNHits(), 2);
+  BOOST_CHECK_EQUAL(cache.getNQueries(), 4);
+}
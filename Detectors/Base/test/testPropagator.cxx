@@ -0,0 +1,83 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test Propagator
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "DetectorsBase/Propagator.h"
+#include "Field/MagneticField.h"
+#include <TGeoGlobalMagField.h>
+#include <TRandom.h>
+#include <TMath.h>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using namespace o2::base;
+using TrackParCov = o2::track::TrackParCov;
+
+// unit tests on the batched propagation to a common X, compared with the track by track propagation
+BOOST_AUTO_TEST_CASE(Propagator_batch_test)
+{
+  auto field = new o2::field::MagneticField("Maps", "Maps", 1., 1., o2::field::MagFieldParam::k5kG);
+  TGeoGlobalMagField::Instance()->SetField(field);
+  TGeoGlobalMagField::Instance()->Lock();
+  auto propagator = Propagator::Instance();
+
+  // tracks at the TPC inner radius with random direction, charge and pt above 0.1 GeV, some of them looping before X = 2 cm
+  const float xStart = 83.f, xEnd = 2.f;
+  const int ntrk = 1000;
+  const std::array<float, 15> cov = {1e-2, 0., 1e-2, 0., 0., 1e-4, 0., 0., 0., 1e-4, 0., 0., 0., 0., 1e-3};
+  std::vector<TrackParCov> input;
+  for (int it = 0; it < ntrk; it++) {
+    float alpha = (TMath::Floor(18.f * gRandom->Rndm()) + 0.5f) * TMath::Pi() / 9.f;
+    std::array<float, 5> par = {float(gRandom->Uniform(-5., 5.)), float(gRandom->Uniform(-50., 50.)), float(gRandom->Uniform(-0.3, 0.3)),
+                                float(gRandom->Uniform(-1., 1.)), float((gRandom->Rndm() > 0.5 ? 1. : -1.) * gRandom->Uniform(0.1, 5.))};
+    input.emplace_back(xStart, alpha, par, cov);
+  }
+
+  // Bz only, with the default field (fast parametrization if available) and with the measured map forced, in which
+  // case the batch evaluates the map with MagneticField::Field(np, ...)
+  enum class FieldMode { BzOnly,
+                         Default,
+                         FullMap };
+  for (const auto mode : {FieldMode::BzOnly, FieldMode::Default, FieldMode::FullMap}) {
+    const bool bzOnly = mode == FieldMode::BzOnly;
+    propagator->setUseFastField(mode != FieldMode::FullMap);
+    if (mode == FieldMode::FullMap) {
+      BOOST_REQUIRE(!propagator->isFastFieldUsed());
+    }
+    auto tracks = input, single = input;
+    std::vector<uint8_t> status;
+    const int nOK = bzOnly ? propagator->propagateToX(tracks, xEnd, propagator->getNominalBz(), status, Propagator::MAX_SIN_PHI, Propagator::MAX_STEP, Propagator::MatCorrType::USEMatCorrNONE)
+                           : propagator->PropagateToXBxByBz(tracks, xEnd, status, Propagator::MAX_SIN_PHI, Propagator::MAX_STEP, Propagator::MatCorrType::USEMatCorrNONE);
+    BOOST_REQUIRE_EQUAL(status.size(), input.size());
+    BOOST_CHECK_EQUAL(nOK, std::count(status.begin(), status.end(), 1));
+    for (int it = 0; it < ntrk; it++) {
+      const bool ok = propagator->propagateTo(single[it], xEnd, bzOnly, Propagator::MAX_SIN_PHI, Propagator::MAX_STEP, Propagator::MatCorrType::USEMatCorrNONE);
+      BOOST_CHECK_EQUAL(ok, bool(status[it]));
+      if (!ok || !status[it]) {
+        continue;
+      }
+      if (bzOnly) { // same steps with the same constant field: identical results
+        BOOST_CHECK_EQUAL(tracks[it].getY(), single[it].getY());
+        BOOST_CHECK_EQUAL(tracks[it].getZ(), single[it].getZ());
+        BOOST_CHECK_EQUAL(tracks[it].getSnp(), single[it].getSnp());
+      } else {
+        BOOST_CHECK_SMALL(tracks[it].getY() - single[it].getY(), 1e-3f);
+        BOOST_CHECK_SMALL(tracks[it].getZ() - single[it].getZ(), 1e-3f);
+        BOOST_CHECK_SMALL(tracks[it].getSnp() - single[it].getSnp(), 1e-4f);
+      }
+    }
+  }
+  propagator->setUseFastField(true);
+}
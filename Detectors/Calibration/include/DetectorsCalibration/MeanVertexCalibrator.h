@@ -20,6 +20,9 @@
 #include "MathUtils/detail/Bracket.h"
 #include <array>
 #include <deque>
+#include <map>
+#include <mutex>
+#include <utility>
 
 namespace o2
 {
@@ -45,11 +48,12 @@ class MeanVertexCalibrator final : public o2::calibration::TimeSlotCalibration<o
   };
 
   MeanVertexCalibrator() = default;
-  ~MeanVertexCalibrator() final = default;
+  ~MeanVertexCalibrator() final { waitPendingSlots(); } // the workers may still be fitting the slots
 
   bool hasEnoughData(const Slot& slot) const final;
   void initOutput() final;
   void finalizeSlot(Slot& slot) final;
+  void preFinalizeSlot(Slot& slot) final;
   Slot& emplaceNewSlot(bool front, TFType tstart, TFType tend) final;
 
   void doSimpleMovingAverage(std::deque<float>& dq, float& sma);
@@ -84,6 +88,8 @@ class MeanVertexCalibrator final : public o2::calibration::TimeSlotCalibration<o
   std::deque<o2::math_utils::detail::Bracket<long>> mTmpMVobjDqTime;   // This is the deque for the start and end time of the
                                                                        // slots used for the SMA
   bool mVerbose = false;                                               // Whether to log in verbose mode
+  std::map<TFType, std::pair<bool, MVObject>> mFitResults;             //! success and result of the fit of the slots being finalized, by slot start TF
+  std::mutex mFitResultsMutex;                                         //! protects mFitResults when the slots are fitted by worker threads
 
   ClassDefOverride(MeanVertexCalibrator, 1);
 };
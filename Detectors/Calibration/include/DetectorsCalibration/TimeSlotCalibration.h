@@ -20,8 +20,11 @@
 #include "DetectorsBase/GRPGeomHelper.h"
 #include "CommonDataFormat/TFIDInfo.h"
 #include <TFile.h>
+#include <TROOT.h>
+#include <chrono>
 #include <filesystem>
 #include <deque>
+#include <future>
 #include <gsl/gsl>
 #include <limits>
 #include <type_traits>
@@ -120,6 +123,18 @@ class TimeSlotCalibration
 
   void setUpdateAtTheEndOfRunOnly() { mUpdateAtTheEndOfRunOnly = kTRUE; }
 
+  // with n > 0 the closed slots are moved out of the slots pool and preFinalizeSlot is called for them by up to n worker threads,
+  // while the filling goes on; finalizeSlot is then called on the processing thread, in the order of the slots
+  int getNFinalizeThreads() const { return mNFinalizeThreads; }
+  void setNFinalizeThreads(int n)
+  {
+    mNFinalizeThreads = n > 0 ? n : 0;
+    if (mNFinalizeThreads) {
+      ROOT::EnableThreadSafety(); // the workers use ROOT concurrently with the processing thread
+    }
+  }
+  int getNSlotsToFinalize() const { return mSlotsToFinalize.size(); }
+
   int getNSlots() const { return mSlots.size(); }
   Slot& getSlotForTF(TFType tf);
   Slot& getSlot(int i) { return (Slot&)mSlots.at(i); }
@@ -131,9 +146,14 @@ class TimeSlotCalibration
   bool process(const DATA&... data);
   virtual void checkSlotsToFinalize(TFType tf = INFINITE_TF, int maxDelay = 0);
   virtual void finalizeOldestSlot();
+  void deliverFinalizedSlots(bool waitAll = false);
+  // wait for the worker threads without finalizing the slots: to be called by the destructor of the classes overriding preFinalizeSlot
+  void waitPendingSlots();
 
   virtual void reset()
   { // reset to virgin state (need for start - stop - start)
+    waitPendingSlots();
+    mSlotsToFinalize.clear();
     mSlots.clear();
     mLastClosedTF = 0;
     mFirstTF = 0;
@@ -149,6 +169,11 @@ class TimeSlotCalibration
   virtual void initOutput() = 0;
   // process the time slot container and add results to the output
   virtual void finalizeSlot(Slot& slot) = 0;
+  // optional heavy processing of the time slot container preceding finalizeSlot, not touching the output: with
+  // asynchronous finalization it runs on a worker thread, concurrently with the filling and with other slots.
+  // A class overriding it must call waitPendingSlots() in its own destructor: the workers may still be running it,
+  // and the base class destructor is called after the members it uses have been destroyed
+  virtual void preFinalizeSlot(Slot& slot) {}
   // create new time slot in the beginning or the end of the slots pool
   virtual Slot& emplaceNewSlot(bool front, TFType tstart, TFType tend) = 0;
   // check if the slot has enough data to be finalized
@@ -242,7 +267,10 @@ class TimeSlotCalibration
   }
 
   TFType tf2SlotMin(TFType tf) const;
+  void finalizeClosedSlot(Slot& slot);
+  void finalizePendingSlot();
   std::deque<Slot> mSlots;
+  std::deque<std::pair<Slot, std::future<void>>> mSlotsToFinalize; //! closed slots being prepared for finalization by the worker threads
 
   o2::dataformats::TFIDInfo mCurrentTFInfo{};
   int mSlotLengthInSeconds = -1; // optionally provided slot length in seconds
@@ -267,6 +295,7 @@ class TimeSlotCalibration
   bool mWasCheckedInfiniteSlot = false;         // flag to know whether the statistics of the infinite slot was already checked
   bool mUpdateAtTheEndOfRunOnly = false;
   bool mFinalizeWhenReady = false; // if true: single bin is filled until ready, then closed and new one is added
+  int mNFinalizeThreads = 0;       // if > 0: number of worker threads for the asynchronous finalization of the closed slots
 
   std::string mSaveDirectory = ""; // directory where the file is saved
   std::string mSaveFileName = "";  // filename for data saves in the end of the run
@@ -314,6 +343,7 @@ bool TimeSlotCalibration<Container>::process(const DATA&... data)
     // check if some slots are done
     checkSlotsToFinalize(tf, maxDelay);
   }
+  deliverFinalizedSlots();
 
   return true;
 }
@@ -344,7 +374,7 @@ void TimeSlotCalibration<Container>::checkSlotsToFinalize(TFType tf, int maxDela
         mSlots[0].setTFStart(mLastClosedTF);
         mSlots[0].setTFEnd(mMaxSeenTF);
         LOG(info) << "Finalizing slot for " << mSlots[0].getTFStart() << " <= TF <= " << mSlots[0].getTFEnd();
-        finalizeSlot(mSlots[0]);                  // will be removed after finalization
+        finalizeClosedSlot(mSlots[0]);            // will be removed after finalization
         mLastClosedTF = mSlots[0].getTFEnd() < INFINITE_TF ? (mSlots[0].getTFEnd() + 1) : mSlots[0].getTFEnd() < INFINITE_TF; // will not accept any TF below this
         mSlots.erase(mSlots.begin());
         // creating a new slot if we are not at the end of run
@@ -368,7 +398,7 @@ void TimeSlotCalibration<Container>::checkSlotsToFinalize(TFType tf, int maxDela
       if (tfLim < tf) {
         if (hasEnoughData(*slot)) {
           LOG(debug) << "Finalizing slot for " << slot->getTFStart() << " <= TF <= " << slot->getTFEnd();
-          finalizeSlot(*slot); // will be removed after finalization
+          finalizeClosedSlot(*slot); // will be removed after finalization
         } else if ((slot + 1) != mSlots.end()) {
           LOG(info) << "Merging underpopulated slot " << slot->getTFStart() << " <= TF <= " << slot->getTFEnd()
                     << " to slot " << (slot + 1)->getTFStart() << " <= TF <= " << (slot + 1)->getTFEnd();
@@ -385,6 +415,9 @@ void TimeSlotCalibration<Container>::checkSlotsToFinalize(TFType tf, int maxDela
       }
     }
   }
+  if (tf == INFINITE_TF) { // end of run, all outputs should be available
+    deliverFinalizedSlots(true);
+  }
 }
 
 //_________________________________________________
@@ -392,15 +425,70 @@ template <typename Container>
 void TimeSlotCalibration<Container>::finalizeOldestSlot()
 {
   // Enforce finalization and removal of the oldest slot
+  deliverFinalizedSlots(true); // slots still being finalized asynchronously are older
   if (mSlots.empty()) {
     LOG(warning) << "There are no slots defined";
     return;
   }
+  preFinalizeSlot(mSlots.front());
   finalizeSlot(mSlots.front());
   mLastClosedTF = mSlots.front().getTFEnd() + 1; // do not accept any TF below this
   mSlots.erase(mSlots.begin());
 }
 
+//_________________________________________________
+template <typename Container>
+void TimeSlotCalibration<Container>::finalizeClosedSlot(Slot& slot)
+{
+  // Finalize the closed slot, or hand it over to a worker thread in case of asynchronous finalization, leaving it empty
+  if (!mNFinalizeThreads) {
+    preFinalizeSlot(slot);
+    finalizeSlot(slot);
+    return;
+  }
+  while (int(mSlotsToFinalize.size()) >= mNFinalizeThreads) { // all workers are busy
+    finalizePendingSlot();
+  }
+  auto& slotToFinalize = mSlotsToFinalize.emplace_back(std::move(slot), std::future<void>());
+  slotToFinalize.second = std::async(std::launch::async, [this, &closedSlot = slotToFinalize.first]() { preFinalizeSlot(closedSlot); });
+}
+
+//_________________________________________________
+template <typename Container>
+void TimeSlotCalibration<Container>::finalizePendingSlot()
+{
+  // Finalize the oldest slot handed over to the worker threads, waiting for its preparation
+  auto& slotToFinalize = mSlotsToFinalize.front();
+  slotToFinalize.second.get();
+  finalizeSlot(slotToFinalize.first);
+  mSlotsToFinalize.pop_front();
+}
+
+//_________________________________________________
+template <typename Container>
+void TimeSlotCalibration<Container>::waitPendingSlots()
+{
+  // Wait for the preparation of the slots handed over to the worker threads, which call preFinalizeSlot on this object
+  for (auto& slotToFinalize : mSlotsToFinalize) {
+    if (slotToFinalize.second.valid()) {
+      slotToFinalize.second.wait();
+    }
+  }
+}
+
+//_________________________________________________
+template <typename Container>
+void TimeSlotCalibration<Container>::deliverFinalizedSlots(bool waitAll)
+{
+  // Finalize, in order, the slots prepared by the worker threads, stopping at the first one still being prepared unless waitAll is requested
+  while (!mSlotsToFinalize.empty()) {
+    if (!waitAll && mSlotsToFinalize.front().second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      break;
+    }
+    finalizePendingSlot();
+  }
+}
+
 //________________________________________
 template <typename Container>
 inline TFType TimeSlotCalibration<Container>::tf2SlotMin(TFType tf) const
@@ -319,7 +319,13 @@ void MeanVertexCalibrator::fitMeanVertexCoord(int icoord, const float* array, co
     LOG(info) << "**** Printing content of MeanVertex object for coordinate " << icoord;
     printVector(array, hpar);
   }
-  double fitres = fitGaus(hpar.nBins, array, hpar.minRange, hpar.maxRange, fitValues);
+  double fitres = 0;
+  {
+    // this fitGaus uses a static fitter, the slots may be fitted concurrently by the worker threads
+    static std::mutex fitGausMutex;
+    std::lock_guard<std::mutex> lock(fitGausMutex);
+    fitres = fitGaus(hpar.nBins, array, hpar.minRange, hpar.maxRange, fitValues);
+  }
   if (fitres != -4) {
     LOG(info) << "coordinate " << icoord << ": Fit result of full statistics => " << fitres << ". Mean = " << fitValues[1] << " Sigma = " << fitValues[2];
   } else {
@@ -341,6 +347,16 @@ void MeanVertexCalibrator::fitMeanVertexCoord(int icoord, const float* array, co
   }
 }
 
+//_____________________________________________
+void MeanVertexCalibrator::preFinalizeSlot(Slot& slot)
+{
+  // Fit the slot, eventually on a worker thread, keeping the result for finalizeSlot
+  MeanVertexObject mvo;
+  bool fitOK = fitMeanVertex(slot.getContainer(), mvo);
+  std::lock_guard<std::mutex> lock(mFitResultsMutex);
+  mFitResults[slot.getTFStart()] = {fitOK, mvo};
+}
+
 //_____________________________________________
 void MeanVertexCalibrator::finalizeSlot(Slot& slot)
 {
@@ -350,8 +366,22 @@ void MeanVertexCalibrator::finalizeSlot(Slot& slot)
   LOG(info) << "Finalize slot " << slot.getTFStart() << " <= TF <= " << slot.getTFEnd() << " with "
             << c->getEntries() << " entries";
   MeanVertexObject mvo;
+  bool fitOK = false, fitDone = false;
+  {
+    std::lock_guard<std::mutex> lock(mFitResultsMutex);
+    auto fitResult = mFitResults.find(slot.getTFStart());
+    if (fitResult != mFitResults.end()) { // fitted in preFinalizeSlot
+      fitDone = true;
+      fitOK = fitResult->second.first;
+      mvo = fitResult->second.second;
+      mFitResults.erase(fitResult);
+    }
+  }
   // fitting
-  if (!fitMeanVertex(c, mvo)) {
+  if (!fitDone) {
+    fitOK = fitMeanVertex(c, mvo);
+  }
+  if (!fitOK) {
     return;
   }
   mTmpMVobjDqTime.emplace_back(slot.getStartTimeMS(), slot.getEndTimeMS());
@@ -0,0 +1,92 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test MeanVertexCalibrator
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "DetectorsCalibration/MeanVertexCalibrator.h"
+#include "ReconstructionDataFormats/PrimaryVertex.h"
+#include <random>
+#include <vector>
+
+namespace o2
+{
+namespace calibration
+{
+
+using PVertex = o2::dataformats::PrimaryVertex;
+using MVObject = o2::dataformats::MeanVertexObject;
+
+static constexpr int NTF = 60, NVTXPERTF = 200, SLOTLENGTH = 10;
+
+/// create the vertices of the TFs, with a mean transverse position depending on Z
+std::vector<std::vector<PVertex>> createVertices()
+{
+  std::mt19937 generator(1234);
+  std::normal_distribution<float> gaus(0., 1.);
+  std::vector<std::vector<PVertex>> vertices(NTF);
+  for (auto& vtxTF : vertices) {
+    for (int iv = 0; iv < NVTXPERTF; iv++) {
+      float z = 5.f * gaus(generator);
+      vtxTF.emplace_back().setXYZ(0.01f + 0.001f * z + 0.005f * gaus(generator), -0.02f - 0.002f * z + 0.005f * gaus(generator), z);
+    }
+  }
+  return vertices;
+}
+
+/// process all TFs, the slots being closed only at the end, and return the objects of all slots
+std::vector<MVObject> calibrate(const std::vector<std::vector<PVertex>>& vertices, int nThreads)
+{
+  MeanVertexCalibrator calibrator;
+  calibrator.setSlotLength(SLOTLENGTH);
+  calibrator.setMaxSlotsDelay(NTF / SLOTLENGTH); // no slot is closed while the TFs are processed
+  calibrator.setNFinalizeThreads(nThreads);
+  calibrator.initOutput();
+  for (int tf = 0; tf < NTF; tf++) {
+    calibrator.getCurrentTFInfo().tfCounter = tf;
+    BOOST_REQUIRE(calibrator.process(gsl::span<const PVertex>(vertices[tf])));
+  }
+  BOOST_CHECK_EQUAL(calibrator.getNSlots(), NTF / SLOTLENGTH);
+  // close all slots at once: with several threads, more than one slot is being fitted at the same time
+  calibrator.checkSlotsToFinalize(2 * NTF);
+  if (nThreads > 1) {
+    BOOST_CHECK_EQUAL(calibrator.getNSlotsToFinalize(), nThreads);
+  }
+  calibrator.checkSlotsToFinalize(INFINITE_TF);
+  BOOST_CHECK_EQUAL(calibrator.getNSlotsToFinalize(), 0);
+  return calibrator.getMeanVertexObjectVector();
+}
+
+BOOST_AUTO_TEST_CASE(MeanVertexCalibratorAsyncFinalization)
+{
+  const auto vertices = createVertices();
+  const auto reference = calibrate(vertices, 0);
+  BOOST_REQUIRE_EQUAL(reference.size(), NTF / SLOTLENGTH);
+  for (int nThreads : {1, 4}) {
+    const auto result = calibrate(vertices, nThreads);
+    BOOST_REQUIRE_EQUAL(result.size(), reference.size());
+    for (size_t i = 0; i < reference.size(); i++) {
+      BOOST_CHECK_EQUAL(result[i].getX(), reference[i].getX());
+      BOOST_CHECK_EQUAL(result[i].getY(), reference[i].getY());
+      BOOST_CHECK_EQUAL(result[i].getZ(), reference[i].getZ());
+      BOOST_CHECK_EQUAL(result[i].getSigmaX(), reference[i].getSigmaX());
+      BOOST_CHECK_EQUAL(result[i].getSigmaY(), reference[i].getSigmaY());
+      BOOST_CHECK_EQUAL(result[i].getSigmaZ(), reference[i].getSigmaZ());
+      BOOST_CHECK_EQUAL(result[i].getSlopeX(), reference[i].getSlopeX());
+      BOOST_CHECK_EQUAL(result[i].getSlopeY(), reference[i].getSlopeY());
+    }
+  }
+}
+
+} // namespace calibration
+} // namespace o2
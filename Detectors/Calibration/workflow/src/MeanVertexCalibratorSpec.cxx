@@ -33,6 +33,7 @@ void MeanVertexCalibDevice::init(InitContext& ic)
   mCalibrator = std::make_unique<o2::calibration::MeanVertexCalibrator>();
   mCalibrator->setSlotLength(params.tfPerSlot);
   mCalibrator->setMaxSlotsDelay(float(params.maxTFdelay) / params.tfPerSlot);
+  mCalibrator->setNFinalizeThreads(ic.options().get<int>("finalize-threads"));
   bool useVerboseMode = ic.options().get<bool>("use-verbose-mode");
   LOG(info) << " ************************* Verbose? " << useVerboseMode;
   if (useVerboseMode) {
@@ -153,7 +154,8 @@ DataProcessorSpec getMeanVertexCalibDeviceSpec(uint32_t dcsMVsubspec)
     inputs,
     outputs,
     AlgorithmSpec{adaptFromTask<device>(ccdbRequest, dcsMVsubspec)},
-    Options{{"use-verbose-mode", VariantType::Bool, false, {"Use verbose mode"}}}};
+    Options{{"use-verbose-mode", VariantType::Bool, false, {"Use verbose mode"}},
+            {"finalize-threads", VariantType::Int, 0, {"Number of threads fitting the closed slots asynchronously, 0 to fit them on the processing thread"}}}};
 }
 
 } // namespace framework
@@ -14,7 +14,9 @@
 
 #include <iosfwd>
 #include <array>
+#include <cstdint>
 #include <optional>
+#include <vector>
 #include <Rtypes.h>
 #include "EMCALReconstruction/CaloFitResults.h"
 #include "DataFormatsEMCAL/Constants.h"
@@ -52,6 +54,14 @@ class CaloRawFitterGamma2 final : public CaloRawFitter
   int getNiterations() { return mNiter; }
   int getNiterationsMax() { return mNiterationsMax; }
 
+  /// \brief Set the number of threads used for the fits of a batch
+  /// \param nThreads Number of threads
+  void setNumberOfThreads(int nThreads) { mNThreads = nThreads > 1 ? nThreads : 1; }
+
+  /// \brief Get the number of threads used for the fits of a batch
+  /// \return Number of threads
+  int getNumberOfThreads() const { return mNThreads; }
+
   /// \brief Evaluation Amplitude and TOF
   /// \param bunchvector ALTRO bunches for the current channel
   /// \param altrocfg1 ALTRO config register 1 from RCU trailer
@@ -60,9 +70,61 @@ class CaloRawFitterGamma2 final : public CaloRawFitter
   /// \return Container with the fit results (amp, time, chi2, ...)
   CaloFitResults evaluate(const gsl::span<const Bunch> bunchvector) final;
 
+  /// \brief Evaluation Amplitude and TOF for a batch of channels (i.e. all channels of a DDL)
+  /// \param channels ALTRO bunches of each channel of the batch
+  /// \param[out] results Container with the fit results of each channel (default constructed in case of error)
+  /// \param[out] errors Fit error of each channel, if any
+  ///
+  /// The channels are first prepared one by one (bunch selection, pedestal subtraction, initial
+  /// parabola fit), then the Gamma-2 fits of all channels requiring one are performed concurrently.
+  /// The samples are stored as structure of arrays, with the channels in the innermost loop. The fits
+  /// are split in chunks distributed over the threads (see setNumberOfThreads), the fits of a chunk running
+  /// the same Newton iterations until they converge or reach the max number of iterations.
+  /// The results are identical to the ones obtained calling evaluate for each channel.
+  void evaluateBatch(const gsl::span<const gsl::span<const Bunch>> channels, std::vector<CaloFitResults>& results,
+                     std::vector<std::optional<RawFitterError_t>>& errors);
+
  private:
   int mNiter = 0;           ///< number of iteraions
   int mNiterationsMax = 15; ///< max number of iteraions
+  int mNThreads = 1;        //!<! number of threads for the fits of a batch
+
+  static constexpr int BATCH_CHUNK_SIZE = 64; ///< Number of fits of a batch iterated together by a thread
+
+  /// \brief Status of a fit in a batch
+  enum BatchFitStatus : uint8_t {
+    kRunning,   ///< Fit not yet converged
+    kConverged, ///< Fit converged
+    kFailed     ///< Fit failed (matrix diagonalization error or no convergence)
+  };
+
+  std::vector<double> mBatchSamples; //! Samples of the fits of the batch, stored sample by sample
+  std::vector<int> mBatchNSamples;   //! Number of samples of each fit
+  std::vector<float> mBatchAmp;      //! Amplitude of each fit
+  std::vector<float> mBatchTime;     //! Time of each fit
+  std::vector<float> mBatchChi2;     //! Chi2 of each fit
+  std::vector<uint8_t> mBatchStatus; //! Status of each fit
+
+  /// \brief Fits the raw signal time distribution of all channels in the batch concurrently
+  /// \param nFits Number of fits in the batch
+  /// \param stride Distance between two consecutive samples of a fit in mBatchSamples
+  ///
+  /// Same algorithm as doFit_1peak, with the amplitude, time, chi2 and status of each
+  /// fit stored in the mBatch containers. The fits are processed in chunks of BATCH_CHUNK_SIZE
+  /// fits, distributed over mNThreads threads.
+  void doFitBatch_1peak(int nFits, int stride);
+
+  /// \brief Fits a chunk of consecutive fits of the batch
+  /// \param firstFit Index of the first fit of the chunk
+  /// \param nFits Number of fits in the chunk (at most BATCH_CHUNK_SIZE)
+  /// \param stride Distance between two consecutive samples of a fit in mBatchSamples
+  void doFitBatchChunk_1peak(int firstFit, int nFits, int stride);
+
+  /// \brief Build the fit results from the outcome of the fit and the initial estimates
+  /// \return Container with the fit results (amp, time, chi2, ...)
+  /// \throw RawFitterError_t::FIT_ERROR in case the amplitude is below threshold
+  CaloFitResults makeFitResults(float amp, float time, float chi2, int ndf, bool fitDone,
+                                float ampEstimate, float timeEstimate, short maxADC, float pedEstimate) const;
 
   /// \brief Fits the raw signal time distribution
   /// \param firstTimeBin First timebin in the ALTRO bunch
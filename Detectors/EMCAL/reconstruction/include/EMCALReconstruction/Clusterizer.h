@@ -15,6 +15,9 @@
 #define ALICEO2_EMCAL_CLUSTERIZER_H
 
 #include <array>
+#include <bitset>
+#include <utility>
+#include <vector>
 #include <gsl/span>
 #include "Rtypes.h"
 #include "DataFormatsEMCAL/Cluster.h"
@@ -31,6 +34,8 @@ namespace emcal
 // Define numbers rows/columns for topological representation of cells
 constexpr unsigned int NROWS = (24 + 1) * (6 + 4); // 10x supermodule rows (6 for EMCAL, 4 for DCAL). +1 accounts for topological gap between two supermodules
 constexpr unsigned int NCOLS = 48 * 2 + 1;         // 2x  supermodule columns + 1 empty space in between for DCAL (not used for EMCAL)
+constexpr unsigned int NROWSSM = 24 + 1;           // Rows of one row of supermodules, including the topological gap
+constexpr unsigned int NSMROWS = NROWS / NROWSSM;  // Rows of supermodules (supermodules with same phi)
 
 using ClusterIndex = int;
 
@@ -40,7 +45,10 @@ using ClusterIndex = int;
 /// \author Rudiger Haake (Yale)
 ///
 ///  Implementation of same algorithm version as in AliEMCALClusterizerv2,
-///  but optimized.
+///  but optimized. The neighbour search is a flood fill with an explicit
+///  stack, and the rows of supermodules, which are separated by a topological
+///  gap, can be clustered in parallel. The output does not depend on the
+///  number of threads.
 
 template <class InputType>
 class Clusterizer
@@ -81,6 +89,23 @@ class Clusterizer
     ClusterIndex mIndex;     ///< index of the cluster
   };
 
+  /// \struct NeighbourSearchStep
+  /// \brief Cell/digit under processing in the neighbour search, with the next direction to look at
+  struct NeighbourSearchStep {
+    int row;       ///< Row number
+    int column;    ///< Column number
+    int direction; ///< Next direction to look at
+  };
+
+  /// \struct ClusterRange
+  /// \brief Cluster found in a row of supermodules
+  struct ClusterRange {
+    int seed;   ///< Index of the seed in the seed list
+    float time; ///< Time of the seed cell/digit
+    int start;  ///< First cell/digit index of the cluster in the row of supermodules
+    int size;   ///< Number of cells/digits in the cluster
+  };
+
  public:
   /// \brief Main constructor
   /// \param timeCut Max. time difference of cells in cluster in ns
@@ -130,20 +155,37 @@ class Clusterizer
   /// \return List of found cell indices
   const std::vector<ClusterIndex>* getFoundClustersInputIndices() const { return &mInputIndices; }
 
-  /// \brief Set EMCAL geometry
+  /// \brief Set EMCAL geometry and build the map from tower ID to topological row and column
   /// \param geometry Geometry pointer
-  void setGeometry(Geometry* geometry) { mEMCALGeometry = geometry; }
+  void setGeometry(Geometry* geometry);
 
   /// \brief Get pointer to geometry
   /// \return EMCAL geometry
   Geometry* getGeometry() { return mEMCALGeometry; }
 
+  /// \brief Set the number of threads used to cluster the rows of supermodules in parallel
+  /// \param nThreads Number of threads (1 = sequential)
+  void setNumberOfThreads(int nThreads) { mNThreads = nThreads > 1 ? nThreads : 1; }
+
+  /// \brief Get the number of threads used to cluster the rows of supermodules in parallel
+  /// \return Number of threads
+  int getNumberOfThreads() const { return mNThreads; }
+
  private:
-  /// \brief Recursively search for neighbours (EMCAL)
-  /// \param[in,out] clusterInputs Cells/digits of prototype cluster
-  /// \param row Row number from neighbor search in recursion step
-  /// \param column Column number for neighbor search in recursion step
-  void getClusterFromNeighbours(std::vector<InputwithIndex>& clusterInputs, int row, int column);
+  /// \brief Search for neighbours (EMCAL) starting from a seed and add them to the cluster
+  ///
+  /// Depth-first search with an explicit stack. A neighbour is added once all its own
+  /// neighbours have been processed, which gives the same ordering as a recursive search.
+  ///
+  /// \param row Row number of the seed
+  /// \param column Column number of the seed
+  /// \param stack Scratch stack of the search
+  /// \param[in,out] inputIndices Cell/digit indices to which the cluster members are appended, seed first
+  void getClusterFromNeighbours(int row, int column, std::vector<NeighbourSearchStep>& stack, std::vector<ClusterIndex>& inputIndices);
+
+  /// \brief Form clusters in each row of supermodules in parallel and merge them in descending seed energy order
+  /// \param nCells Number of cells/digits in the seed list
+  void findClustersInSupermoduleRows(int nCells);
 
   /// \brief Get row (phi) and column (eta) of a cell/digit, values corresponding to topology
   /// \param input Input object (cell/digit)
@@ -154,7 +196,15 @@ class Clusterizer
   Geometry* mEMCALGeometry = nullptr;                             //!<! pointer to geometry for utilities
   std::array<cellWithE, NROWS * NCOLS> mSeedList;                 //!<! seed array
   std::array<std::array<InputwithIndex, NCOLS>, NROWS> mInputMap; //!<! topology arrays
-  std::array<std::array<bool, NCOLS>, NROWS> mCellMask;           //!<! topology arrays
+  std::array<std::bitset<NCOLS>, NROWS> mCellOccupancy;           //!<! topology bitmap of cells/digits filled in the input map
+  std::array<std::bitset<NCOLS>, NROWS> mCellMask;                //!<! topology bitmap of clustered cells/digits
+  std::vector<std::pair<int, int>> mTowerRowColumn;               //!<! topological row and column for each tower ID
+
+  int mNThreads = 1;                                                      //!<! number of threads for the rows of supermodules
+  std::vector<std::vector<NeighbourSearchStep>> mSearchStacks;            //!<! scratch stacks of the neighbour search, one per thread
+  std::array<std::vector<int>, NSMROWS> mSupermoduleRowSeeds;             //!<! seeds per row of supermodules, in descending energy order
+  std::array<std::vector<ClusterIndex>, NSMROWS> mSupermoduleRowIndices;  //!<! cell/digit indices of the clusters per row of supermodules
+  std::array<std::vector<ClusterRange>, NSMROWS> mSupermoduleRowClusters; //!<! clusters per row of supermodules
 
   std::vector<Cluster> mFoundClusters;     ///<  vector of cluster objects
   std::vector<ClusterIndex> mInputIndices; ///<  vector of associated cell/digit tower ID, ordered by cluster
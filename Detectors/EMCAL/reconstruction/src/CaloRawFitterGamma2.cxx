@@ -13,6 +13,8 @@
 /// \author Martin Poghosyan (Martin.Poghosyan@cern.ch)
 
 #include <fairlogger/Logger.h>
+#include <algorithm>
+#include <array>
 #include <cfloat>
 #include <random>
 
@@ -68,6 +70,103 @@ CaloFitResults CaloRawFitterGamma2::evaluate(const gsl::span<const Bunch> bunchl
     }
   }
 
+  return makeFitResults(amp, time, chi2, ndf, fitDone, ampEstimate, timeEstimate, maxADC, pedEstimate);
+}
+
+void CaloRawFitterGamma2::evaluateBatch(const gsl::span<const gsl::span<const Bunch>> channels, std::vector<CaloFitResults>& results,
+                                        std::vector<std::optional<RawFitterError_t>>& errors)
+{
+  /// Estimates of a channel, needed to build the results once the fit is done
+  struct ChannelEstimates {
+    bool selected = false;  ///< a bunch with significant signal was found
+    int fitIndex = -1;      ///< index of the fit in the batch, if any
+    int ndf = 0;            ///< number of degrees of freedom of the fit
+    int timebinOffset = 0;  ///< offset to convert the fitted time into time bins
+    float ampEstimate = 0;  ///< max. amplitude
+    float timeEstimate = 0; ///< index of the max. amplitude
+    float pedEstimate = 0;  ///< pedestal
+    short maxADC = 0;       ///< max. ADC value
+  };
+
+  const int nChannels = channels.size();
+  results.assign(nChannels, CaloFitResults());
+  errors.assign(nChannels, std::nullopt);
+  std::vector<ChannelEstimates> estimates(nChannels);
+
+  // prepare the channels one by one and store the samples of the ones to be fitted
+  mBatchSamples.assign(constants::EMCAL_MAXTIMEBINS * nChannels, 0.);
+  mBatchNSamples.clear();
+  mBatchAmp.clear();
+  mBatchTime.clear();
+  int nFits = 0;
+  for (int iChannel = 0; iChannel < nChannels; ++iChannel) {
+    auto& estimate = estimates[iChannel];
+    try {
+      auto [nsamples, bunchIndex, ampEstimate,
+            maxADC, timeEstimate, pedEstimate, first, last] = preFitEvaluateSamples(channels[iChannel], mAmpCut);
+      estimate.ampEstimate = ampEstimate;
+      estimate.timeEstimate = timeEstimate;
+      estimate.pedEstimate = pedEstimate;
+      estimate.maxADC = maxADC;
+      if (bunchIndex >= 0 && ampEstimate >= mAmpCut) {
+        estimate.selected = true;
+        const auto& bunch = channels[iChannel][bunchIndex];
+        estimate.timebinOffset = bunch.getStartTime() - (bunch.getBunchLength() - 1);
+        if (nsamples > 2 && maxADC < constants::OVERFLOWCUT) {
+          auto [amp, time] = doParabolaFit(timeEstimate - 1);
+          for (int itbin = 0; itbin < nsamples; itbin++) {
+            mBatchSamples[itbin * nChannels + nFits] = getReversed(itbin);
+          }
+          mBatchNSamples.emplace_back(nsamples);
+          mBatchAmp.emplace_back(amp);
+          mBatchTime.emplace_back(time);
+          estimate.fitIndex = nFits++;
+          estimate.ndf = nsamples - 2;
+        }
+      }
+    } catch (RawFitterError_t& e) {
+      errors[iChannel] = e;
+    }
+  }
+
+  // fit all channels concurrently
+  doFitBatch_1peak(nFits, nChannels);
+
+  // build the results
+  for (int iChannel = 0; iChannel < nChannels; ++iChannel) {
+    if (errors[iChannel]) {
+      continue;
+    }
+    const auto& estimate = estimates[iChannel];
+    float amp = estimate.selected ? estimate.ampEstimate : 0;
+    float time = estimate.selected ? estimate.timeEstimate : 0;
+    float timeEstimate = estimate.timeEstimate;
+    float chi2 = 0;
+    bool fitDone = false;
+    if (estimate.fitIndex >= 0) {
+      if (mBatchStatus[estimate.fitIndex] == kConverged) {
+        amp = mBatchAmp[estimate.fitIndex];
+        time = mBatchTime[estimate.fitIndex];
+        chi2 = mBatchChi2[estimate.fitIndex];
+        fitDone = true;
+      } else {
+        // Fit has failed, set values to estimates
+        chi2 = 1.e9;
+      }
+      time += estimate.timebinOffset;
+      timeEstimate += estimate.timebinOffset;
+    }
+    try {
+      results[iChannel] = makeFitResults(amp, time, chi2, estimate.ndf, fitDone, estimate.ampEstimate, timeEstimate, estimate.maxADC, estimate.pedEstimate);
+    } catch (RawFitterError_t& e) {
+      errors[iChannel] = e;
+    }
+  }
+}
+
+CaloFitResults CaloRawFitterGamma2::makeFitResults(float amp, float time, float chi2, int ndf, bool fitDone,
+                                                   float ampEstimate, float timeEstimate, short maxADC, float pedEstimate) const
+{
   if (fitDone) {
     float ampAsymm = (amp - ampEstimate) / (amp + ampEstimate);
     float timeDiff = time - timeEstimate;
@@ -157,6 +256,124 @@ float CaloRawFitterGamma2::doFit_1peak(int firstTimeBin, int nSamples, float& am
   return chi2;
 }
 
+void CaloRawFitterGamma2::doFitBatch_1peak(int nFits, int stride)
+{
+  mBatchChi2.assign(nFits, 0.);
+  mBatchStatus.assign(nFits, kRunning);
+
+  // the fits are independent, each chunk iterates until all its fits are done
+  const int nChunks = (nFits + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int iChunk = 0; iChunk < nChunks; ++iChunk) {
+    int firstFit = iChunk * BATCH_CHUNK_SIZE;
+    doFitBatchChunk_1peak(firstFit, std::min(BATCH_CHUNK_SIZE, nFits - firstFit), stride);
+  }
+}
+
+void CaloRawFitterGamma2::doFitBatchChunk_1peak(int firstFit, int nFits, int stride)
+{
+  float* amp = &mBatchAmp[firstFit];
+  float* time = &mBatchTime[firstFit];
+  float* chi2 = &mBatchChi2[firstFit];
+  uint8_t* status = &mBatchStatus[firstFit];
+  const int* nSamples = &mBatchNSamples[firstFit];
+  const int maxSamples = *std::max_element(nSamples, nSamples + nFits);
+
+  std::array<double, BATCH_CHUNK_SIZE> c11, c12, c21, c22, d1, d2;
+  std::array<double, BATCH_CHUNK_SIZE> ti, expti, sample;
+  std::array<float, BATCH_CHUNK_SIZE> ampl;
+
+  // same number of iterations as allowed by doFit_1peak
+  for (int iter = 0; iter <= mNiterationsMax; ++iter) {
+
+    c11.fill(0.);
+    c12.fill(0.);
+    c21.fill(0.);
+    c22.fill(0.);
+    d1.fill(0.);
+    d2.fill(0.);
+    for (int iFit = 0; iFit < nFits; ++iFit) {
+      chi2[iFit] = status[iFit] == kRunning ? 0.f : chi2[iFit];
+    }
+
+    // accumulate the sums sample by sample, the fits being in the innermost loop
+    for (int itbin = 0; itbin < maxSamples; itbin++) {
+      const double* samples = &mBatchSamples[itbin * stride + firstFit];
+
+      // select the fits to which the sample contributes and evaluate the exponentials. The inputs of
+      // the other fits are set to 0, which makes all their terms 0 and leaves their sums unchanged
+      for (int iFit = 0; iFit < nFits; ++iFit) {
+        double t = (itbin - time[iFit]) / constants::TAU;
+        bool active = status[iFit] == kRunning && itbin < nSamples[iFit] && !((t + 1) < 0);
+        ti[iFit] = active ? t : 0.;
+        expti[iFit] = active ? TMath::Exp(-2 * t) : 0.;
+        sample[iFit] = active ? samples[iFit] : 0.;
+        ampl[iFit] = active ? amp[iFit] : 0.f;
+      }
+
+      // same expressions as in doFit_1peak, without branches nor calls
+#ifdef WITH_OPENMP
+#pragma omp simd
+#endif
+      for (int iFit = 0; iFit < nFits; ++iFit) {
+        double g_1i = (ti[iFit] + 1) * expti[iFit];
+        double g_i = (ti[iFit] + 1) * g_1i;
+        double gp_i = 2 * (g_i - g_1i);
+        double q1_i = (2 * ti[iFit] + 1) * expti[iFit];
+        double q2_i = g_1i * g_1i * (4 * ti[iFit] + 1);
+        c11[iFit] += (sample[iFit] - ampl[iFit] * 2 * g_i) * gp_i;
+        c12[iFit] += g_i * g_i;
+        c21[iFit] += sample[iFit] * q1_i - ampl[iFit] * q2_i;
+        c22[iFit] += g_i * g_1i;
+        double delta = ampl[iFit] * g_i - sample[iFit];
+        d1[iFit] += delta * g_i;
+        d2[iFit] += delta * g_1i;
+        chi2[iFit] += (delta * delta);
+      }
+    }
+
+    // update the parameters of the fits not yet converged
+    int nRunning = 0;
+    for (int iFit = 0; iFit < nFits; ++iFit) {
+      if (status[iFit] != kRunning) {
+        continue;
+      }
+
+      double D = c11[iFit] * c22[iFit] - c12[iFit] * c21[iFit];
+
+      if (TMath::Abs(D) < DBL_EPSILON) {
+        status[iFit] = kFailed;
+        continue;
+      }
+
+      double dt = (d1[iFit] * c22[iFit] - d2[iFit] * c12[iFit]) / D * constants::TAU;
+      double dA = (d1[iFit] * c21[iFit] - d2[iFit] * c11[iFit]) / D;
+
+      time[iFit] += dt;
+      amp[iFit] += dA;
+
+      if (TMath::Abs(dA) > 1 || TMath::Abs(dt) > 0.01) {
+        ++nRunning;
+      } else {
+        status[iFit] = kConverged;
+      }
+    }
+
+    if (nRunning == 0) {
+      return;
+    }
+  }
+
+  // fits not converged after the max number of iterations are failed
+  for (int iFit = 0; iFit < nFits; ++iFit) {
+    if (status[iFit] == kRunning) {
+      status[iFit] = kFailed;
+    }
+  }
+}
+
 std::tuple<float, float> CaloRawFitterGamma2::doParabolaFit(int maxTimeBin) const
 {
   float amp(0.), time(0.);
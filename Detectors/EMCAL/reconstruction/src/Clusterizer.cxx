@@ -16,6 +16,12 @@
 #include <fairlogger/Logger.h> // for LOG
 #include "EMCALReconstruction/Clusterizer.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#else
+static inline int omp_get_thread_num() { return 0; }
+#endif
+
 using namespace o2::emcal;
 
 //____________________________________________________________________________
@@ -45,39 +51,69 @@ void Clusterizer<InputType>::initialize(double timeCut, double timeMin, double t
 
 //____________________________________________________________________________
 template <class InputType>
-void Clusterizer<InputType>::getClusterFromNeighbours(std::vector<InputwithIndex>& clusterInputs, int row, int column)
+void Clusterizer<InputType>::setGeometry(Geometry* geometry)
 {
-  // Recursion 0, add seed cell/digit to cluster
-  if (!clusterInputs.size()) {
-    clusterInputs.emplace_back(mInputMap[row][column]);
+  mEMCALGeometry = geometry;
+  mTowerRowColumn.clear();
+  if (!mEMCALGeometry) {
+    return;
   }
+  // Tabulate the topological row and column of all towers, used for every cell/digit in findClusters
+  mTowerRowColumn.resize(mEMCALGeometry->GetNCells());
+  InputType input;
+  for (int towerID = 0; towerID < mEMCALGeometry->GetNCells(); towerID++) {
+    input.setTower(towerID);
+    getTopologicalRowColumn(input, mTowerRowColumn[towerID].first, mTowerRowColumn[towerID].second);
+  }
+}
 
-  // Mark the current cell as clustered
-  mCellMask[row][column] = kTRUE;
-
-  // Now go recursively to the next 4 neighbours and add them to the cluster if they fulfill the conditions
+//____________________________________________________________________________
+template <class InputType>
+void Clusterizer<InputType>::getClusterFromNeighbours(int row, int column, std::vector<NeighbourSearchStep>& stack, std::vector<ClusterIndex>& inputIndices)
+{
   constexpr int rowDiffs[4] = {-1, 0, 0, 1};
   constexpr int colDiffs[4] = {0, -1, 1, 0};
-  for (int dir = 0; dir < 4; dir++) {
-    if ((row + rowDiffs[dir] < 0) || (row + rowDiffs[dir] >= NROWS)) {
+
+  // Add seed cell/digit to cluster and mark it as clustered
+  inputIndices.emplace_back(mInputMap[row][column].mIndex);
+  mCellMask[row].set(column);
+
+  // Now go to the next 4 neighbours of the cell on top of the stack and add them to the cluster if they fulfill the conditions.
+  // A cell/digit is added to the cluster when all its neighbours are processed, as in the recursive search.
+  stack.clear();
+  stack.push_back({row, column, 0});
+  while (!stack.empty()) {
+    auto& current = stack.back();
+    if (current.direction == 4) {
+      // Add the cell/digit to the current cluster -- if we end up here, the selected cluster fulfills the condition
+      if (stack.size() > 1) {
+        inputIndices.emplace_back(mInputMap[current.row][current.column].mIndex);
+      }
+      stack.pop_back();
+      continue;
+    }
+    int dir = current.direction++;
+    int nextRow = current.row + rowDiffs[dir], nextColumn = current.column + colDiffs[dir];
+    if ((nextRow < 0) || (nextRow >= static_cast<int>(NROWS))) {
       continue;
     }
-    if ((column + colDiffs[dir] < 0) || (column + colDiffs[dir] >= NCOLS)) {
+    if ((nextColumn < 0) || (nextColumn >= static_cast<int>(NCOLS))) {
       continue;
     }
 
-    if (mInputMap[row + rowDiffs[dir]][column + colDiffs[dir]].mInput) {
-      if (!mCellMask[row + rowDiffs[dir]][column + colDiffs[dir]]) {
-        if (mDoEnergyGradientCut && (mInputMap[row + rowDiffs[dir]][column + colDiffs[dir]].mInput->getEnergy() > mInputMap[row][column].mInput->getEnergy() + mGradientCut)) {
-          continue;
-        }
-        if (not(TMath::Abs(mInputMap[row + rowDiffs[dir]][column + colDiffs[dir]].mInput->getTimeStamp() - mInputMap[row][column].mInput->getTimeStamp()) > mTimeCut)) {
-          getClusterFromNeighbours(clusterInputs, row + rowDiffs[dir], column + colDiffs[dir]);
-          // Add the cell/digit to the current cluster -- if we end up here, the selected cluster fulfills the condition
-          clusterInputs.emplace_back(mInputMap[row + rowDiffs[dir]][column + colDiffs[dir]]);
-        }
-      }
+    if (!mCellOccupancy[nextRow].test(nextColumn) || mCellMask[nextRow].test(nextColumn)) {
+      continue;
+    }
+    auto currentInput = mInputMap[current.row][current.column].mInput, nextInput = mInputMap[nextRow][nextColumn].mInput;
+    if (mDoEnergyGradientCut && (nextInput->getEnergy() > currentInput->getEnergy() + mGradientCut)) {
+      continue;
+    }
+    if (TMath::Abs(nextInput->getTimeStamp() - currentInput->getTimeStamp()) > mTimeCut) {
+      continue;
     }
+    // Mark the neighbour as clustered and look at its own neighbours first
+    mCellMask[nextRow].set(nextColumn);
+    stack.push_back({nextRow, nextColumn, 0});
   }
 }
 
@@ -124,14 +160,16 @@ void Clusterizer<InputType>::findClusters(const gsl::span<InputType const>& inpu
   // - Loop over arrays:
   // --> Check 2D bitmap (don't use cell/digit which are already clustered)
   // --> Take valid cell/digit with highest energy as seed (they are already sorted)
-  // --> Recursive to neighboughs and create cluster
+  // --> Flood fill to neighbours and create cluster
   // --> Seed cell and all neighbours belonging to cluster will be put in 2D bitmap
+  // --> With several threads, the rows of supermodules are processed in parallel and the
+  //     clusters are merged in descending seed energy order (same output as sequential)
 
-  // Reset cell/digit maps and cell masks
-  // Loop over one array dim, then reset each array
+  // Reset the cell/digit occupancy and the cell masks
+  // Loop over one array dim, then reset each bitmap. The input map is only read where occupied.
   for (auto iArr = 0; iArr < NROWS; iArr++) {
-    mCellMask[iArr].fill(kFALSE);
-    mInputMap[iArr].fill({nullptr, -1});
+    mCellOccupancy[iArr].reset();
+    mCellMask[iArr].reset();
   }
 
   // Calibrate cells/digits and fill the maps/arrays
@@ -154,11 +192,11 @@ void Clusterizer<InputType>::findClusters(const gsl::span<InputType const>& inpu
     ehs += inputEnergy;
 
     // Put cell/digit to 2D map
-    int row = 0, column = 0;
-    getTopologicalRowColumn(dig, row, column);
+    auto [row, column] = mTowerRowColumn[dig.getTower()];
     // not referencing dig here to get proper reference and not local copy
     mInputMap[row][column].mInput = inputArray.data() + iIndex; //
     mInputMap[row][column].mIndex = iIndex;                     // mInputMap saves the position of cells/digits in the input array
+    mCellOccupancy[row].set(column);
     mSeedList[nCells].energy = inputEnergy;
     mSeedList[nCells].row = row;
     mSeedList[nCells].column = column;
@@ -168,33 +206,93 @@ void Clusterizer<InputType>::findClusters(const gsl::span<InputType const>& inpu
   // Sort struct arrays with ascending energy
   std::sort(mSeedList.begin(), std::next(std::begin(mSeedList), nCells));
 
-  // Take next valid cell/digit in calorimeter as seed (in descending energy order)
-  for (int i = nCells - 1; i >= 0; i--) {
-    int row = mSeedList[i].row, column = mSeedList[i].column;
-    // Continue if the cell is already masked (i.e. was already clustered)
-    if (mCellMask[row][column]) {
-      continue;
+  if (mSearchStacks.size() < static_cast<std::size_t>(mNThreads)) {
+    mSearchStacks.resize(mNThreads);
+  }
+  if (mNThreads > 1) {
+    findClustersInSupermoduleRows(nCells);
+  } else {
+    // Take next valid cell/digit in calorimeter as seed (in descending energy order)
+    for (int i = nCells - 1; i >= 0; i--) {
+      int row = mSeedList[i].row, column = mSeedList[i].column;
+      // Continue if the cell is already masked (i.e. was already clustered)
+      if (mCellMask[row].test(column)) {
+        continue;
+      }
+      // Continue if energy constraints are not fulfilled
+      if (mSeedList[i].energy <= mThresholdSeedEnergy) {
+        continue;
+      }
+
+      // Seed is found, form cluster and add cells/digits for current cluster to cell/digit index vector
+      int inputIndexStart = mInputIndices.size();
+      getClusterFromNeighbours(row, column, mSearchStacks[0], mInputIndices);
+      int inputIndexSize = mInputIndices.size() - inputIndexStart;
+
+      // Now form cluster object from cells/digits
+      mFoundClusters.emplace_back(mInputMap[row][column].mInput->getTimeStamp(), inputIndexStart, inputIndexSize); // Cluster object initialized w/ time of seed cell, start + size of associated cells
     }
-    // Continue if energy constraints are not fulfilled
+  }
+  LOG(debug) << mFoundClusters.size() << "clusters found from " << nCells << " cells/digits (total=" << inputArray.size() << ")-> ehs " << ehs << " (minE " << mThresholdCellEnergy << ")";
+}
+
+//____________________________________________________________________________
+template <class InputType>
+void Clusterizer<InputType>::findClustersInSupermoduleRows(int nCells)
+{
+  // Distribute the seeds to the rows of supermodules, keeping the descending energy order.
+  // Rows of supermodules are separated by an empty topological row, so clusters never cross them
+  // and the result in one row of supermodules does not depend on the others.
+  for (auto& seeds : mSupermoduleRowSeeds) {
+    seeds.clear();
+  }
+  for (int i = nCells - 1; i >= 0; i--) {
     if (mSeedList[i].energy <= mThresholdSeedEnergy) {
       continue;
     }
+    mSupermoduleRowSeeds[mSeedList[i].row / NROWSSM].push_back(i);
+  }
 
-    // Seed is found, form cluster recursively
-    std::vector<InputwithIndex> clusterInputs;
-    getClusterFromNeighbours(clusterInputs, row, column);
-
-    // Add cells/digits for current cluster to cell/digit index vector
-    int inputIndexStart = mInputIndices.size();
-    for (auto dig : clusterInputs) {
-      mInputIndices.emplace_back(dig.mIndex);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int smRow = 0; smRow < static_cast<int>(NSMROWS); smRow++) {
+    auto& stack = mSearchStacks[omp_get_thread_num()];
+    auto& inputIndices = mSupermoduleRowIndices[smRow];
+    auto& clusters = mSupermoduleRowClusters[smRow];
+    inputIndices.clear();
+    clusters.clear();
+    for (auto seed : mSupermoduleRowSeeds[smRow]) {
+      int row = mSeedList[seed].row, column = mSeedList[seed].column;
+      // Continue if the cell is already masked (i.e. was already clustered)
+      if (mCellMask[row].test(column)) {
+        continue;
+      }
+      int inputIndexStart = inputIndices.size();
+      getClusterFromNeighbours(row, column, stack, inputIndices);
+      clusters.push_back({seed, mInputMap[row][column].mInput->getTimeStamp(), inputIndexStart, static_cast<int>(inputIndices.size()) - inputIndexStart});
     }
-    int inputIndexSize = mInputIndices.size() - inputIndexStart;
+  }
 
-    // Now form cluster object from cells/digits
-    mFoundClusters.emplace_back(mInputMap[row][column].mInput->getTimeStamp(), inputIndexStart, inputIndexSize); // Cluster object initialized w/ time of seed cell, start + size of associated cells
+  // Merge the clusters of all rows of supermodules in descending seed energy order, as in the sequential search
+  std::array<std::size_t, NSMROWS> nextCluster{};
+  while (true) {
+    int selected = -1;
+    for (int smRow = 0; smRow < static_cast<int>(NSMROWS); smRow++) {
+      if (nextCluster[smRow] < mSupermoduleRowClusters[smRow].size() &&
+          (selected < 0 || mSupermoduleRowClusters[smRow][nextCluster[smRow]].seed > mSupermoduleRowClusters[selected][nextCluster[selected]].seed)) {
+        selected = smRow;
+      }
+    }
+    if (selected < 0) {
+      break;
+    }
+    const auto& cluster = mSupermoduleRowClusters[selected][nextCluster[selected]++];
+    const auto& inputIndices = mSupermoduleRowIndices[selected];
+    int inputIndexStart = mInputIndices.size();
+    mInputIndices.insert(mInputIndices.end(), inputIndices.begin() + cluster.start, inputIndices.begin() + cluster.start + cluster.size);
+    mFoundClusters.emplace_back(cluster.time, inputIndexStart, cluster.size);
   }
-  LOG(debug) << mFoundClusters.size() << "clusters found from " << nCells << " cells/digits (total=" << inputArray.size() << ")-> ehs " << ehs << " (minE " << mThresholdCellEnergy << ")";
 }
 
 template class o2::emcal::Clusterizer<o2::emcal::Cell>;
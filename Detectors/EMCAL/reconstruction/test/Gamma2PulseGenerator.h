@@ -0,0 +1,64 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  Gamma2PulseGenerator.h
+/// \brief Generation of ALTRO bunches with a gamma-2 pulse, shared by the Gamma-2 raw fitter test and benchmark
+
+#ifndef ALICEO2_EMCAL_GAMMA2PULSEGENERATOR_H
+#define ALICEO2_EMCAL_GAMMA2PULSEGENERATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "DataFormatsEMCAL/Constants.h"
+#include "EMCALReconstruction/Bunch.h"
+
+namespace o2
+{
+namespace emcal
+{
+
+/// Create a bunch of 15 samples with a gamma-2 pulse of the given amplitude and peak time (in time bins) plus noise
+inline Bunch createBunch(double amplitude, double peakTime, std::mt19937& generator)
+{
+  const int length = constants::EMCAL_MAXTIMEBINS;
+  std::normal_distribution<double> noise(0., 1.);
+  Bunch bunch(length, length - 1);
+  // ADC values are stored in reversed time order
+  for (int isample = length - 1; isample >= 0; --isample) {
+    double x = (isample - peakTime + constants::TAU) / constants::TAU;
+    double signal = (x > 0.) ? amplitude * x * x * std::exp(2. * (1. - x)) : 0.;
+    signal += noise(generator);
+    bunch.addADC(static_cast<uint16_t>(std::clamp(std::round(signal), 0., 1023.)));
+  }
+  return bunch;
+}
+
+/// Create channels with one bunch each, with random amplitude (including low amplitude and overflow) and peak time
+inline std::vector<std::vector<Bunch>> createChannels(int nChannels, unsigned int seed = 1234)
+{
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> amplitude(2., 1000.);
+  std::uniform_real_distribution<double> peakTime(3., 11.);
+  std::vector<std::vector<Bunch>> channels(nChannels);
+  for (auto& channel : channels) {
+    double amp = amplitude(generator);
+    double time = peakTime(generator);
+    channel.emplace_back(createBunch(amp, time, generator));
+  }
+  return channels;
+}
+
+} // namespace emcal
+} // namespace o2
+
+#endif
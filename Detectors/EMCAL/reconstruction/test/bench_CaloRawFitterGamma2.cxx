@@ -0,0 +1,121 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  bench_CaloRawFitterGamma2.cxx
+/// \brief benchmark of the Gamma-2 raw fitter, channel by channel and in batch
+///
+/// The arguments are the number of channels per batch (i.e. per DDL) and, for the batch, the
+/// number of threads. The batch benchmark checks beforehand that the results are the same as
+/// channel by channel within tolerance
+
+#include "benchmark/benchmark.h"
+#include "EMCALReconstruction/Bunch.h"
+#include "EMCALReconstruction/CaloFitResults.h"
+#include "EMCALReconstruction/CaloRawFitterGamma2.h"
+#include "Gamma2PulseGenerator.h"
+#include <gsl/span>
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+using namespace o2::emcal;
+
+static constexpr double TOLERANCE = 1.e-5; // relative tolerance on the fit results
+
+std::vector<gsl::span<const Bunch>> getSpans(const std::vector<std::vector<Bunch>>& channels)
+{
+  std::vector<gsl::span<const Bunch>> spans;
+  spans.reserve(channels.size());
+  for (const auto& channel : channels) {
+    spans.emplace_back(channel);
+  }
+  return spans;
+}
+
+bool isClose(double a, double b)
+{
+  return std::abs(a - b) <= TOLERANCE * std::max(std::abs(a), std::abs(b));
+}
+
+static void BM_Gamma2Single(benchmark::State& state)
+{
+  const auto channels = createChannels(state.range(0));
+  const auto spans = getSpans(channels);
+  CaloRawFitterGamma2 fitter;
+  for (auto _ : state) {
+    for (const auto& bunches : spans) {
+      try {
+        auto result = fitter.evaluate(bunches);
+        benchmark::DoNotOptimize(result);
+      } catch (CaloRawFitter::RawFitterError_t&) {
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * spans.size());
+}
+
+static void BM_Gamma2Batch(benchmark::State& state)
+{
+  const auto channels = createChannels(state.range(0));
+  const auto spans = getSpans(channels);
+  CaloRawFitterGamma2 fitter;
+  fitter.setNumberOfThreads(state.range(1));
+  std::vector<CaloFitResults> results;
+  std::vector<std::optional<CaloRawFitter::RawFitterError_t>> errors;
+
+  // check the results against the ones obtained channel by channel
+  fitter.evaluateBatch(spans, results, errors);
+  for (std::size_t ichannel = 0; ichannel < spans.size(); ++ichannel) {
+    try {
+      auto result = fitter.evaluate(spans[ichannel]);
+      if (errors[ichannel] || !isClose(result.getAmp(), results[ichannel].getAmp()) ||
+          !isClose(result.getTime(), results[ichannel].getTime()) || !isClose(result.getChi2(), results[ichannel].getChi2())) {
+        state.SkipWithError("batch results differ from single channel results");
+        return;
+      }
+    } catch (CaloRawFitter::RawFitterError_t& error) {
+      if (!errors[ichannel] || errors[ichannel].value() != error) {
+        state.SkipWithError("batch errors differ from single channel errors");
+        return;
+      }
+    }
+  }
+
+  for (auto _ : state) {
+    fitter.evaluateBatch(spans, results, errors);
+    benchmark::DoNotOptimize(results.data());
+  }
+  state.SetItemsProcessed(state.iterations() * spans.size());
+}
+
+static void CustomArguments(benchmark::internal::Benchmark* bench)
+{
+  // number of channels per batch
+  for (const auto nChannels : {100, 1000, 3000}) {
+    bench->Args({nChannels});
+  }
+}
+
+static void BatchArguments(benchmark::internal::Benchmark* bench)
+{
+  // number of channels per batch, number of threads
+  for (const auto nChannels : {100, 1000, 3000}) {
+    for (const auto nThreads : {1, 4}) {
+      bench->Args({nChannels, nThreads});
+    }
+  }
+}
+
+BENCHMARK(BM_Gamma2Single)->Apply(CustomArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Gamma2Batch)->Apply(BatchArguments)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,85 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test EMCAL Reconstruction
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <optional>
+#include <vector>
+#include <gsl/span>
+#include "EMCALReconstruction/Bunch.h"
+#include "EMCALReconstruction/CaloFitResults.h"
+#include "EMCALReconstruction/CaloRawFitterGamma2.h"
+#include "Gamma2PulseGenerator.h"
+
+namespace o2
+{
+namespace emcal
+{
+
+BOOST_AUTO_TEST_CASE(CaloRawFitterGamma2Batch_test)
+{
+  // one bunch per channel, including low amplitude and overflow ones
+  const int nChannels = 500;
+  const auto bunches = createChannels(nChannels);
+  std::vector<gsl::span<const Bunch>> channels;
+  for (const auto& channel : bunches) {
+    channels.emplace_back(channel);
+  }
+
+  CaloRawFitterGamma2 fitter;
+  std::vector<CaloFitResults> results;
+  std::vector<std::optional<CaloRawFitter::RawFitterError_t>> errors;
+  fitter.evaluateBatch(channels, results, errors);
+  BOOST_REQUIRE_EQUAL(results.size(), nChannels);
+  BOOST_REQUIRE_EQUAL(errors.size(), nChannels);
+
+  // the fits of the batch are split over several threads, with the same results
+  CaloRawFitterGamma2 fitterThreads;
+  fitterThreads.setNumberOfThreads(4);
+  std::vector<CaloFitResults> resultsThreads;
+  std::vector<std::optional<CaloRawFitter::RawFitterError_t>> errorsThreads;
+  fitterThreads.evaluateBatch(channels, resultsThreads, errorsThreads);
+  BOOST_REQUIRE_EQUAL(resultsThreads.size(), nChannels);
+  BOOST_REQUIRE_EQUAL(errorsThreads.size(), nChannels);
+
+  int nFitted = 0;
+  for (int ichannel = 0; ichannel < nChannels; ++ichannel) {
+    std::optional<CaloRawFitter::RawFitterError_t> error;
+    CaloFitResults result;
+    try {
+      result = fitter.evaluate(channels[ichannel]);
+    } catch (CaloRawFitter::RawFitterError_t& e) {
+      error = e;
+    }
+    BOOST_REQUIRE_EQUAL(error.has_value(), errors[ichannel].has_value());
+    BOOST_REQUIRE_EQUAL(error.has_value(), errorsThreads[ichannel].has_value());
+    if (error) {
+      BOOST_CHECK(error.value() == errors[ichannel].value());
+      BOOST_CHECK(error.value() == errorsThreads[ichannel].value());
+      continue;
+    }
+    ++nFitted;
+    // same arithmetic as the single channel fit, the results must be bit-identical
+    for (const auto& batchResult : {results[ichannel], resultsThreads[ichannel]}) {
+      BOOST_CHECK_EQUAL(result.getAmp(), batchResult.getAmp());
+      BOOST_CHECK_EQUAL(result.getTime(), batchResult.getTime());
+      BOOST_CHECK_EQUAL(result.getChi2(), batchResult.getChi2());
+      BOOST_CHECK_EQUAL(result.getNdf(), batchResult.getNdf());
+      BOOST_CHECK_EQUAL(result.getMaxSig(), batchResult.getMaxSig());
+    }
+  }
+  BOOST_CHECK(nFitted > 0);
+}
+
+} // namespace emcal
+} // namespace o2
@@ -0,0 +1,106 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test EMCAL Reconstruction
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <gsl/span>
+#include "DataFormatsEMCAL/Cell.h"
+#include "EMCALBase/Geometry.h"
+#include "EMCALReconstruction/Clusterizer.h"
+
+namespace o2
+{
+namespace emcal
+{
+
+BOOST_AUTO_TEST_CASE(Clusterizer_ordering_test)
+{
+  auto geometry = Geometry::GetInstanceFromRunNumber(300000);
+  ClusterizerCells clusterizer(10000., 0., 10000., 0.03, true, 0.1, 0.05);
+  clusterizer.setGeometry(geometry);
+
+  // Chain of 3 cells: the neighbour of a neighbour is added before the neighbour itself
+  std::vector<Cell> cells;
+  cells.emplace_back(geometry->GetAbsCellIdFromCellIndexes(0, 9, 10), 3., 0.);
+  cells.emplace_back(geometry->GetAbsCellIdFromCellIndexes(0, 10, 10), 5., 0.);
+  cells.emplace_back(geometry->GetAbsCellIdFromCellIndexes(0, 9, 11), 2., 0.);
+  // Isolated cell in another supermodule, seeding the second cluster
+  cells.emplace_back(geometry->GetAbsCellIdFromCellIndexes(4, 10, 10), 1., 0.);
+
+  clusterizer.findClusters(gsl::span<const Cell>(cells));
+  const auto& clusters = *clusterizer.getFoundClusters();
+  const auto& indices = *clusterizer.getFoundClustersInputIndices();
+  BOOST_REQUIRE_EQUAL(clusters.size(), 2);
+  BOOST_CHECK_EQUAL(clusters[0].getCellIndexFirst(), 0);
+  BOOST_CHECK_EQUAL(clusters[0].getNCells(), 3);
+  BOOST_CHECK_EQUAL(clusters[1].getCellIndexFirst(), 3);
+  BOOST_CHECK_EQUAL(clusters[1].getNCells(), 1);
+  std::vector<ClusterIndex> expected = {1, 2, 0, 3};
+  BOOST_CHECK_EQUAL_COLLECTIONS(indices.begin(), indices.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(Clusterizer_threads_test)
+{
+  auto geometry = Geometry::GetInstanceFromRunNumber(300000);
+
+  // Random cells in the full calorimeter, dense enough to have large clusters
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<float> energy(0., 2.);
+  std::normal_distribution<float> time(0., 20.);
+  std::vector<short> towers(geometry->GetNCells());
+  std::iota(towers.begin(), towers.end(), 0);
+  std::shuffle(towers.begin(), towers.end(), generator);
+  towers.resize(towers.size() / 3);
+  std::vector<Cell> cells;
+  for (auto tower : towers) {
+    cells.emplace_back(tower, energy(generator), 600.f + time(generator));
+  }
+
+  ClusterizerCells sequential(25., 300., 800., 0.03, true, 0.3, 0.05);
+  sequential.setGeometry(geometry);
+  sequential.findClusters(gsl::span<const Cell>(cells));
+
+  ClusterizerCells parallel(25., 300., 800., 0.03, true, 0.3, 0.05);
+  parallel.setGeometry(geometry);
+  parallel.setNumberOfThreads(4);
+  parallel.findClusters(gsl::span<const Cell>(cells));
+
+  const auto& clustersSequential = *sequential.getFoundClusters();
+  const auto& clustersParallel = *parallel.getFoundClusters();
+  BOOST_REQUIRE(clustersSequential.size() > 0);
+  BOOST_REQUIRE_EQUAL(clustersSequential.size(), clustersParallel.size());
+  for (std::size_t icluster = 0; icluster < clustersSequential.size(); ++icluster) {
+    BOOST_CHECK_EQUAL(clustersSequential[icluster].getTimeStamp(), clustersParallel[icluster].getTimeStamp());
+    BOOST_CHECK_EQUAL(clustersSequential[icluster].getCellIndexFirst(), clustersParallel[icluster].getCellIndexFirst());
+    BOOST_CHECK_EQUAL(clustersSequential[icluster].getNCells(), clustersParallel[icluster].getNCells());
+  }
+  const auto& indicesSequential = *sequential.getFoundClustersInputIndices();
+  const auto& indicesParallel = *parallel.getFoundClustersInputIndices();
+  BOOST_CHECK_EQUAL_COLLECTIONS(indicesSequential.begin(), indicesSequential.end(), indicesParallel.begin(), indicesParallel.end());
+
+  // Each cell/digit belongs to at most one cluster
+  std::vector<ClusterIndex> sorted(indicesSequential);
+  std::sort(sorted.begin(), sorted.end());
+  BOOST_CHECK(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+  // Same result when the clusterizer is reused for the next event
+  parallel.findClusters(gsl::span<const Cell>(cells));
+  BOOST_CHECK_EQUAL_COLLECTIONS(indicesSequential.begin(), indicesSequential.end(), parallel.getFoundClustersInputIndices()->begin(), parallel.getFoundClustersInputIndices()->end());
+}
+
+} // namespace emcal
+} // namespace o2
@@ -14,6 +14,7 @@
 
 #include <chrono>
 #include <exception>
+#include <optional>
 #include <vector>
 
 #include "Framework/ConcreteDataMatcher.h"
@@ -27,6 +28,7 @@
 #include "EMCALBase/Mapper.h"
 #include "EMCALBase/TriggerMappingV2.h"
 #include "EMCALReconstruction/CaloRawFitter.h"
+#include "EMCALReconstruction/CaloRawFitterGamma2.h"
 #include "EMCALReconstruction/RawReaderMemory.h"
 #include "EMCALReconstruction/RecoContainer.h"
 #include "EMCALReconstruction/ReconstructionErrors.h"
@@ -110,6 +112,7 @@ namespace reco_workflow
 /// | no-mergeHGLG        | false   | set (bool)      | Do not merge HG and LG channels for same tower |
 /// | no-checkactivelinks | false   | set (bool)      | Do not check for active links per BC           |
 /// | no-evalpedestal     | false   | set (bool)      | Disable pedestal evaluation                    |
+/// | fit-nthreads        | 1       | any int         | Threads for the batch gamma2 fit of a DDL      |
 ///
 /// Global switches of the EMCAL reco workflow related to the RawToCellConverter:
 /// | Option                         | Default | Purpose                                       |
@@ -267,8 +270,17 @@ class RawToCellConverterSpec : public framework::Task
     uint8_t mRow;            ///< Row in supermodule
   };
 
+  /// \struct FEEChannel
+  /// \brief FEE channel of a DDL collected for the batch raw fit
+  struct FEEChannel {
+    const o2::emcal::Channel* mChannel; ///< Channel with the ALTRO bunches
+    LocalPosition mPosition;            ///< Channel coordinates
+    ChannelType_t mChannelType;         ///< Channel type (High Gain, Low Gain, LEDMON)
+  };
+
   using TRUContainer = std::vector<o2::emcal::CompressedTRU>;
   using PatchContainer = std::vector<o2::emcal::CompressedTriggerPatch>;
+  using FitErrorContainer = std::vector<std::optional<CaloRawFitter::RawFitterError_t>>;
 
   /// \brief Check if the timeframe is empty
   /// \param ctx Processing context of timeframe
@@ -321,10 +333,19 @@ class RawToCellConverterSpec : public framework::Task
   /// \param timeCorrector Handler for correction of the time
   /// \param position Channel coordinates
   /// \param chantype Channel type (High Gain, Low Gain, LEDMON)
+  /// \param batchIndex Index of the channel in the batch raw fit of the DDL, -1 if the channel is fitted individually
+  ///
+  /// Performing a raw fit of the bunches in the channel to extract energy and time, or taking
+  /// the result of the batch raw fit, and adding them to the container for FEE data of the given event.
+  void addFEEChannelToEvent(o2::emcal::EventContainer& currentEvent, const o2::emcal::Channel& currentchannel, const CellTimeCorrection& timeCorrector, const LocalPosition& position, ChannelType_t chantype, int batchIndex = -1);
+
+  /// \brief Add the FEE channels collected for the current DDL to the current event
+  /// \param currentEvent Event to add the channels to
+  /// \param timeCorrector Handler for correction of the time
   ///
-  /// Performing a raw fit of the bunches in the channel to extract energy and time, and
-  /// adding them to the container for FEE data of the given event.
-  void addFEEChannelToEvent(o2::emcal::EventContainer& currentEvent, const o2::emcal::Channel& currentchannel, const CellTimeCorrection& timeCorrector, const LocalPosition& position, ChannelType_t chantype);
+  /// The channels collected in mFEEChannels are fitted together with the batch evaluation
+  /// of the gamma2 raw fitter, then added in their original order.
+  void addFEEChannelsToEvent(o2::emcal::EventContainer& currentEvent, const CellTimeCorrection& timeCorrector);
 
   /// \brief Add TRU channel to the event
   /// \param currentEvent Event to add the channel to
@@ -519,6 +540,11 @@ class RawToCellConverterSpec : public framework::Task
   std::unique_ptr<MappingHandler> mMapper = nullptr;                 ///!<! Mapper
   std::unique_ptr<TriggerMappingV2> mTriggerMapping;                 ///!<! Trigger mapping
   std::unique_ptr<CaloRawFitter> mRawFitter;                         ///!<! Raw fitter
+  CaloRawFitterGamma2* mBatchRawFitter = nullptr;                    ///!<! Raw fitter with batch evaluation (gamma2), owned by mRawFitter
+  std::vector<FEEChannel> mFEEChannels;                              ///< FEE channels of the current DDL for the batch raw fit
+  std::vector<gsl::span<const Bunch>> mFEEChannelBunches;            ///< Bunches of the FEE channels of the current DDL
+  std::vector<CaloFitResults> mBatchFitResults;                      ///< Results of the batch raw fit
+  FitErrorContainer mBatchFitErrors;                                 ///< Errors of the batch raw fit
   std::vector<Cell> mOutputCells;                                    ///< Container with output cells
   std::vector<TriggerRecord> mOutputTriggerRecords;                  ///< Container with output trigger records for cells
   std::vector<ErrorTypeFEE> mOutputDecoderErrors;                    ///< Container with decoder errors
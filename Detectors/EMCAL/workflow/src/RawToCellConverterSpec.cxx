@@ -87,7 +87,10 @@ void RawToCellConverterSpec::init(framework::InitContext& ctx)
     mRawFitter = std::unique_ptr<CaloRawFitter>(new o2::emcal::CaloRawFitterStandard);
   } else if (fitmethod == "gamma2") {
     LOG(info) << "Using gamma2 raw fitter";
-    mRawFitter = std::unique_ptr<CaloRawFitter>(new o2::emcal::CaloRawFitterGamma2);
+    mBatchRawFitter = new o2::emcal::CaloRawFitterGamma2;
+    mBatchRawFitter->setNumberOfThreads(ctx.options().get<int>("fit-nthreads"));
+    LOG(info) << "Fitting the channels of each DDL in batch with " << mBatchRawFitter->getNumberOfThreads() << " thread(s)";
+    mRawFitter = std::unique_ptr<CaloRawFitter>(mBatchRawFitter);
   } else {
     LOG(fatal) << "Unknown fit method" << fitmethod;
   }
@@ -279,7 +282,9 @@ void RawToCellConverterSpec::run(framework::ProcessingContext& ctx)
         uint16_t iSM = feeID / 2;
 
         // Loop over all the channels
+        // With the gamma2 fitter the FEE channels are collected and fitted together at the end of the DDL
         int nBunchesNotOK = 0;
+        mFEEChannels.clear();
         for (auto& chan : decoder.getChannels()) {
           try {
             auto iRow = map.getRow(chan.getHardwareAddress());
@@ -289,12 +294,20 @@ void RawToCellConverterSpec::run(framework::ProcessingContext& ctx)
             switch (chantype) {
               case o2::emcal::ChannelType_t::HIGH_GAIN:
               case o2::emcal::ChannelType_t::LOW_GAIN:
-                addFEEChannelToEvent(currentEvent, chan, timeCorrector, channelPosition, chantype);
+                if (mBatchRawFitter) {
+                  mFEEChannels.push_back({&chan, channelPosition, chantype});
+                } else {
+                  addFEEChannelToEvent(currentEvent, chan, timeCorrector, channelPosition, chantype);
+                }
                 break;
               case o2::emcal::ChannelType_t::LEDMON:
                 // Drop LEDMON reconstruction in case of physics triggers
                 if (triggerbits & o2::trigger::Cal) {
-                  addFEEChannelToEvent(currentEvent, chan, timeCorrector, channelPosition, chantype);
+                  if (mBatchRawFitter) {
+                    mFEEChannels.push_back({&chan, channelPosition, chantype});
+                  } else {
+                    addFEEChannelToEvent(currentEvent, chan, timeCorrector, channelPosition, chantype);
+                  }
                 }
                 break;
               case o2::emcal::ChannelType_t::TRU:
@@ -309,6 +322,9 @@ void RawToCellConverterSpec::run(framework::ProcessingContext& ctx)
             continue;
           }
         }
+        if (!mFEEChannels.empty()) {
+          addFEEChannelsToEvent(currentEvent, timeCorrector);
+        }
       } catch (o2::emcal::MappingHandler::DDLInvalid& ddlerror) {
         // Unable to catch mapping
         handleDDLError(ddlerror, feeID);
@@ -448,7 +464,21 @@ bool RawToCellConverterSpec::isLostTimeframe(framework::ProcessingContext& ctx)
   return false;
 }
 
-void RawToCellConverterSpec::addFEEChannelToEvent(o2::emcal::EventContainer& currentEvent, const o2::emcal::Channel& currentchannel, const CellTimeCorrection& timeCorrector, const LocalPosition& position, ChannelType_t chantype)
+void RawToCellConverterSpec::addFEEChannelsToEvent(o2::emcal::EventContainer& currentEvent, const CellTimeCorrection& timeCorrector)
+{
+  mFEEChannelBunches.clear();
+  for (const auto& feechannel : mFEEChannels) {
+    mFEEChannelBunches.emplace_back(feechannel.mChannel->getBunches());
+  }
+  mBatchRawFitter->evaluateBatch(mFEEChannelBunches, mBatchFitResults, mBatchFitErrors);
+  for (std::size_t ichannel = 0; ichannel < mFEEChannels.size(); ++ichannel) {
+    const auto& feechannel = mFEEChannels[ichannel];
+    addFEEChannelToEvent(currentEvent, *feechannel.mChannel, timeCorrector, feechannel.mPosition, feechannel.mChannelType, ichannel);
+  }
+  mFEEChannels.clear();
+}
+
+void RawToCellConverterSpec::addFEEChannelToEvent(o2::emcal::EventContainer& currentEvent, const o2::emcal::Channel& currentchannel, const CellTimeCorrection& timeCorrector, const LocalPosition& position, ChannelType_t chantype, int batchIndex)
 {
   int CellID = -1;
   bool isLowGain = false;
@@ -468,9 +498,16 @@ void RawToCellConverterSpec::addFEEChannelToEvent(o2::emcal::EventContainer& cur
   }
 
   // define the conatiner for the fit results, and perform the raw fitting using the stadnard raw fitter
+  // or take the result of the batch fit of the DDL
   CaloFitResults fitResults;
   try {
-    fitResults = mRawFitter->evaluate(currentchannel.getBunches());
+    if (batchIndex < 0) {
+      fitResults = mRawFitter->evaluate(currentchannel.getBunches());
+    } else if (mBatchFitErrors[batchIndex]) {
+      throw mBatchFitErrors[batchIndex].value();
+    } else {
+      fitResults = mBatchFitResults[batchIndex];
+    }
     // Prevent negative entries - we should no longer get here as the raw fit usually will end in an error state
     if (fitResults.getAmp() < 0) {
       fitResults.setAmp(0.);
@@ -1063,5 +1100,6 @@ o2::framework::DataProcessorSpec o2::emcal::reco_workflow::getRawToCellConverter
       {"printtrailer", o2::framework::VariantType::Bool, false, {"Print RCU trailer (for debugging)"}},
       {"no-mergeHGLG", o2::framework::VariantType::Bool, false, {"Do not merge HG and LG channels for same tower"}},
       {"no-checkactivelinks", o2::framework::VariantType::Bool, false, {"Do not check for active links per BC"}},
-      {"no-evalpedestal", o2::framework::VariantType::Bool, false, {"Disable pedestal evaluation"}}}};
+      {"no-evalpedestal", o2::framework::VariantType::Bool, false, {"Disable pedestal evaluation"}},
+      {"fit-nthreads", o2::framework::VariantType::Int, 1, {"Number of threads for the batch gamma2 raw fit of the channels of a DDL"}}}};
 }
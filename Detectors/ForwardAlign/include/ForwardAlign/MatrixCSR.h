@@ -0,0 +1,58 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file MatrixCSR.h
+/// \brief Compressed sparse row snapshot of a MatrixSq, used for the matrix-vector products of the iterative solvers
+
+#ifndef ALICEO2_FWDALIGN_MATRIXCSR_H
+#define ALICEO2_FWDALIGN_MATRIXCSR_H
+
+#include <vector>
+
+namespace o2
+{
+namespace fwdalign
+{
+
+class MatrixSq;
+
+/// \class MatrixCSR
+/// \brief read-only copy of the non-zero elements of a square matrix in the compressed sparse row format
+///
+/// The symmetric matrices, which store only their lower triangle, are expanded to full rows, so that
+/// each row of the product can be computed independently and the rows are shared among the threads.
+class MatrixCSR
+{
+ public:
+  MatrixCSR() = default;
+
+  /// \brief constructor from the matrix to copy
+  MatrixCSR(const MatrixSq& mat) { Build(mat); }
+
+  /// \brief copy the non-zero elements of the matrix, the dense matrices being scanned element by element
+  void Build(const MatrixSq& mat);
+
+  /// \brief fill vecOut by matrix * vecIn using nThreads threads (if compiled with OpenMP)
+  void MultiplyByVec(const double* vecIn, double* vecOut, int nThreads = 1) const;
+
+  int GetSize() const { return fRowStart.empty() ? 0 : int(fRowStart.size()) - 1; }
+  size_t GetNElems() const { return fElems.size(); }
+
+ protected:
+  std::vector<size_t> fRowStart; ///< index of the first element of each row, the last entry being the number of elements
+  std::vector<int> fColumns;     ///< column of each element
+  std::vector<double> fElems;    ///< non-zero elements
+};
+
+} // namespace fwdalign
+} // namespace o2
+
+#endif
@@ -198,6 +198,10 @@ class MillePede2
   static void SetMinResMaxIter(const int val = 2000) { fgMinResMaxIter = val; }
   static void SetIterSolverType(const int val = MinResSolve::kSolMinRes) { fgIterSol = val; }
   static void SetNKrylovV(const int val = 60) { fgNKrylovV = val; }
+  /// \brief number of threads of the matrix-vector products of the MinRes/FGMRES iterations.
+  /// The local fits are still accumulated sequentially into the global matrix: the records come from
+  /// a single reader and LocalFit works on shared scratch buffers
+  static void SetNThreads(const int val = 1) { fgNThreads = val; }
 
   static bool GetInvChol() { return fgInvChol; }
   static int GetMinResPrecondType() { return fgMinResCondType; }
@@ -205,6 +209,7 @@ class MillePede2
   static int GetMinResMaxIter() { return fgMinResMaxIter; }
   static int GetIterSolverType() { return fgIterSol; }
   static int GetNKrylovV() { return fgNKrylovV; }
+  static int GetNThreads() { return fgNThreads; }
 
   /// \brief return error for parameter iPar
   double GetParError(int iPar) const;
@@ -383,6 +388,7 @@ class MillePede2
   static int fgMinResMaxIter;   ///< Max number of iterations for the MinRes method
   static int fgIterSol;         ///< type of iterative solution: MinRes or FGMRES
   static int fgNKrylovV;        ///< size of Krylov vectors buffer in FGMRES
+  static int fgNThreads;        ///< number of threads for the matrix-vector products of the iterative solvers
 
   // processed data record bufferization
   o2::fwdalign::MilleRecordWriter* fRecordWriter;         ///< data record writer
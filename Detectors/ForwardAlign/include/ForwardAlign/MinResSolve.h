@@ -27,6 +27,7 @@ namespace fwdalign
 
 class MatrixSq;
 class MatrixSparse;
+class MatrixCSR;
 class SymBDMatrix;
 
 /// \class MinResSolve
@@ -96,6 +97,16 @@ class MinResSolve : public TObject
   /// \brief clear aux. space
   void ClearAux();
 
+  /// \brief set the number of threads for the matrix-vector products (if compiled with OpenMP)
+  void SetNThreads(Int_t n);
+  Int_t GetNThreads() const { return fNThreads; }
+
+  /// \brief build the CSR copy of the matrix for the multi-threaded matrix-vector products
+  Bool_t InitAuxCSR();
+
+  /// \brief fill vecOut by matrix * vecIn, using the CSR copy of the matrix if it was built
+  void MultiplyByVec(const double* vecIn, double* vecOut) const;
+
   /// \brief build Band-Diagonal preconditioner
   Int_t BuildPreconBD(Int_t hwidth);
 
@@ -116,6 +127,7 @@ class MinResSolve : public TObject
   Int_t fPrecon;     ///< preconditioner type
   MatrixSq* fMatrix; ///< matrix defining the equations
   Double_t* fRHS;    ///< right hand side
+  Int_t fNThreads;   ///< number of threads for the matrix-vector products
 
   Double_t* fPVecY;    ///< aux. space
   Double_t* fPVecR1;   // aux. space
@@ -131,6 +143,7 @@ class MinResSolve : public TObject
   MatrixSparse* fMatL; // aux. space
   MatrixSparse* fMatU; // aux. space
   SymBDMatrix* fMatBD; // aux. space
+  MatrixCSR* fMatCSR;  //! aux. space
 
   ClassDefOverride(MinResSolve, 0);
 };
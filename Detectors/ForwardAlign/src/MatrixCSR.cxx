@@ -0,0 +1,110 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @file MatrixCSR.cxx
+
+#include <algorithm>
+
+#include "ForwardAlign/MatrixCSR.h"
+#include "ForwardAlign/MatrixSq.h"
+#include "ForwardAlign/MatrixSparse.h"
+
+using namespace o2::fwdalign;
+
+//___________________________________________________________
+void MatrixCSR::Build(const MatrixSq& mat)
+{
+  const int size = mat.GetSize();
+  const bool symmetric = mat.IsSymmetric();
+  fRowStart.assign(size + 1, 0);
+  fColumns.clear();
+  fElems.clear();
+
+  if (!mat.InheritsFrom("MatrixSparse")) { // dense matrix: scan all elements, Query takes care of the symmetry
+    for (int rw = 0; rw < size; rw++) {
+      for (int cl = 0; cl < size; cl++) {
+        double val = mat.Query(rw, cl);
+        if (val != 0.) {
+          fColumns.push_back(cl);
+          fElems.push_back(val);
+        }
+      }
+      fRowStart[rw + 1] = fElems.size();
+    }
+    return;
+  }
+
+  const auto& matSp = (const MatrixSparse&)mat;
+  // count the elements of each row, the off-diagonal elements of a symmetric matrix contributing to 2 rows
+  for (int rw = 0; rw < size; rw++) {
+    const VectorSparse* rowV = matSp.GetRow(rw);
+    if (!rowV) {
+      continue;
+    }
+    const UShort_t* indV = rowV->GetIndices();
+    const Double_t* elmV = rowV->GetElems();
+    for (int iel = 0; iel < rowV->GetNElems(); iel++) {
+      if (elmV[iel]) {
+        fRowStart[rw + 1]++;
+        if (symmetric && indV[iel] != rw) {
+          fRowStart[indV[iel] + 1]++;
+        }
+      }
+    }
+  }
+  for (int rw = 0; rw < size; rw++) {
+    fRowStart[rw + 1] += fRowStart[rw];
+  }
+  fColumns.resize(fRowStart[size]);
+  fElems.resize(fRowStart[size]);
+
+  // fill the rows: the lower triangle part of each row precedes the upper one, filled by the transposed elements
+  std::vector<size_t> fillPos(fRowStart.begin(), fRowStart.end() - 1);
+  for (int rw = 0; rw < size; rw++) {
+    const VectorSparse* rowV = matSp.GetRow(rw);
+    if (!rowV) {
+      continue;
+    }
+    const UShort_t* indV = rowV->GetIndices();
+    const Double_t* elmV = rowV->GetElems();
+    for (int iel = 0; iel < rowV->GetNElems(); iel++) {
+      if (!elmV[iel]) {
+        continue;
+      }
+      auto pos = fillPos[rw]++;
+      fColumns[pos] = indV[iel];
+      fElems[pos] = elmV[iel];
+      if (symmetric && indV[iel] != rw) {
+        pos = fillPos[indV[iel]]++;
+        fColumns[pos] = rw;
+        fElems[pos] = elmV[iel];
+      }
+    }
+  }
+}
+
+//___________________________________________________________
+void MatrixCSR::MultiplyByVec(const double* vecIn, double* vecOut, int nThreads) const
+{
+  const int size = GetSize();
+#ifdef WITH_OPENMP
+  nThreads = std::max(1, nThreads);
+  int ngroup = std::min(50, std::max(1, size / nThreads));
+#pragma omp parallel for schedule(dynamic, ngroup) num_threads(nThreads)
+#endif
+  for (int rw = 0; rw < size; rw++) {
+    double sum = 0.;
+    for (size_t iel = fRowStart[rw]; iel < fRowStart[rw + 1]; iel++) {
+      sum += fElems[iel] * vecIn[fColumns[iel]];
+    }
+    vecOut[rw] = sum;
+  }
+}
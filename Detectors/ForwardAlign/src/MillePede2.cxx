@@ -46,6 +46,7 @@ double MillePede2::fgMinResTol = 1.e-11;             // default tolerance
 int MillePede2::fgMinResMaxIter = 10000;             // default max number of iterations
 int MillePede2::fgIterSol = MinResSolve::kSolMinRes; // default iterative solver
 int MillePede2::fgNKrylovV = 240;                    // default number of Krylov vectors to keep
+int MillePede2::fgNThreads = 1;                      // default number of threads for the iterative solvers
 
 //_____________________________________________________________________________
 MillePede2::MillePede2()
@@ -1379,6 +1380,7 @@ int MillePede2::SolveGlobalMatEq()
   if (!slv) {
     return kFailed;
   }
+  slv->SetNThreads(fgNThreads);
   bool res = false;
   if (fgIterSol == MinResSolve::kSolMinRes) {
     res = slv->SolveMinRes(sol, fgMinResCondType, fgMinResMaxIter, fgMinResTol);
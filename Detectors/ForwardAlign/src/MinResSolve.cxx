@@ -19,6 +19,7 @@
 #include "ForwardAlign/MinResSolve.h"
 #include "ForwardAlign/MatrixSq.h"
 #include "ForwardAlign/MatrixSparse.h"
+#include "ForwardAlign/MatrixCSR.h"
 #include "ForwardAlign/SymBDMatrix.h"
 
 using namespace o2::fwdalign;
@@ -31,6 +32,7 @@ MinResSolve::MinResSolve()
     fPrecon(0),
     fMatrix(nullptr),
     fRHS(nullptr),
+    fNThreads(1),
     fPVecY(nullptr),
     fPVecR1(nullptr),
     fPVecR2(nullptr),
@@ -44,7 +46,8 @@ MinResSolve::MinResSolve()
     fDiagLU(nullptr),
     fMatL(nullptr),
     fMatU(nullptr),
-    fMatBD(nullptr)
+    fMatBD(nullptr),
+    fMatCSR(nullptr)
 {
 }
 
@@ -55,6 +58,7 @@ MinResSolve::MinResSolve(const MinResSolve& src)
     fPrecon(src.fPrecon),
     fMatrix(src.fMatrix),
     fRHS(src.fRHS),
+    fNThreads(src.fNThreads),
     fPVecY(nullptr),
     fPVecR1(nullptr),
     fPVecR2(nullptr),
@@ -68,7 +72,8 @@ MinResSolve::MinResSolve(const MinResSolve& src)
     fDiagLU(nullptr),
     fMatL(nullptr),
     fMatU(nullptr),
-    fMatBD(nullptr)
+    fMatBD(nullptr),
+    fMatCSR(nullptr)
 {
 }
 
@@ -78,6 +83,7 @@ MinResSolve::MinResSolve(const MatrixSq* mat, const TVectorD* rhs)
     fPrecon(0),
     fMatrix((MatrixSq*)mat),
     fRHS((double*)rhs->GetMatrixArray()),
+    fNThreads(1),
     fPVecY(nullptr),
     fPVecR1(nullptr),
     fPVecR2(nullptr),
@@ -91,7 +97,8 @@ MinResSolve::MinResSolve(const MatrixSq* mat, const TVectorD* rhs)
     fDiagLU(nullptr),
     fMatL(nullptr),
     fMatU(nullptr),
-    fMatBD(nullptr)
+    fMatBD(nullptr),
+    fMatCSR(nullptr)
 {
 }
 
@@ -101,6 +108,7 @@ MinResSolve::MinResSolve(const MatrixSq* mat, const double* rhs)
     fPrecon(0),
     fMatrix((MatrixSq*)mat),
     fRHS((double*)rhs),
+    fNThreads(1),
     fPVecY(nullptr),
     fPVecR1(nullptr),
     fPVecR2(nullptr),
@@ -114,7 +122,8 @@ MinResSolve::MinResSolve(const MatrixSq* mat, const double* rhs)
     fDiagLU(nullptr),
     fMatL(nullptr),
     fMatU(nullptr),
-    fMatBD(nullptr)
+    fMatBD(nullptr),
+    fMatCSR(nullptr)
 {
 }
 
@@ -132,6 +141,7 @@ MinResSolve& MinResSolve::operator=(const MinResSolve& src)
     fPrecon = src.fPrecon;
     fMatrix = src.fMatrix;
     fRHS = src.fRHS;
+    fNThreads = src.fNThreads;
   }
   return *this;
 }
@@ -208,7 +218,7 @@ Bool_t MinResSolve::SolveFGMRES(double* VecSol, Int_t precon, int itnlim, double
     }
   }
 
-  if (!InitAuxFGMRES(nkrylov)) {
+  if (!InitAuxFGMRES(nkrylov) || !InitAuxCSR()) {
     return kFALSE;
   }
 
@@ -222,7 +232,7 @@ Bool_t MinResSolve::SolveFGMRES(double* VecSol, Int_t precon, int itnlim, double
   while (1) {
 
     //-------------------- compute initial residual vector
-    fMatrix->MultiplyByVec(VecSol, fPvv[0]);
+    MultiplyByVec(VecSol, fPvv[0]);
     for (l = fSize; l--;) {
       fPvv[0][l] = fRHS[l] - fPvv[0][l]; //  fPvv[0]= initial residual
     }
@@ -263,7 +273,7 @@ Bool_t MinResSolve::SolveFGMRES(double* VecSol, Int_t precon, int itnlim, double
       }
 
       //-------------------- matvec operation w = A z_{j} = A M^{-1} v_{j}
-      fMatrix->MultiplyByVec(fPvz[i], fPvv[i1]);
+      MultiplyByVec(fPvz[i], fPvv[i1]);
 
       // modified gram - schmidt...
       // h_{i,j} = (w,v_{i})
@@ -411,7 +421,7 @@ Bool_t MinResSolve::SolveMinRes(double* VecSol, Int_t precon, int itnlim, double
   double rnorm = 0;
   double gam, gmax = 1, gmin = 1, gbar, oldeps, epsa, epsx, epsr, diag, delta, phi, denom, z;
 
-  if (!InitAuxMinRes()) {
+  if (!InitAuxMinRes() || !InitAuxCSR()) {
     return kFALSE;
   }
 
@@ -489,7 +499,7 @@ Bool_t MinResSolve::SolveMinRes(double* VecSol, Int_t precon, int itnlim, double
     for (int i = fSize; i--;) {
       fPVecV[i] = s * fPVecY[i]; // v = vk if P = I
     }
-    fMatrix->MultiplyByVec(fPVecV, fPVecY); //      APROD (VecV, VecY);
+    MultiplyByVec(fPVecV, fPVecY); //      APROD (VecV, VecY);
 
     if (itn >= 2) {
       double btrat = beta / oldb;
@@ -770,6 +780,50 @@ void MinResSolve::ClearAux()
     delete fMatBD;
   }
   fMatBD = nullptr;
+  if (fMatCSR) {
+    delete fMatCSR;
+  }
+  fMatCSR = nullptr;
+}
+
+//___________________________________________________________
+void MinResSolve::SetNThreads(Int_t n)
+{
+#ifdef WITH_OPENMP
+  fNThreads = n > 0 ? n : 1;
+#else
+  fNThreads = 1;
+#endif
+}
+
+//___________________________________________________________
+Bool_t MinResSolve::InitAuxCSR()
+{
+  if (fMatCSR) {
+    delete fMatCSR;
+  }
+  fMatCSR = nullptr;
+  // the CSR copy pays off only when the products are shared among several threads
+  if (fNThreads < 2) {
+    return kTRUE;
+  }
+  TStopwatch timer;
+  timer.Start();
+  fMatCSR = new MatrixCSR(*fMatrix);
+  timer.Stop();
+  LOG(info) << "Built CSR copy of the matrix with " << fMatCSR->GetNElems() << " elements for "
+            << fNThreads << " threads in " << std::fixed << std::setprecision(2) << timer.CpuTime() << " s";
+  return kTRUE;
+}
+
+//___________________________________________________________
+void MinResSolve::MultiplyByVec(const double* vecIn, double* vecOut) const
+{
+  if (fMatCSR) {
+    fMatCSR->MultiplyByVec(vecIn, vecOut, fNThreads);
+  } else {
+    fMatrix->MultiplyByVec(vecIn, vecOut);
+  }
 }
 
 //___________________________________________________________
@@ -0,0 +1,129 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  bench_MinResSolve.cxx
+/// \brief benchmark of the sparse matrix-vector product and of the iterative solution of the MillePede2 global equations
+///
+/// The synthetic global matrix is accumulated as in MillePede2, from the outer products of the derivatives of
+/// records involving a few alignable modules of 6 parameters each, plus a diagonal regularization term.
+/// The arguments are the number of global parameters and, for the CSR product and the MinRes solution, the number
+/// of threads.
+
+#include "benchmark/benchmark.h"
+#include "Framework/Logger.h"
+#include "ForwardAlign/MatrixCSR.h"
+#include "ForwardAlign/MatrixSparse.h"
+#include "ForwardAlign/MinResSolve.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace o2::fwdalign;
+
+static constexpr int NDOFMODULE = 6;  // parameters per alignable module
+static constexpr int NMODULESREC = 4; // modules involved in each record
+
+/// create the symmetric positive definite global matrix and the right hand side
+std::unique_ptr<MatrixSparse> createMatrix(int nGlo, std::vector<double>& rhs)
+{
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+  const int nModules = nGlo / NDOFMODULE;
+  std::uniform_int_distribution<int> module(0, nModules - 1);
+  auto mat = std::make_unique<MatrixSparse>(nGlo);
+  mat->SetSymmetric(true);
+  std::vector<int> indices(NMODULESREC * NDOFMODULE);
+  std::vector<double> derivatives(indices.size());
+  for (int irec = 0; irec < 2 * nModules; irec++) {
+    for (int im = 0; im < NMODULESREC; im++) {
+      int firstPar = module(generator) * NDOFMODULE;
+      for (int ip = 0; ip < NDOFMODULE; ip++) {
+        indices[im * NDOFMODULE + ip] = firstPar + ip;
+      }
+    }
+    for (auto& der : derivatives) {
+      der = uniform(generator);
+    }
+    for (size_t ip = 0; ip < indices.size(); ip++) {
+      for (size_t iq = 0; iq <= ip; iq++) {
+        (*mat)(indices[ip], indices[iq]) += derivatives[ip] * derivatives[iq];
+      }
+    }
+  }
+  rhs.resize(nGlo);
+  for (int ip = 0; ip < nGlo; ip++) {
+    mat->DiagElem(ip) += 1.;
+    rhs[ip] = uniform(generator);
+  }
+  return mat;
+}
+
+static void BM_MatrixSparseMultiply(benchmark::State& state)
+{
+  std::vector<double> vecIn, vecOut(state.range(0));
+  const auto mat = createMatrix(state.range(0), vecIn);
+  for (auto _ : state) {
+    mat->MultiplyByVec(vecIn.data(), vecOut.data());
+    benchmark::DoNotOptimize(vecOut.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_MatrixCSRMultiply(benchmark::State& state)
+{
+  std::vector<double> vecIn, vecOut(state.range(0));
+  const auto mat = createMatrix(state.range(0), vecIn);
+  const int nThreads = state.range(1);
+  const MatrixCSR matCSR(*mat);
+  for (auto _ : state) {
+    matCSR.MultiplyByVec(vecIn.data(), vecOut.data(), nThreads);
+    benchmark::DoNotOptimize(vecOut.data());
+  }
+  state.counters["elements"] = matCSR.GetNElems();
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_MinResSolve(benchmark::State& state)
+{
+  fair::Logger::SetConsoleSeverity(fair::Severity::warning);
+  std::vector<double> rhs, solution(state.range(0));
+  const auto mat = createMatrix(state.range(0), rhs);
+  MinResSolve solver(mat.get(), rhs.data());
+  solver.SetNThreads(state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(solver.SolveMinRes(solution.data(), MinResSolve::kPreconBD, 2000, 1e-12));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void SparseArguments(benchmark::internal::Benchmark* bench)
+{
+  // number of global parameters
+  for (const auto nGlo : {6000, 24000, 60000}) {
+    bench->Args({nGlo});
+  }
+}
+
+static void ThreadsArguments(benchmark::internal::Benchmark* bench)
+{
+  // number of global parameters and number of threads
+  for (const auto nGlo : {6000, 24000, 60000}) {
+    for (const auto nThreads : {1, 4, 8}) {
+      bench->Args({nGlo, nThreads});
+    }
+  }
+}
+
+BENCHMARK(BM_MatrixSparseMultiply)->Apply(SparseArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MatrixCSRMultiply)->Apply(ThreadsArguments)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MinResSolve)->Apply(ThreadsArguments)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
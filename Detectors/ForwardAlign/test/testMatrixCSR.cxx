@@ -0,0 +1,136 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test MatrixCSR
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "ForwardAlign/MatrixCSR.h"
+#include "ForwardAlign/MatrixSparse.h"
+#include "ForwardAlign/MinResSolve.h"
+#include "ForwardAlign/SymMatrix.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace o2
+{
+namespace fwdalign
+{
+
+static constexpr int SIZE = 120;       // size of the test matrices
+static constexpr int FIRSTEMPTY = 40;  // first row (and column) left empty
+static constexpr int LASTEMPTY = 59;   // last row (and column) left empty
+static constexpr double DENSITY = 0.1; // fraction of the filled off-diagonal elements
+
+bool isEmpty(int i) { return i >= FIRSTEMPTY && i <= LASTEMPTY; }
+
+/// fill the lower triangle and the diagonal of the matrix, except for the rows and columns of the empty range,
+/// an element being set to 0 after each 10 filled ones. Returns the number of non-zero elements of the full matrix
+int fillMatrix(MatrixSq& mat, bool symmetric)
+{
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  int nElems = 0, nFilled = 0;
+  for (int rw = 0; rw < SIZE; rw++) {
+    for (int cl = 0; cl < (symmetric ? rw + 1 : SIZE); cl++) {
+      if (isEmpty(rw) || isEmpty(cl) || (rw != cl && uniform(generator) > DENSITY)) {
+        continue;
+      }
+      double& elem = mat(rw, cl);
+      if (++nFilled % 10) {
+        elem = -1. + 2. * uniform(generator) + (rw == cl ? 10. : 0.);
+        nElems += (symmetric && rw != cl) ? 2 : 1;
+      } else {
+        elem = 0.;
+      }
+    }
+  }
+  return nElems;
+}
+
+/// check the CSR product with 1 and several threads against the product of the original matrix
+void checkProduct(const MatrixSq& mat, int nElems)
+{
+  const MatrixCSR matCSR(mat);
+  BOOST_CHECK_EQUAL(matCSR.GetSize(), SIZE);
+  BOOST_CHECK_EQUAL(matCSR.GetNElems(), size_t(nElems));
+
+  std::mt19937 generator(4321);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+  std::vector<double> vecIn(SIZE), reference(SIZE), vecOut(SIZE);
+  for (auto& v : vecIn) {
+    v = uniform(generator);
+  }
+  mat.MultiplyByVec(vecIn.data(), reference.data());
+  for (int nThreads : {1, 4}) {
+    std::fill(vecOut.begin(), vecOut.end(), 1.);
+    matCSR.MultiplyByVec(vecIn.data(), vecOut.data(), nThreads);
+    for (int rw = 0; rw < SIZE; rw++) {
+      if (isEmpty(rw)) {
+        BOOST_CHECK_EQUAL(vecOut[rw], 0.);
+      } else {
+        BOOST_CHECK_SMALL(vecOut[rw] - reference[rw], 1e-12);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MatrixCSRSymmetricSparse)
+{
+  MatrixSparse mat(SIZE);
+  mat.SetSymmetric(true);
+  const int nElems = fillMatrix(mat, true);
+  checkProduct(mat, nElems);
+}
+
+BOOST_AUTO_TEST_CASE(MatrixCSRSparse)
+{
+  MatrixSparse mat(SIZE);
+  const int nElems = fillMatrix(mat, false);
+  checkProduct(mat, nElems);
+}
+
+BOOST_AUTO_TEST_CASE(MatrixCSRDenseSymmetric)
+{
+  SymMatrix mat(SIZE);
+  const int nElems = fillMatrix(mat, true);
+  checkProduct(mat, nElems);
+}
+
+BOOST_AUTO_TEST_CASE(MinResSolveThreads)
+{
+  // diagonally dominant symmetric matrix, including the otherwise empty rows
+  MatrixSparse mat(SIZE);
+  mat.SetSymmetric(true);
+  fillMatrix(mat, true);
+  std::vector<double> rhs(SIZE), solution(SIZE), reference(SIZE), product(SIZE);
+  for (int rw = 0; rw < SIZE; rw++) {
+    mat.DiagElem(rw) += 20.;
+    rhs[rw] = std::sin(rw);
+  }
+
+  MinResSolve solverRef(&mat, rhs.data());
+  BOOST_REQUIRE(solverRef.SolveMinRes(reference.data(), MinResSolve::kPreconBD, 2000, 1e-12));
+  MinResSolve solver(&mat, rhs.data());
+  solver.SetNThreads(4);
+  BOOST_REQUIRE(solver.SolveMinRes(solution.data(), MinResSolve::kPreconBD, 2000, 1e-12));
+  mat.MultiplyByVec(solution.data(), product.data());
+  for (int rw = 0; rw < SIZE; rw++) {
+    BOOST_CHECK_SMALL(product[rw] - rhs[rw], 1e-6);
+    BOOST_CHECK_SMALL(solution[rw] - reference[rw], 1e-6);
+  }
+}
+
+} // namespace fwdalign
+} // namespace o2
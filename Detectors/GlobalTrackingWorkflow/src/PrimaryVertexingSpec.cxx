@@ -82,6 +82,7 @@ void PrimaryVertexingSpec::init(InitContext& ic)
     throw std::runtime_error(fmt::format("directory {} for raw data dumps does not exist", dumpDir));
   }
   mVertexer.setPoolDumpDirectory(dumpDir);
+  mVertexer.setNThreads(ic.options().get<int>("threads"));
   mVertexer.setTrackSources(mTrackSrc);
 }
 
@@ -286,7 +287,8 @@ DataProcessorSpec getPrimaryVertexingSpec(GTrackID::mask_t src, bool skip, bool
     dataRequest->inputs,
     outputs,
     AlgorithmSpec{adaptFromTask<PrimaryVertexingSpec>(dataRequest, ggRequest, src, skip, validateWithFT0, useMC)},
-    Options{{"pool-dumps-directory", VariantType::String, "", {"Destination directory for the tracks pool dumps"}}}};
+    Options{{"pool-dumps-directory", VariantType::String, "", {"Destination directory for the tracks pool dumps"}},
+            {"threads", VariantType::Int, 1, {"Number of threads"}}}};
 }
 
 } // namespace vertexing
@@ -16,6 +16,7 @@
 
 #include "MCHAlign/AlignmentSpec.h"
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <tuple>
@@ -68,6 +69,7 @@
 #include "DetectorsCommonDataFormats/AlignParam.h"
 #include "DetectorsCommonDataFormats/DetID.h"
 #include "DetectorsCommonDataFormats/DetectorNameConf.h"
+#include "ForwardAlign/MillePede2.h"
 #include "MathUtils/Cartesian.h"
 #include "MCHAlign/Aligner.h"
 #include "MCHGeometryTransformer/Transformations.h"
@@ -237,6 +239,9 @@ class AlignmentTask
     auto SigmaY = ic.options().get<float>("sigma-y");
     mAlign.SetSigmaXY(SigmaX, SigmaY);
 
+    // Threads of the iterative solver of the global fit
+    o2::fwdalign::MillePede2::SetNThreads(std::max(1, ic.options().get<int>("nthreads")));
+
     // Configuration for track fitter
     const auto& trackerParam = TrackerParam::Instance();
     trackFitter.setBendingVertexDispersion(trackerParam.bendingVertexDispersion);
@@ -932,6 +937,7 @@ o2::framework::DataProcessorSpec getAlignmentSpec(bool disableCCDB)
             {"variation-z", VariantType::Float, 2.0, {"Allowed variation for z axis in cm"}},
             {"sigma-x", VariantType::Float, 1000.0, {"Sigma cut along X"}},
             {"sigma-y", VariantType::Float, 1000.0, {"Sigma cut along Y"}},
+            {"nthreads", VariantType::Int, 1, {"Number of threads of the MillePede2 iterative solver"}},
             {"fix-de", VariantType::String, "", {"DE fixing, ex 101,1019"}},
             {"mask-fix-de", VariantType::String, "", {"Mask for DE d.o.f fixing, ex 0,2,4"}},
             {"output", VariantType::String, "Alignment", {"Option for name of output file"}}}};
@@ -42,6 +42,14 @@ class MathiesonOriginal
 
   float integrate(float xMin, float yMin, float xMax, float yMax) const;
 
+  /// The integral is factorized in x and y: integrate(xMin, yMin, xMax, yMax) is identical to
+  /// integrate(integrateX(xMin, xMax), integrateY(yMin, yMax)). This allows to reuse the
+  /// 1D parts when integrating over many areas sharing the same limits in one direction.
+  double integrateX(float xMin, float xMax) const;
+  double integrateY(float yMin, float yMax) const;
+  /// combine the 1D parts of the integral
+  float integrate(double integralX, double integralY) const { return static_cast<float>(4. * mKx4 * integralX * mKy4 * integralY); }
+
  private:
   float mSqrtKx3 = 0.;      ///< Mathieson Sqrt(Kx3)
   float mKx2 = 0.;          ///< Mathieson Kx2
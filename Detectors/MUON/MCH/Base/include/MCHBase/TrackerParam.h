@@ -45,6 +45,8 @@ struct TrackerParam : public o2::conf::ConfigurableParamHelper<TrackerParam> {
   std::size_t maxCandidates = 50000; ///< maximum number of track candidates above which the tracking abort
   double maxTrackingDuration = 300.; ///< maximum tracking duration in second above which the tracking abort
 
+  int nThreads = 1; ///< number of threads used to follow the track candidates down to station 1
+
   O2ParamDef(TrackerParam, "MCHTracking");
 };
 
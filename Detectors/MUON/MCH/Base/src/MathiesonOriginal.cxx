@@ -49,21 +49,35 @@ void MathiesonOriginal::setSqrtKy3AndDeriveKy2Ky4(float sqrtKy3)
 float MathiesonOriginal::integrate(float xMin, float yMin, float xMax, float yMax) const
 {
   /// integrate the Mathieson over x and y in the given area
+  return integrate(integrateX(xMin, xMax), integrateY(yMin, yMax));
+}
+
+//_________________________________________________________________________________________________
+double MathiesonOriginal::integrateX(float xMin, float xMax) const
+{
+  /// integrate the Mathieson over x in the given range, without normalization
 
   xMin *= mInversePitch;
   xMax *= mInversePitch;
-  yMin *= mInversePitch;
-  yMax *= mInversePitch;
-  //
-  // The Mathieson function
+
   double uxMin = mSqrtKx3 * TMath::TanH(mKx2 * xMin);
   double uxMax = mSqrtKx3 * TMath::TanH(mKx2 * xMax);
 
+  return TMath::ATan(uxMax) - TMath::ATan(uxMin);
+}
+
+//_________________________________________________________________________________________________
+double MathiesonOriginal::integrateY(float yMin, float yMax) const
+{
+  /// integrate the Mathieson over y in the given range, without normalization
+
+  yMin *= mInversePitch;
+  yMax *= mInversePitch;
+
   double uyMin = mSqrtKy3 * TMath::TanH(mKy2 * yMin);
   double uyMax = mSqrtKy3 * TMath::TanH(mKy2 * yMax);
 
-  return static_cast<float>(4. * mKx4 * (TMath::ATan(uxMax) - TMath::ATan(uxMin)) *
-                            mKy4 * (TMath::ATan(uyMax) - TMath::ATan(uyMin)));
+  return TMath::ATan(uyMax) - TMath::ATan(uyMin);
 }
 
 } // namespace mch
@@ -0,0 +1,146 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file PixelGrid.h
+/// \brief Definition of the regular pixel grid used by the original cluster finder algorithm
+///
+/// It replaces the ROOT 2D histograms used to project pads onto pixels and to search for
+/// maxima, with the same binning conventions (bins numbered from 1, under/overflow bins
+/// at 0 and n+1) so that the results are identical, but without the allocation overhead.
+/// The storage is reused from one precluster to the next.
+
+#ifndef O2_MCH_PIXELGRID_H_
+#define O2_MCH_PIXELGRID_H_
+
+#include <limits>
+#include <vector>
+
+namespace o2
+{
+namespace mch
+{
+
+/// regular 2D grid of pixels for internal use
+template <typename T>
+class PixelGrid
+{
+ public:
+  /// regular binning in one direction, following the TAxis conventions
+  class Axis
+  {
+   public:
+    /// set the binning
+    void set(int nBins, double min, double max)
+    {
+      mNBins = nBins;
+      mMin = min;
+      mMax = max;
+    }
+    /// return the number of bins
+    int getNbins() const { return mNBins; }
+    /// return the lower edge of the first bin
+    double getMin() const { return mMin; }
+    /// return the upper edge of the last bin
+    double getMax() const { return mMax; }
+    /// return the bin width
+    double getBinWidth() const { return (mMax - mMin) / static_cast<double>(mNBins); }
+    /// return the center of the given bin
+    double getBinCenter(int bin) const
+    {
+      double binWidth = getBinWidth();
+      return mMin + (bin - 1) * binWidth + 0.5 * binWidth;
+    }
+    /// return the bin containing the given position (0 = underflow, nBins+1 = overflow)
+    int findBin(double x) const
+    {
+      if (x < mMin) {
+        return 0;
+      } else if (!(x < mMax)) {
+        return mNBins + 1;
+      }
+      return 1 + static_cast<int>(mNBins * (x - mMin) / (mMax - mMin));
+    }
+
+   private:
+    int mNBins = 0;   ///< number of bins
+    double mMin = 0.; ///< lower edge of the first bin
+    double mMax = 0.; ///< upper edge of the last bin
+  };
+
+  /// set the binning and reset the content of all the pixels
+  void reset(int nBinsX, double xMin, double xMax, int nBinsY, double yMin, double yMax)
+  {
+    mXAxis.set(nBinsX, xMin, xMax);
+    mYAxis.set(nBinsY, yMin, yMax);
+    mContent.assign((nBinsX + 2) * (nBinsY + 2), T(0));
+  }
+
+  /// return the binning in x
+  const Axis& getXaxis() const { return mXAxis; }
+  /// return the binning in y
+  const Axis& getYaxis() const { return mYAxis; }
+  /// return the number of bins in x
+  int getNbinsX() const { return mXAxis.getNbins(); }
+  /// return the number of bins in y
+  int getNbinsY() const { return mYAxis.getNbins(); }
+
+  /// return the content of the pixel (i,j)
+  T getBinContent(int i, int j) const { return mContent[index(i, j)]; }
+  /// set the content of the pixel (i,j)
+  void setBinContent(int i, int j, T content) { mContent[index(i, j)] = content; }
+  /// add the weight to the pixel containing the position (x,y)
+  void fill(double x, double y, T weight) { mContent[index(mXAxis.findBin(x), mYAxis.findBin(y))] += weight; }
+
+  /// return the maximum content, excluding under/overflow
+  T getMaximum() const
+  {
+    T maximum = std::numeric_limits<T>::lowest();
+    for (int j = 1; j <= getNbinsY(); ++j) {
+      for (int i = 1; i <= getNbinsX(); ++i) {
+        T content = getBinContent(i, j);
+        if (content > maximum) {
+          maximum = content;
+        }
+      }
+    }
+    return maximum;
+  }
+
+  /// find the first pixel with the maximum content, excluding under/overflow
+  void getMaximumBin(int& iMax, int& jMax) const
+  {
+    T maximum = std::numeric_limits<T>::lowest();
+    iMax = jMax = 0;
+    for (int j = 1; j <= getNbinsY(); ++j) {
+      for (int i = 1; i <= getNbinsX(); ++i) {
+        T content = getBinContent(i, j);
+        if (content > maximum) {
+          maximum = content;
+          iMax = i;
+          jMax = j;
+        }
+      }
+    }
+  }
+
+ private:
+  /// return the index of the pixel (i,j) in the flat array
+  int index(int i, int j) const { return i + (getNbinsX() + 2) * j; }
+
+  Axis mXAxis{};             ///< binning in x
+  Axis mYAxis{};             ///< binning in y
+  std::vector<T> mContent{}; ///< content of the pixels, including under/overflow
+};
+
+} // namespace mch
+} // namespace o2
+
+#endif // O2_MCH_PIXELGRID_H_
@@ -0,0 +1,107 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file benchClusterFinderOriginal.cxx
+/// \brief benchmark of the original MLEM cluster finder
+///
+/// The preclusters are made of the superimposed Mathieson charge distributions of
+/// several nearby hits, as in high-occupancy events. The first argument is the
+/// detection element and the second one the number of hits per precluster.
+/// Running it on two revisions allows to compare different implementations.
+
+#include "benchmark/benchmark.h"
+#include "DataFormatsMCH/Digit.h"
+#include "MCHBase/MathiesonOriginal.h"
+#include "MCHClustering/ClusterFinderOriginal.h"
+#include "MCHMappingInterface/Segmentation.h"
+#include <fairlogger/Logger.h>
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace o2::mch;
+
+// createPreClusters generates nPreClusters preclusters of nHits hits each on the given detection element
+std::vector<std::vector<Digit>> createPreClusters(int deId, int nHits, int nPreClusters)
+{
+  const auto& segmentation = mapping::segmentation(deId);
+  MathiesonOriginal mathieson;
+  if (deId < 300) {
+    mathieson.setPitch(0.21);
+    mathieson.setSqrtKx3AndDeriveKx2Kx4(0.7000);
+    mathieson.setSqrtKy3AndDeriveKy2Ky4(0.7550);
+  } else {
+    mathieson.setPitch(0.25);
+    mathieson.setSqrtKx3AndDeriveKx2Kx4(0.7131);
+    mathieson.setSqrtKy3AndDeriveKy2Ky4(0.7642);
+  }
+
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> randomPad(0, segmentation.nofPads() - 1);
+  std::uniform_real_distribution<double> randomShift(-1., 1.);
+  std::uniform_real_distribution<double> randomCharge(500., 2000.);
+
+  std::vector<std::vector<Digit>> preClusters(nPreClusters);
+  for (auto& digits : preClusters) {
+    int padId = randomPad(rng);
+    double x0 = segmentation.padPositionX(padId);
+    double y0 = segmentation.padPositionY(padId);
+    std::vector<std::array<double, 3>> hits(nHits);
+    for (auto& hit : hits) {
+      hit = {x0 + randomShift(rng), y0 + randomShift(rng), randomCharge(rng)};
+    }
+    segmentation.forEachPadInArea(x0 - 4., y0 - 4., x0 + 4., y0 + 4., [&](int dePadIndex) {
+      double x = segmentation.padPositionX(dePadIndex);
+      double y = segmentation.padPositionY(dePadIndex);
+      double dx = segmentation.padSizeX(dePadIndex) / 2.;
+      double dy = segmentation.padSizeY(dePadIndex) / 2.;
+      double charge = 0.;
+      for (const auto& hit : hits) {
+        charge += hit[2] * mathieson.integrate(x - dx - hit[0], y - dy - hit[1], x + dx - hit[0], y + dy - hit[1]);
+      }
+      if (charge > 5.) {
+        digits.emplace_back(deId, dePadIndex, static_cast<uint32_t>(charge), 0);
+      }
+    });
+  }
+  return preClusters;
+}
+
+static void BM_ClusterFinderOriginal(benchmark::State& state)
+{
+  fair::Logger::SetConsoleSeverity(fair::Severity::warning);
+  const auto preClusters = createPreClusters(state.range(0), state.range(1), 100);
+
+  ClusterFinderOriginal clusterFinder;
+  clusterFinder.init(false);
+  for (auto _ : state) {
+    clusterFinder.reset();
+    for (const auto& digits : preClusters) {
+      clusterFinder.findClusters(digits);
+    }
+    benchmark::DoNotOptimize(clusterFinder.getClusters());
+  }
+  clusterFinder.deinit();
+  state.counters["clusters"] = clusterFinder.getClusters().size();
+}
+
+static void CustomArguments(benchmark::internal::Benchmark* bench)
+{
+  for (int deId : {100, 500, 819}) {
+    for (int nHits : {1, 2, 4}) {
+      bench->Args({deId, nHits});
+    }
+  }
+}
+
+BENCHMARK(BM_ClusterFinderOriginal)->Apply(CustomArguments)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
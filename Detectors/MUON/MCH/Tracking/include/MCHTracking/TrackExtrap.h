@@ -17,12 +17,18 @@
 #ifndef O2_MCH_TRACKEXTRAP_H_
 #define O2_MCH_TRACKEXTRAP_H_
 
+#include <atomic>
 #include <cstddef>
 
 #include <TMatrixD.h>
 
 namespace o2
 {
+namespace field
+{
+class MagneticField;
+}
+
 namespace mch
 {
 
@@ -116,6 +122,7 @@ class TrackExtrap
   static bool extrapToZRungekutta(TrackParam& trackParam, double zEnd);
   static bool extrapToZRungekuttaV2(TrackParam& trackParam, double zEnd);
   static bool extrapOneStepRungekutta(double charge, double step, const double* vect, double* vout);
+  static void getField(const double* xyz, double* b);
 
   static constexpr double SMuMass = 0.105658;                         ///< Muon mass (GeV/c2)
   static constexpr double SAbsZBeg = -90.;                            ///< Position of the begining of the absorber (cm)
@@ -140,8 +147,10 @@ class TrackExtrap
   static double sSimpleBValue; ///< Magnetic field value at the centre
   static bool sFieldON;        ///< true if the field is switched ON
 
-  static std::size_t sNCallExtrapToZCov; ///< number of times the method extrapToZCov(...) is called
-  static std::size_t sNCallField;        ///< number of times the method Field(...) is called
+  static const o2::field::MagneticField* sO2Field; ///< O2 field, evaluated without lock by the tracking threads, if it is the global one
+
+  static std::atomic<std::size_t> sNCallExtrapToZCov; ///< number of times the method extrapToZCov(...) is called
+  static std::atomic<std::size_t> sNCallField;        ///< number of times the method Field(...) is called
 };
 
 } // namespace mch
@@ -22,6 +22,7 @@
 #include <unordered_set>
 #include <list>
 #include <array>
+#include <memory>
 #include <vector>
 #include <utility>
 
@@ -70,6 +71,8 @@ class TrackFinder
   void findTrackCandidatesInSt5();
   void findTrackCandidatesInSt4();
   void findMoreTrackCandidates();
+  void followTracks();
+  std::size_t followTrack(const Track& candidate, std::size_t nNextCandidates, std::list<Track>& newTracks);
   std::list<Track>::iterator findTrackCandidates(int plane1, int plane2, bool skipUsedPairs, const std::list<Track>::iterator& itFirstTrack);
 
   std::list<Track>::iterator followTrackInOverlapDE(const std::list<Track>::iterator& itTrack, int currentDE, int plane);
@@ -141,7 +144,11 @@ class TrackFinder
   /// array of pointers to the lists of clusters per DE
   std::array<std::vector<std::pair<const int, const std::list<const Cluster*>*>>, 32> mClusters{};
 
-  std::list<Track> mTracks{}; ///< list of reconstructed tracks
+  std::list<Track> mTracks{};       ///< list of reconstructed tracks
+  std::size_t mNExternalTracks = 0; ///< number of tracks held outside of mTracks (when used as follower)
+  std::size_t mMaxNTracks = 0;      ///< largest number of tracks in mTracks when adding a new one (when used as follower)
+
+  std::vector<std::unique_ptr<TrackFinder>> mFollowers{}; ///< track finders used to follow the candidates in parallel
 
   std::chrono::time_point<std::chrono::steady_clock> mStartTime{}; ///< time when the tracking start
 
@@ -19,6 +19,7 @@
 
 #include <memory> // for std::unique_ptr
 #include <TMatrixD.h>
+#include <Math/SMatrix.h>
 
 #include "MCHBase/TrackBlock.h"
 
@@ -33,6 +34,9 @@ struct Cluster;
 class TrackParam
 {
  public:
+  using SMatrix55 = ROOT::Math::SMatrix<double, 5>; ///< fixed-size 5x5 matrix used in the extrapolation/fitting
+  using SVector5 = ROOT::Math::SVector<double, 5>;  ///< fixed-size 5 components vector used in the extrapolation/fitting
+
   TrackParam() = default;
   TrackParam(Double_t z, const Double_t param[5]);
   TrackParam(Double_t z, const Double_t param[5], const Double_t cov[15]);
@@ -85,6 +89,10 @@ class TrackParam
   void setParameters(const Double_t parameters[5]) { mParameters.SetMatrixArray(parameters); }
   /// add track parameters
   void addParameters(const TMatrixD& parameters) { mParameters += parameters; }
+  /// return track parameters as a fixed-size vector
+  SVector5 getParametersVector() const { return SVector5(mParameters.GetMatrixArray(), 5); }
+  /// set track parameters from a fixed-size vector
+  void setParameters(const SVector5& parameters) { mParameters.SetMatrixArray(parameters.Array()); }
 
   Double_t px() const; // return px
   Double_t py() const; // return py
@@ -97,12 +105,16 @@ class TrackParam
   const TMatrixD& getCovariances() const;
   void setCovariances(const TMatrixD& covariances);
   void setCovariances(const Double_t covariances[15]);
+  void setCovariances(const SMatrix55& covariances);
+  /// return the covariance matrix as a fixed-size matrix (create it before if needed)
+  SMatrix55 getCovariancesMatrix() const { return SMatrix55(getCovariances().GetMatrixArray(), 25); }
   void setVariances(const Double_t covariances[15]);
   void deleteCovariances();
 
   const TMatrixD& getPropagator() const;
   void resetPropagator();
   void updatePropagator(const TMatrixD& propagator);
+  void updatePropagator(const SMatrix55& propagator);
 
   const TMatrixD& getExtrapParameters() const;
   void setExtrapParameters(const TMatrixD& parameters);
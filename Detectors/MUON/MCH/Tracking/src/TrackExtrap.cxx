@@ -23,6 +23,7 @@
 #include <TGeoShape.h>
 #include <TMath.h>
 
+#include "Field/MagneticField.h"
 #include "Framework/Logger.h"
 
 #include "MCHTracking/TrackParam.h"
@@ -35,8 +36,9 @@ namespace mch
 bool TrackExtrap::sExtrapV2 = false;
 double TrackExtrap::sSimpleBValue = 0.;
 bool TrackExtrap::sFieldON = false;
-std::size_t TrackExtrap::sNCallExtrapToZCov = 0;
-std::size_t TrackExtrap::sNCallField = 0;
+const o2::field::MagneticField* TrackExtrap::sO2Field = nullptr;
+std::atomic<std::size_t> TrackExtrap::sNCallExtrapToZCov{0};
+std::atomic<std::size_t> TrackExtrap::sNCallField{0};
 
 //__________________________________________________________________________
 void TrackExtrap::setField()
@@ -46,6 +48,7 @@ void TrackExtrap::setField()
   const double x[3] = {50., 50., SSimpleBPosition};
   double b[3] = {0., 0., 0.};
   TGeoGlobalMagField::Instance()->Field(x, b);
+  sO2Field = dynamic_cast<const o2::field::MagneticField*>(TGeoGlobalMagField::Instance()->GetField());
   sSimpleBValue = b[0];
   sFieldON = (TMath::Abs(sSimpleBValue) > 1.e-10) ? true : false;
   LOG(info) << "Track extrapolation with magnetic field " << (sFieldON ? "ON" : "OFF");
@@ -125,15 +128,13 @@ void TrackExtrap::linearExtrapToZCov(TrackParam& trackParam, double zEnd, bool u
   trackParam.setZ(zEnd);
 
   // Calculate the jacobian related to the track parameters linear extrapolation to "zEnd"
-  TMatrixD jacob(5, 5);
-  jacob.UnitMatrix();
+  TrackParam::SMatrix55 jacob = ROOT::Math::SMatrixIdentity();
   jacob(0, 1) = dZ;
   jacob(2, 3) = dZ;
 
   // Extrapolate track parameter covariances to "zEnd"
-  TMatrixD tmp(trackParam.getCovariances(), TMatrixD::kMultTranspose, jacob);
-  TMatrixD tmp2(jacob, TMatrixD::kMult, tmp);
-  trackParam.setCovariances(tmp2);
+  TrackParam::SMatrix55 tmp = trackParam.getCovariancesMatrix() * ROOT::Math::Transpose(jacob);
+  trackParam.setCovariances(TrackParam::SMatrix55(jacob * tmp));
 
   // Update the propagator if required
   if (updatePropagator) {
@@ -181,12 +182,13 @@ bool TrackExtrap::extrapToZCov(TrackParam& trackParam, double zEnd, bool updateP
   }
 
   // Save the actual track parameters
-  TrackParam trackParamSave(trackParam);
-  TMatrixD paramSave(trackParamSave.getParameters());
-  double zBegin = trackParamSave.getZ();
+  // (only the parameters and the z position are needed to compute the jacobian)
+  double zBegin = trackParam.getZ();
+  TrackParam::SVector5 paramSave = trackParam.getParametersVector();
+  TrackParam trackParamSave(zBegin, paramSave.Array());
 
-  // Get reference to the parameter covariance matrix
-  const TMatrixD& kParamCov = trackParam.getCovariances();
+  // Get the parameter covariance matrix
+  TrackParam::SMatrix55 paramCov = trackParam.getCovariancesMatrix();
 
   // Extrapolate track parameters to "zEnd"
   // Do not update the covariance matrix if the extrapolation failed
@@ -194,33 +196,31 @@ bool TrackExtrap::extrapToZCov(TrackParam& trackParam, double zEnd, bool updateP
     return false;
   }
 
-  // Get reference to the extrapolated parameters
-  const TMatrixD& extrapParam = trackParam.getParameters();
+  // Get the extrapolated parameters
+  TrackParam::SVector5 extrapParam = trackParam.getParametersVector();
 
   // Calculate the jacobian related to the track parameters extrapolation to "zEnd"
-  TMatrixD jacob(5, 5);
-  jacob.Zero();
-  TMatrixD dParam(5, 1);
+  TrackParam::SMatrix55 jacob{};
+  TrackParam::SVector5 dParam{};
   double direction[5] = {-1., -1., 1., 1., -1.};
   for (int i = 0; i < 5; i++) {
     // Skip jacobian calculation for parameters with no associated error
-    if (kParamCov(i, i) <= 0.) {
+    if (paramCov(i, i) <= 0.) {
       continue;
     }
 
     // Small variation of parameter i only
     for (int j = 0; j < 5; j++) {
       if (j == i) {
-        dParam(j, 0) = TMath::Sqrt(kParamCov(i, i));
-        dParam(j, 0) *= TMath::Sign(1., direction[j] * paramSave(j, 0)); // variation always in the same direction
+        dParam(j) = TMath::Sqrt(paramCov(i, i));
+        dParam(j) *= TMath::Sign(1., direction[j] * paramSave(j)); // variation always in the same direction
       } else {
-        dParam(j, 0) = 0.;
+        dParam(j) = 0.;
       }
     }
 
     // Set new parameters
-    trackParamSave.setParameters(paramSave);
-    trackParamSave.addParameters(dParam);
+    trackParamSave.setParameters(TrackParam::SVector5(paramSave + dParam));
     trackParamSave.setZ(zBegin);
 
     // Extrapolate new track parameters to "zEnd"
@@ -230,15 +230,14 @@ bool TrackExtrap::extrapToZCov(TrackParam& trackParam, double zEnd, bool updateP
     }
 
     // Calculate the jacobian
-    TMatrixD jacobji(trackParamSave.getParameters(), TMatrixD::kMinus, extrapParam);
-    jacobji *= 1. / dParam(i, 0);
-    jacob.SetSub(0, i, jacobji);
+    TrackParam::SVector5 jacobji = trackParamSave.getParametersVector() - extrapParam;
+    jacobji *= 1. / dParam(i);
+    jacob.Place_in_col(jacobji, 0, i);
   }
 
   // Extrapolate track parameter covariances to "zEnd"
-  TMatrixD tmp(kParamCov, TMatrixD::kMultTranspose, jacob);
-  TMatrixD tmp2(jacob, TMatrixD::kMult, tmp);
-  trackParam.setCovariances(tmp2);
+  TrackParam::SMatrix55 tmp = paramCov * ROOT::Math::Transpose(jacob);
+  trackParam.setCovariances(TrackParam::SMatrix55(jacob * tmp));
 
   // Update the propagator if required
   if (updatePropagator) {
@@ -1066,8 +1065,7 @@ bool TrackExtrap::extrapOneStepRungekutta(double charge, double step, const doub
       h = rest;
     }
     // cmodif: call gufld(vout,f) changed into:
-    TGeoGlobalMagField::Instance()->Field(vout, f);
-    ++sNCallField;
+    getField(vout, f);
 
     // *
     // *             start of integration
@@ -1115,8 +1113,7 @@ bool TrackExtrap::extrapOneStepRungekutta(double charge, double step, const doub
     xyzt[2] = zt;
 
     // cmodif: call gufld(xyzt,f) changed into:
-    TGeoGlobalMagField::Instance()->Field(xyzt, f);
-    ++sNCallField;
+    getField(xyzt, f);
 
     at = a + secxs[0];
     bt = b + secys[0];
@@ -1155,8 +1152,7 @@ bool TrackExtrap::extrapOneStepRungekutta(double charge, double step, const doub
     xyzt[2] = zt;
 
     // cmodif: call gufld(xyzt,f) changed into:
-    TGeoGlobalMagField::Instance()->Field(xyzt, f);
-    ++sNCallField;
+    getField(xyzt, f);
 
     z = z + (c + (seczs[0] + seczs[1] + seczs[2]) * kthird) * h;
     y = y + (b + (secys[0] + secys[1] + secys[2]) * kthird) * h;
@@ -1255,6 +1251,22 @@ bool TrackExtrap::extrapOneStepRungekutta(double charge, double step, const doub
   return true;
 }
 
+//__________________________________________________________________________
+void TrackExtrap::getField(const double* xyz, double* b)
+{
+  /// Get the magnetic field at the given position and count the number of calls
+  /// The O2 field is evaluated with a scratch per thread, so that the tracking threads do not wait for each other.
+  /// Other field implementations may use internal buffers, hence their calls are serialized
+  if (sO2Field) {
+    static thread_local o2::field::MagneticField::FieldScratch scratch;
+    sO2Field->Field(xyz, b, scratch);
+  } else {
+#pragma omp critical(mch_trackextrap_field)
+    TGeoGlobalMagField::Instance()->Field(xyz, b);
+  }
+  ++sNCallField;
+}
+
 //__________________________________________________________________________
 void TrackExtrap::printNCalls()
 {
@@ -16,15 +16,25 @@
 
 #include "MCHTracking/TrackFinder.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <exception>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 
 #include <TGeoGlobalMagField.h>
 #include <TMatrixD.h>
 #include <TMath.h>
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#else
+static inline int omp_get_thread_num() { return 0; }
+#endif
+
 #include "Field/MagneticField.h"
 #include "MCHBase/Error.h"
 #include "MCHBase/TrackerParam.h"
@@ -198,12 +208,7 @@ const std::list<Track>& TrackFinder::findTracks(const std::unordered_map<int, st
 
     // track each candidate down to chamber 1 and remove it
     tStart = std::chrono::high_resolution_clock::now();
-    for (auto itTrack = mTracks.begin(); itTrack != mTracks.end();) {
-      std::unordered_map<int, std::unordered_set<uint32_t>> excludedClusters{};
-      followTrackInChamber(itTrack, 5, 0, false, excludedClusters);
-      print("findTracks: removing candidate at position #", getTrackIndex(itTrack));
-      itTrack = mTracks.erase(itTrack);
-    }
+    followTracks();
     tEnd = std::chrono::high_resolution_clock::now();
     mTimeFollowTracks += tEnd - tStart;
     print("------ list of tracks before improvement and cleaning ------");
@@ -641,6 +646,124 @@ void TrackFinder::findMoreTrackCandidates()
   }
 }
 
+//_________________________________________________________________________________________________
+void TrackFinder::followTracks()
+{
+  /// Track each candidate down to chamber 1 and replace it by the new tracks found, if any
+  /// The candidates are independent from each other and can be followed in parallel, each thread
+  /// using its own follower (i.e. a track finder with its own fitter and list of tracks)
+  /// The new tracks are then merged in the order of the candidates, as in the sequential case,
+  /// and the limit on the number of candidates is checked as it would have been sequentially,
+  /// such that the result does not depend on the number of threads
+  /// Throw an exception in case of failure
+
+  int nThreads = (mDebugLevel > 0) ? 1 : TrackerParam::Instance().nThreads;
+  if (nThreads < 2 || mTracks.size() < 2) {
+    for (auto itTrack = mTracks.begin(); itTrack != mTracks.end();) {
+      std::unordered_map<int, std::unordered_set<uint32_t>> excludedClusters{};
+      followTrackInChamber(itTrack, 5, 0, false, excludedClusters);
+      print("findTracks: removing candidate at position #", getTrackIndex(itTrack));
+      itTrack = mTracks.erase(itTrack);
+    }
+    return;
+  }
+
+  // prepare the followers, sharing the clusters and the tracking conditions of this track finder
+  while (mFollowers.size() < static_cast<std::size_t>(nThreads)) {
+    mFollowers.emplace_back(std::make_unique<TrackFinder>())->init();
+  }
+  for (auto& follower : mFollowers) {
+    for (std::size_t iPlane = 0; iPlane < mClusters.size(); ++iPlane) {
+      for (std::size_t iDE = 0; iDE < mClusters[iPlane].size(); ++iDE) {
+        follower->mClusters[iPlane][iDE].second = mClusters[iPlane][iDE].second;
+      }
+    }
+    follower->mTrackFitter.useChamberResolution();
+    follower->mStartTime = mStartTime;
+  }
+
+  // follow the candidates, skipping those after a candidate whose following failed
+  std::vector<const Track*> candidates{};
+  candidates.reserve(mTracks.size());
+  for (const auto& track : mTracks) {
+    candidates.push_back(&track);
+  }
+  int nCandidates = candidates.size();
+  std::vector<std::list<Track>> newTracks(nCandidates);
+  std::vector<std::size_t> maxNTracks(nCandidates, 0);
+  std::vector<std::exception_ptr> errors(nCandidates);
+  std::vector<ErrorMap> errorMaps(nCandidates);
+  std::atomic<int> firstFailure(nCandidates);
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads)
+  for (int iCandidate = 0; iCandidate < nCandidates; ++iCandidate) {
+    if (iCandidate > firstFailure) {
+      continue;
+    }
+    auto& follower = mFollowers[omp_get_thread_num()];
+    try {
+      maxNTracks[iCandidate] = follower->followTrack(*candidates[iCandidate], nCandidates - iCandidate - 1, newTracks[iCandidate]);
+    } catch (...) {
+      maxNTracks[iCandidate] = follower->mMaxNTracks;
+      errors[iCandidate] = std::current_exception();
+      errorMaps[iCandidate].add(follower->mErrorMap);
+      follower->mErrorMap.clear();
+      int first = firstFailure;
+      while (iCandidate < first && !firstFailure.compare_exchange_weak(first, iCandidate)) {
+      }
+    }
+  }
+
+  // collect the counters of the followers
+  for (auto& follower : mFollowers) {
+    mNCallTryOneCluster += follower->mNCallTryOneCluster;
+    follower->mNCallTryOneCluster = 0;
+    mNCallTryOneClusterFast += follower->mNCallTryOneClusterFast;
+    follower->mNCallTryOneClusterFast = 0;
+  }
+
+  // check the number of tracks each time one is added, as in the sequential case where the list holds the new tracks of the
+  // previous candidates, the candidates still to be followed and the tracks being created from the current one.
+  // A follower aborts only if this number is reached, so the first failure is the last candidate to check
+  std::size_t nNewTracks = 0;
+  for (int iCandidate = 0; iCandidate < nCandidates; ++iCandidate) {
+    if (maxNTracks[iCandidate] > 0 &&
+        nNewTracks + nCandidates - iCandidate - 1 + maxNTracks[iCandidate] >= TrackerParam::Instance().maxCandidates) {
+      mErrorMap.add(ErrorType::Tracking_TooManyCandidates, 0, 0);
+      throw length_error(string("Too many track candidates (") + std::to_string(TrackerParam::Instance().maxCandidates) + ")");
+    }
+    if (errors[iCandidate]) {
+      mErrorMap.add(errorMaps[iCandidate]);
+      std::rethrow_exception(errors[iCandidate]);
+    }
+    nNewTracks += newTracks[iCandidate].size();
+  }
+
+  // replace the candidates by the new tracks, in the same order as they would have been found sequentially
+  mTracks.clear();
+  for (auto& tracks : newTracks) {
+    mTracks.splice(mTracks.end(), tracks);
+  }
+}
+
+//_________________________________________________________________________________________________
+std::size_t TrackFinder::followTrack(const Track& candidate, std::size_t nNextCandidates, std::list<Track>& newTracks)
+{
+  /// Track the candidate down to chamber 1 and move the new tracks found, if any, at the end of "newTracks"
+  /// The "nNextCandidates" candidates still to be followed after this one count in the maximum number of tracks
+  /// Return the largest number of tracks, including the candidate, held when adding a new one
+  /// Throw an exception in case of failure
+
+  mTracks.clear();
+  mNExternalTracks = nNextCandidates;
+  mMaxNTracks = 0;
+  auto itTrack = mTracks.emplace(mTracks.end(), candidate);
+  std::unordered_map<int, std::unordered_set<uint32_t>> excludedClusters{};
+  followTrackInChamber(itTrack, 5, 0, false, excludedClusters);
+  mTracks.erase(itTrack);
+  newTracks.splice(newTracks.end(), mTracks);
+  return mMaxNTracks;
+}
+
 //_________________________________________________________________________________________________
 std::list<Track>::iterator TrackFinder::findTrackCandidates(int plane1, int plane2, bool skipUsedPairs, const std::list<Track>::iterator& itFirstTrack)
 {
@@ -1353,7 +1476,8 @@ void TrackFinder::createTrack(const Cluster& cl1, const Cluster& cl2)
   /// Compute the track parameters and covariance matrices at the 2 clusters
   /// Throw an exception if the maximum number of tracks is exceeded
 
-  if (mTracks.size() >= TrackerParam::Instance().maxCandidates) {
+  mMaxNTracks = std::max(mMaxNTracks, mTracks.size());
+  if (mTracks.size() + mNExternalTracks >= TrackerParam::Instance().maxCandidates) {
     mErrorMap.add(ErrorType::Tracking_TooManyCandidates, 0, 0);
     throw length_error(string("Too many track candidates (") + mTracks.size() + ")");
   }
@@ -1379,7 +1503,8 @@ std::list<Track>::iterator TrackFinder::addTrack(const std::list<Track>::iterato
 {
   /// Add the given track at the requested position in the list of tracks
   /// Throw an exception if the maximum number of tracks is exceeded
-  if (mTracks.size() >= TrackerParam::Instance().maxCandidates) {
+  mMaxNTracks = std::max(mMaxNTracks, mTracks.size());
+  if (mTracks.size() + mNExternalTracks >= TrackerParam::Instance().maxCandidates) {
     mErrorMap.add(ErrorType::Tracking_TooManyCandidates, 0, 0);
     throw length_error(string("Too many track candidates (") + mTracks.size() + ")");
   }
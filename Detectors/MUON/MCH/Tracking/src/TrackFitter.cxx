@@ -20,6 +20,7 @@
 
 #include <TGeoGlobalMagField.h>
 #include <TMatrixD.h>
+#include <Math/SMatrix.h>
 
 #include "Field/MagneticField.h"
 #include "MCHTracking/TrackExtrap.h"
@@ -264,26 +265,26 @@ void TrackFitter::runKalmanFilter(TrackParam& trackParam)
   /// Throw an exception in case of failure
 
   // get actual track parameters (p)
-  TMatrixD param(trackParam.getParameters());
+  TrackParam::SVector5 param = trackParam.getParametersVector();
 
   // get new cluster parameters (m)
   const Cluster* cluster = trackParam.getClusterPtr();
-  TMatrixD clusterParam(5, 1);
-  clusterParam.Zero();
-  clusterParam(0, 0) = cluster->getX();
-  clusterParam(2, 0) = cluster->getY();
+  TrackParam::SVector5 clusterParam{};
+  clusterParam(0) = cluster->getX();
+  clusterParam(2) = cluster->getY();
 
   // compute the actual parameter weight (W)
-  TMatrixD paramWeight(trackParam.getCovariances());
-  if (paramWeight.Determinant() != 0) {
-    paramWeight.Invert();
+  // (matrices are inverted with TMatrixD to keep the same numerical algorithm)
+  TMatrixD paramWeightInv(trackParam.getCovariances());
+  if (paramWeightInv.Determinant() != 0) {
+    paramWeightInv.Invert();
   } else {
     throw runtime_error("Determinant = 0");
   }
+  TrackParam::SMatrix55 paramWeight(paramWeightInv.GetMatrixArray(), 25);
 
   // compute the new cluster weight (U)
-  TMatrixD clusterWeight(5, 5);
-  clusterWeight.Zero();
+  TrackParam::SMatrix55 clusterWeight{};
   if (mUseChamberResolution) {
     clusterWeight(0, 0) = 1. / mChamberResolutionX2;
     clusterWeight(2, 2) = 1. / mChamberResolutionY2;
@@ -293,31 +294,31 @@ void TrackFitter::runKalmanFilter(TrackParam& trackParam)
   }
 
   // compute the new parameters covariance matrix ((W+U)^-1)
-  TMatrixD newParamCov(paramWeight, TMatrixD::kPlus, clusterWeight);
-  if (newParamCov.Determinant() != 0) {
-    newParamCov.Invert();
+  TrackParam::SMatrix55 weightSum = paramWeight + clusterWeight;
+  TMatrixD newParamCovInv(5, 5, weightSum.Array());
+  if (newParamCovInv.Determinant() != 0) {
+    newParamCovInv.Invert();
   } else {
     throw runtime_error("Determinant = 0");
   }
+  TrackParam::SMatrix55 newParamCov(newParamCovInv.GetMatrixArray(), 25);
   trackParam.setCovariances(newParamCov);
 
   // compute the new parameters (p' = ((W+U)^-1)U(m-p) + p)
-  TMatrixD tmp(clusterParam, TMatrixD::kMinus, param);   // m-p
-  TMatrixD tmp2(clusterWeight, TMatrixD::kMult, tmp);    // U(m-p)
-  TMatrixD newParam(newParamCov, TMatrixD::kMult, tmp2); // ((W+U)^-1)U(m-p)
-  newParam += param;                                     // ((W+U)^-1)U(m-p) + p
+  TrackParam::SVector5 tmp = clusterParam - param;    // m-p
+  TrackParam::SVector5 tmp2 = clusterWeight * tmp;    // U(m-p)
+  TrackParam::SVector5 newParam = newParamCov * tmp2; // ((W+U)^-1)U(m-p)
+  newParam += param;                                  // ((W+U)^-1)U(m-p) + p
   trackParam.setParameters(newParam);
 
   // compute the additional chi2 (= ((p'-p)^-1)W(p'-p) + ((p'-m)^-1)U(p'-m))
-  tmp = newParam;                                                // p'
-  tmp -= param;                                                  // (p'-p)
-  TMatrixD tmp3(paramWeight, TMatrixD::kMult, tmp);              // W(p'-p)
-  TMatrixD addChi2Track(tmp, TMatrixD::kTransposeMult, tmp3);    // ((p'-p)^-1)W(p'-p)
-  tmp = newParam;                                                // p'
-  tmp -= clusterParam;                                           // (p'-m)
-  TMatrixD tmp4(clusterWeight, TMatrixD::kMult, tmp);            // U(p'-m)
-  addChi2Track += TMatrixD(tmp, TMatrixD::kTransposeMult, tmp4); // ((p'-p)^-1)W(p'-p) + ((p'-m)^-1)U(p'-m)
-  trackParam.setTrackChi2(trackParam.getTrackChi2() + addChi2Track(0, 0));
+  tmp = newParam - param;                           // (p'-p)
+  TrackParam::SVector5 tmp3 = paramWeight * tmp;    // W(p'-p)
+  double addChi2Track = ROOT::Math::Dot(tmp, tmp3); // ((p'-p)^-1)W(p'-p)
+  tmp = newParam - clusterParam;                    // (p'-m)
+  TrackParam::SVector5 tmp4 = clusterWeight * tmp;  // U(p'-m)
+  addChi2Track += ROOT::Math::Dot(tmp, tmp4);       // ((p'-p)^-1)W(p'-p) + ((p'-m)^-1)U(p'-m)
+  trackParam.setTrackChi2(trackParam.getTrackChi2() + addChi2Track);
 }
 
 //_________________________________________________________________________________________________
@@ -327,36 +328,38 @@ void TrackFitter::runSmoother(const TrackParam& previousParam, TrackParam& param
   /// Throw an exception in case of failure
 
   // get variables
-  const TMatrixD& extrapParameters = previousParam.getExtrapParameters();           // X(k+1 k)
-  const TMatrixD& filteredParameters = param.getParameters();                       // X(k k)
-  const TMatrixD& previousSmoothParameters = previousParam.getSmoothParameters();   // X(k+1 n)
-  const TMatrixD& propagator = previousParam.getPropagator();                       // F(k)
-  const TMatrixD& extrapCovariances = previousParam.getExtrapCovariances();         // C(k+1 k)
-  const TMatrixD& filteredCovariances = param.getCovariances();                     // C(k k)
-  const TMatrixD& previousSmoothCovariances = previousParam.getSmoothCovariances(); // C(k+1 n)
+  TrackParam::SVector5 extrapParameters(previousParam.getExtrapParameters().GetMatrixArray(), 5);             // X(k+1 k)
+  TrackParam::SVector5 filteredParameters = param.getParametersVector();                                      // X(k k)
+  TrackParam::SVector5 previousSmoothParameters(previousParam.getSmoothParameters().GetMatrixArray(), 5);     // X(k+1 n)
+  TrackParam::SMatrix55 propagator(previousParam.getPropagator().GetMatrixArray(), 25);                       // F(k)
+  const TMatrixD& extrapCovariances = previousParam.getExtrapCovariances();                                   // C(k+1 k)
+  TrackParam::SMatrix55 filteredCovariances = param.getCovariancesMatrix();                                   // C(k k)
+  TrackParam::SMatrix55 previousSmoothCovariances(previousParam.getSmoothCovariances().GetMatrixArray(), 25); // C(k+1 n)
 
   // compute smoother gain: A(k) = C(kk) * F(k)^t * (C(k+1 k))^-1
-  TMatrixD extrapWeight(extrapCovariances);
-  if (extrapWeight.Determinant() != 0) {
-    extrapWeight.Invert(); // (C(k+1 k))^-1
+  // (the matrix is inverted with TMatrixD to keep the same numerical algorithm)
+  TMatrixD extrapWeightInv(extrapCovariances);
+  if (extrapWeightInv.Determinant() != 0) {
+    extrapWeightInv.Invert(); // (C(k+1 k))^-1
   } else {
     throw runtime_error("Determinant = 0");
   }
-  TMatrixD smootherGain(filteredCovariances, TMatrixD::kMultTranspose, propagator); // C(kk) * F(k)^t
-  smootherGain *= extrapWeight;                                                     // C(kk) * F(k)^t * (C(k+1 k))^-1
+  TrackParam::SMatrix55 extrapWeight(extrapWeightInv.GetMatrixArray(), 25);
+  TrackParam::SMatrix55 smootherGain = filteredCovariances * ROOT::Math::Transpose(propagator); // C(kk) * F(k)^t
+  smootherGain *= extrapWeight;                                                                 // C(kk) * F(k)^t * (C(k+1 k))^-1
 
   // compute smoothed parameters: X(k n) = X(k k) + A(k) * (X(k+1 n) - X(k+1 k))
-  TMatrixD tmpParam(previousSmoothParameters, TMatrixD::kMinus, extrapParameters); // X(k+1 n) - X(k+1 k)
-  TMatrixD smoothParameters(smootherGain, TMatrixD::kMult, tmpParam);              // A(k) * (X(k+1 n) - X(k+1 k))
-  smoothParameters += filteredParameters;                                          // X(k k) + A(k) * (X(k+1 n) - X(k+1 k))
-  param.setSmoothParameters(smoothParameters);
+  TrackParam::SVector5 tmpParam = previousSmoothParameters - extrapParameters; // X(k+1 n) - X(k+1 k)
+  TrackParam::SVector5 smoothParameters = smootherGain * tmpParam;             // A(k) * (X(k+1 n) - X(k+1 k))
+  smoothParameters += filteredParameters;                                      // X(k k) + A(k) * (X(k+1 n) - X(k+1 k))
+  param.setSmoothParameters(TMatrixD(5, 1, smoothParameters.Array()));
 
   // compute smoothed covariances: C(k n) = C(k k) + A(k) * (C(k+1 n) - C(k+1 k)) * (A(k))^t
-  TMatrixD tmpCov(previousSmoothCovariances, TMatrixD::kMinus, extrapCovariances); // C(k+1 n) - C(k+1 k)
-  TMatrixD tmpCov2(tmpCov, TMatrixD::kMultTranspose, smootherGain);                // (C(k+1 n) - C(k+1 k)) * (A(k))^t
-  TMatrixD smoothCovariances(smootherGain, TMatrixD::kMult, tmpCov2);              // A(k) * (C(k+1 n) - C(k+1 k)) * (A(k))^t
-  smoothCovariances += filteredCovariances;                                        // C(k k) + A(k) * (C(k+1 n) - C(k+1 k)) * (A(k))^t
-  param.setSmoothCovariances(smoothCovariances);
+  TrackParam::SMatrix55 tmpCov = previousSmoothCovariances - TrackParam::SMatrix55(extrapCovariances.GetMatrixArray(), 25); // C(k+1 n) - C(k+1 k)
+  TrackParam::SMatrix55 tmpCov2 = tmpCov * ROOT::Math::Transpose(smootherGain);                                             // (C(k+1 n) - C(k+1 k)) * (A(k))^t
+  TrackParam::SMatrix55 smoothCovariances = smootherGain * tmpCov2;                                                         // A(k) * (C(k+1 n) - C(k+1 k)) * (A(k))^t
+  smoothCovariances += filteredCovariances;                                                                                 // C(k k) + A(k) * (C(k+1 n) - C(k+1 k)) * (A(k))^t
+  param.setSmoothCovariances(TMatrixD(5, 5, smoothCovariances.Array()));
 
   // skip the local chi2 calculation if requested to do so
   if (skipLocalChi2Calculation) {
@@ -368,8 +371,8 @@ void TrackFitter::runSmoother(const TrackParam& previousParam, TrackParam& param
   const Cluster* cluster = param.getClusterPtr();
   TMatrixD smoothResidual(2, 1);
   smoothResidual.Zero();
-  smoothResidual(0, 0) = cluster->getX() - smoothParameters(0, 0);
-  smoothResidual(1, 0) = cluster->getY() - smoothParameters(2, 0);
+  smoothResidual(0, 0) = cluster->getX() - smoothParameters(0);
+  smoothResidual(1, 0) = cluster->getY() - smoothParameters(2);
 
   // compute weight of smoothed residual: W(k n) = (clusterCov - C(k n))^-1
   TMatrixD smoothResidualWeight(2, 2);
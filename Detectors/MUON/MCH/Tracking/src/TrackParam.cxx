@@ -265,6 +265,16 @@ void TrackParam::setCovariances(const Double_t covariances[15])
   }
 }
 
+//__________________________________________________________________________
+void TrackParam::setCovariances(const SMatrix55& covariances)
+{
+  /// Set the covariance matrix from a fixed-size matrix (both are stored row-wise)
+  if (!mCovariances) {
+    mCovariances = std::make_unique<TMatrixD>(5, 5);
+  }
+  mCovariances->SetMatrixArray(covariances.Array());
+}
+
 //__________________________________________________________________________
 void TrackParam::setVariances(const Double_t covariances[15])
 {
@@ -322,6 +332,18 @@ void TrackParam::updatePropagator(const TMatrixD& propagator)
   }
 }
 
+//__________________________________________________________________________
+void TrackParam::updatePropagator(const SMatrix55& propagator)
+{
+  /// Update the propagator from a fixed-size matrix
+  if (mPropagator) {
+    SMatrix55 newPropagator = propagator * SMatrix55(mPropagator->GetMatrixArray(), 25);
+    mPropagator->SetMatrixArray(newPropagator.Array());
+  } else {
+    mPropagator = std::make_unique<TMatrixD>(5, 5, propagator.Array());
+  }
+}
+
 //__________________________________________________________________________
 const TMatrixD& TrackParam::getExtrapParameters() const
 {
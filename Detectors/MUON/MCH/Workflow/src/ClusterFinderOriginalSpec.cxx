@@ -16,8 +16,10 @@
 
 #include "MCHWorkflow/ClusterFinderOriginalSpec.h"
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <memory>
 #include <chrono>
 #include <vector>
 #include <stdexcept>
@@ -43,6 +45,12 @@
 #include "DataFormatsMCH/Cluster.h"
 #include "MCHClustering/ClusterFinderOriginal.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#else
+static inline int omp_get_thread_num() { return 0; }
+#endif
+
 namespace o2
 {
 namespace mch
@@ -65,7 +73,21 @@ class ClusterFinderOriginalTask
       o2::conf::ConfigurableParam::updateFromFile(config, "MCHClustering", true);
     }
     bool run2Config = ic.options().get<bool>("run2-config");
-    mClusterFinder.init(run2Config);
+
+    // one clusterizer per thread, the preclusters being independent
+#ifdef WITH_OPENMP
+    mNThreads = std::max(1, ic.options().get<int>("nthreads"));
+#else
+    if (ic.options().get<int>("nthreads") > 1) {
+      LOG(warning) << "compiled without OpenMP: the clustering will run in a single thread";
+    }
+#endif
+    LOG(info) << "using " << mNThreads << " thread(s) for clustering";
+    mClusterFinders.resize(mNThreads);
+    for (auto& clusterFinder : mClusterFinders) {
+      clusterFinder = std::make_unique<ClusterFinderOriginal>();
+      clusterFinder->init(run2Config);
+    }
 
     mAttachInitalPrecluster = ic.options().get<bool>("attach-initial-precluster");
 
@@ -75,7 +97,9 @@ class ClusterFinderOriginalTask
       mErrorMap.forEach([](Error error) {
         LOGP(warning, fmt::runtime(error.asString()));
       });
-      this->mClusterFinder.deinit();
+      for (auto& clusterFinder : this->mClusterFinders) {
+        clusterFinder->deinit();
+      }
     });
   }
 
@@ -95,34 +119,41 @@ class ClusterFinderOriginalTask
     auto& usedDigits = pc.outputs().make<std::vector<Digit>>(OutputRef{"clusterdigits"});
 
     clusterROFs.reserve(preClusterROFs.size());
-    auto& errorMap = mClusterFinder.getErrorMap();
-    errorMap.clear();
+    for (auto& clusterFinder : mClusterFinders) {
+      clusterFinder->getErrorMap().clear();
+    }
     for (const auto& preClusterROF : preClusterROFs) {
 
       // prepare to clusterize the current ROF
       auto clusterOffset = clusters.size();
-      mClusterFinder.reset();
-
-      for (const auto& preCluster : preClusters.subspan(preClusterROF.getFirstIdx(), preClusterROF.getNEntries())) {
-
-        auto preclusterDigits = digits.subspan(preCluster.firstDigit, preCluster.nDigits);
-        auto firstClusterIdx = mClusterFinder.getClusters().size();
-
-        // clusterize the current precluster
-        auto tStart = std::chrono::high_resolution_clock::now();
-        mClusterFinder.findClusters(preclusterDigits);
-        auto tEnd = std::chrono::high_resolution_clock::now();
-        mTimeClusterFinder += tEnd - tStart;
-
-        if (mAttachInitalPrecluster) {
-          // store the new clusters and associate them to all the digits of the precluster
-          writeClusters(preclusterDigits, firstClusterIdx, clusters, usedDigits);
-        }
+      auto rofPreClusters = preClusters.subspan(preClusterROF.getFirstIdx(), preClusterROF.getNEntries());
+      for (auto& clusterFinder : mClusterFinders) {
+        clusterFinder->reset();
       }
-
-      if (!mAttachInitalPrecluster) {
-        // store all the clusters of the current ROF and the associated digits actually used in the clustering
-        writeClusters(clusters, usedDigits);
+      mPreClusterOutputs.resize(rofPreClusters.size());
+
+      // clusterize the preclusters in parallel, keeping track of where the new clusters are stored
+      auto tStart = std::chrono::high_resolution_clock::now();
+#pragma omp parallel for num_threads(mNThreads) schedule(dynamic)
+      for (int iPreCluster = 0; iPreCluster < static_cast<int>(rofPreClusters.size()); ++iPreCluster) {
+        const auto& preCluster = rofPreClusters[iPreCluster];
+        auto& output = mPreClusterOutputs[iPreCluster];
+        output.finder = omp_get_thread_num();
+        auto& clusterFinder = *mClusterFinders[output.finder];
+        output.firstCluster = clusterFinder.getClusters().size();
+        output.firstDigit = clusterFinder.getUsedDigits().size();
+        clusterFinder.findClusters(digits.subspan(preCluster.firstDigit, preCluster.nDigits));
+        output.nClusters = clusterFinder.getClusters().size() - output.firstCluster;
+        output.nDigits = clusterFinder.getUsedDigits().size() - output.firstDigit;
+      }
+      auto tEnd = std::chrono::high_resolution_clock::now();
+      mTimeClusterFinder += tEnd - tStart;
+
+      // store the new clusters in the order of the preclusters
+      for (int iPreCluster = 0; iPreCluster < static_cast<int>(rofPreClusters.size()); ++iPreCluster) {
+        const auto& preCluster = rofPreClusters[iPreCluster];
+        writeClusters(mPreClusterOutputs[iPreCluster], digits.subspan(preCluster.firstDigit, preCluster.nDigits),
+                      clusterOffset, clusters, usedDigits);
       }
 
       // create the cluster ROF
@@ -130,6 +161,11 @@ class ClusterFinderOriginalTask
                                preClusterROF.getBCWidth());
     }
 
+    ErrorMap errorMap{};
+    for (const auto& clusterFinder : mClusterFinders) {
+      errorMap.add(clusterFinder->getErrorMap());
+    }
+
     // create the output message for clustering errors
     auto& clusterErrors = pc.outputs().make<std::vector<Error>>(OutputRef{"clustererrors"});
     errorMap.forEach([&clusterErrors](Error error) {
@@ -142,52 +178,59 @@ class ClusterFinderOriginalTask
   }
 
  private:
+  /// location of the clusters reconstructed from one precluster
+  struct PreClusterOutput {
+    int finder = 0;          ///< index of the clusterizer used
+    size_t firstCluster = 0; ///< index of the first new cluster in this clusterizer
+    size_t nClusters = 0;    ///< number of new clusters
+    size_t firstDigit = 0;   ///< index of the first new used digit in this clusterizer
+    size_t nDigits = 0;      ///< number of new used digits
+  };
+
   //_________________________________________________________________________________________________
-  void writeClusters(const gsl::span<const Digit>& preclusterDigits, size_t firstClusterIdx,
+  void writeClusters(const PreClusterOutput& output, const gsl::span<const Digit>& preclusterDigits, size_t rofClusterOffset,
                      std::vector<Cluster, o2::pmr::polymorphic_allocator<Cluster>>& clusters,
                      std::vector<Digit, o2::pmr::polymorphic_allocator<Digit>>& usedDigits) const
   {
-    /// fill the output messages with the new clusters and all the digits from the corresponding precluster
+    /// fill the output messages with the clusters reconstructed from one precluster and the attached digits
+    /// (either the ones actually used in the clustering or all the digits of the precluster)
     /// modify the references to the attached digits according to their position in the global vector
+    /// and the cluster index in the unique ID according to its position in the current ROF
 
-    if (firstClusterIdx == mClusterFinder.getClusters().size()) {
+    if (output.nClusters == 0) {
       return;
     }
 
+    const auto& clusterFinder = *mClusterFinders[output.finder];
+    auto itFirstCluster = clusterFinder.getClusters().begin() + output.firstCluster;
     auto clusterOffset = clusters.size();
-    clusters.insert(clusters.end(), mClusterFinder.getClusters().begin() + firstClusterIdx, mClusterFinder.getClusters().end());
+    clusters.insert(clusters.end(), itFirstCluster, itFirstCluster + output.nClusters);
 
     auto digitOffset = usedDigits.size();
-    usedDigits.insert(usedDigits.end(), preclusterDigits.begin(), preclusterDigits.end());
-
-    for (auto itCluster = clusters.begin() + clusterOffset; itCluster < clusters.end(); ++itCluster) {
-      itCluster->firstDigit = digitOffset;
-      itCluster->nDigits = preclusterDigits.size();
+    if (mAttachInitalPrecluster) {
+      usedDigits.insert(usedDigits.end(), preclusterDigits.begin(), preclusterDigits.end());
+    } else {
+      auto itFirstDigit = clusterFinder.getUsedDigits().begin() + output.firstDigit;
+      usedDigits.insert(usedDigits.end(), itFirstDigit, itFirstDigit + output.nDigits);
     }
-  }
-
-  //_________________________________________________________________________________________________
-  void writeClusters(std::vector<Cluster, o2::pmr::polymorphic_allocator<Cluster>>& clusters,
-                     std::vector<Digit, o2::pmr::polymorphic_allocator<Digit>>& usedDigits) const
-  {
-    /// fill the output messages with clusters and attached digits of the current event
-    /// modify the references to the attached digits according to their position in the global vector
-
-    auto clusterOffset = clusters.size();
-    clusters.insert(clusters.end(), mClusterFinder.getClusters().begin(), mClusterFinder.getClusters().end());
-
-    auto digitOffset = usedDigits.size();
-    usedDigits.insert(usedDigits.end(), mClusterFinder.getUsedDigits().begin(), mClusterFinder.getUsedDigits().end());
 
     for (auto itCluster = clusters.begin() + clusterOffset; itCluster < clusters.end(); ++itCluster) {
-      itCluster->firstDigit += digitOffset;
+      itCluster->uid = Cluster::buildUniqueId(itCluster->getChamberId(), itCluster->getDEId(), itCluster - clusters.begin() - rofClusterOffset);
+      if (mAttachInitalPrecluster) {
+        itCluster->firstDigit = digitOffset;
+        itCluster->nDigits = preclusterDigits.size();
+      } else {
+        itCluster->firstDigit = itCluster->firstDigit - output.firstDigit + digitOffset;
+      }
     }
   }
 
-  bool mAttachInitalPrecluster = false;               ///< attach all digits of initial precluster to cluster
-  ClusterFinderOriginal mClusterFinder{};             ///< clusterizer
-  ErrorMap mErrorMap{};                               ///< counting of encountered errors
-  std::chrono::duration<double> mTimeClusterFinder{}; ///< timer
+  bool mAttachInitalPrecluster = false;                                  ///< attach all digits of initial precluster to cluster
+  int mNThreads = 1;                                                     ///< number of threads used for clustering
+  std::vector<std::unique_ptr<ClusterFinderOriginal>> mClusterFinders{}; ///< one clusterizer per thread
+  std::vector<PreClusterOutput> mPreClusterOutputs{};                    ///< location of the clusters of each precluster of the current ROF
+  ErrorMap mErrorMap{};                                                  ///< counting of encountered errors
+  std::chrono::duration<double> mTimeClusterFinder{};                    ///< timer
 };
 
 //_________________________________________________________________________________________________
@@ -205,7 +248,8 @@ o2::framework::DataProcessorSpec getClusterFinderOriginalSpec(const char* specNa
     AlgorithmSpec{adaptFromTask<ClusterFinderOriginalTask>()},
     Options{{"mch-config", VariantType::String, "", {"JSON or INI file with clustering parameters"}},
             {"run2-config", VariantType::Bool, false, {"setup for run2 data"}},
-            {"attach-initial-precluster", VariantType::Bool, false, {"attach all digits of initial precluster to cluster"}}}};
+            {"attach-initial-precluster", VariantType::Bool, false, {"attach all digits of initial precluster to cluster"}},
+            {"nthreads", VariantType::Int, 1, {"number of threads used to clusterize the preclusters of each ROF in parallel"}}}};
 }
 
 } // end namespace mch
@@ -16,12 +16,15 @@
 #ifndef O2_MID_DECODEDDATAAGGREGATOR_H
 #define O2_MID_DECODEDDATAAGGREGATOR_H
 
+#include <array>
+#include <cstdint>
+#include <utility>
 #include <vector>
-#include <map>
 #include <gsl/gsl>
 #include "DataFormatsMID/ColumnData.h"
 #include "DataFormatsMID/ROBoard.h"
 #include "DataFormatsMID/ROFRecord.h"
+#include "MIDBase/DetectorParameters.h"
 #include "MIDRaw/CrateMapper.h"
 
 namespace o2
@@ -31,6 +34,8 @@ namespace mid
 class DecodedDataAggregator
 {
  public:
+  DecodedDataAggregator();
+
   void process(gsl::span<const ROBoard> localBoards, gsl::span<const ROFRecord> rofRecords);
 
   /// Gets the vector of data
@@ -40,14 +45,24 @@ class DecodedDataAggregator
   const std::vector<ROFRecord>& getROFRecords(EventType eventType = EventType::Standard) { return mROFRecords[static_cast<int>(eventType)]; }
 
  private:
-  void addData(const ROBoard& col, size_t firstEntry, size_t evtTypeIdx);
-  ColumnData& FindColumnData(uint8_t deId, uint8_t columnId, size_t firstEntry, size_t evtTypeIdx);
+  /// Position in the detector of a local board
+  struct BoardInfo {
+    bool isValid{false};                               /// The board exists
+    uint8_t columnId{0};                               /// Column ID
+    uint8_t lineId{0};                                 /// Line ID
+    std::array<uint8_t, detparams::NChambers> deIds{}; /// Detection element ID for each chamber
+  };
+
+  void addData(const ROBoard& col, size_t evtTypeIdx);
+  ColumnData& findColumnData(uint8_t deId, uint8_t columnId, size_t evtTypeIdx);
 
-  std::array<std::map<uint64_t, std::vector<size_t>>, 3> mEventIndexes{}; /// Event indexes
+  std::array<std::vector<std::pair<uint64_t, size_t>>, 3> mEventIndexes{}; /// Interaction record and index of the RO frames for each event type
 
-  std::array<std::vector<ColumnData>, 3> mData{};      /// Vector of output column data
-  std::array<std::vector<ROFRecord>, 3> mROFRecords{}; /// Vector of ROF records
-  CrateMapper mCrateMapper;                            /// Mapper to convert the RO info to ColumnData
+  std::array<std::vector<ColumnData>, 3> mData{};                      /// Vector of output column data
+  std::array<std::vector<ROFRecord>, 3> mROFRecords{};                 /// Vector of ROF records
+  std::array<BoardInfo, 256> mBoardInfos{};                            /// Position of the local boards for each unique loc ID
+  std::array<int, 8 * detparams::NDetectionElements> mColumnIndexes{}; /// Index in the output data of the columns of the current event, -1 if not present
+  CrateMapper mCrateMapper;                                            /// Mapper to convert the RO info to ColumnData
 };
 } // namespace mid
 } // namespace o2
@@ -16,8 +16,10 @@
 #ifndef O2_MID_ELINKDECODER_H
 #define O2_MID_ELINKDECODER_H
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
-#include <vector>
+#include <iterator>
 #include <gsl/gsl>
 
 #include "DataFormatsMID/ROBoard.h"
@@ -31,24 +33,24 @@ class ELinkDecoder
  public:
   void setBareDecoder(bool isBare);
   /// Adds a byte
-  inline void add(const uint8_t byte) { mBytes.emplace_back(byte); }
+  inline void add(const uint8_t byte) { mBytes[mNBytes++] = byte; }
   void addAndComputeSize(const uint8_t byte);
   template <class ITERATOR>
   bool addCore(ITERATOR& it, const ITERATOR& end)
   {
     /// Adds the first 5 bytes
-    auto remaining = mMinimumSize - mBytes.size();
+    auto remaining = mMinimumSize - mNBytes;
     return add(it, end, remaining);
   }
   template <class ITERATOR>
   bool add(ITERATOR& it, const ITERATOR& end)
   {
     /// Adds the board bytes
-    auto remaining = mTotalSize - mBytes.size();
+    auto remaining = mTotalSize - mNBytes;
     if (add(it, end, remaining)) {
       if (mTotalSize == mMinimumSize) {
         computeSize();
-        remaining = mTotalSize - mBytes.size();
+        remaining = mTotalSize - mNBytes;
         if (remaining) {
           return add(it, end, remaining);
         }
@@ -59,15 +61,15 @@ class ELinkDecoder
   }
 
   /// Adds the first 5 bytes
-  inline bool addCore(size_t& idx, gsl::span<const uint8_t> payload, size_t step) { return add(idx, payload, mMinimumSize - mBytes.size(), step); }
+  inline bool addCore(size_t& idx, gsl::span<const uint8_t> payload, size_t step) { return add(idx, payload, mMinimumSize - mNBytes, step); }
 
   bool add(size_t& idx, gsl::span<const uint8_t> payload, size_t step);
 
   /// Checks if this is a zero
-  inline bool isZero(uint8_t byte) const { return (mBytes.empty() && (byte & raw::sSTARTBIT) == 0); }
+  inline bool isZero(uint8_t byte) const { return (mNBytes == 0 && (byte & raw::sSTARTBIT) == 0); }
 
   /// Checks if we have all of the information needed for the decoding
-  inline bool isComplete() const { return mBytes.size() == mTotalSize; };
+  inline bool isComplete() const { return mNBytes == mTotalSize; };
   /// Gets the status word
   inline uint8_t getStatusWord() const { return mBytes[0]; }
   /// Gets the trigger word
@@ -80,9 +82,10 @@ class ELinkDecoder
   inline uint8_t getInputs() const { return (mBytes[4] & 0xF); }
   /// Gets the crate ID when available
   inline uint8_t getCrateId() const { return (mBytes[5] >> 4) & 0xF; }
-  uint16_t getPattern(int cathode, int chamber) const;
+  /// Gets the pattern
+  inline uint16_t getPattern(int cathode, int chamber) const { return ((getInputs() >> chamber) & 0x1) ? joinBytes(mNBytes - sPatternOffsets[getInputs()][chamber] + 2 * cathode) : 0; }
   /// Gets the number of bytes read
-  inline size_t getNBytes() const { return mBytes.size(); }
+  inline size_t getNBytes() const { return mNBytes; }
 
   void reset();
 
@@ -91,10 +94,11 @@ class ELinkDecoder
   template <class ITERATOR>
   bool add(ITERATOR& it, const ITERATOR& end, size_t nBytes)
   {
-    /// Fills inner bytes vector
+    /// Fills inner bytes array
     auto nToEnd = std::distance(it, end);
     auto nAdded = nBytes < nToEnd ? nBytes : nToEnd;
-    mBytes.insert(mBytes.end(), it, it + nAdded);
+    std::copy(it, it + nAdded, mBytes.begin() + mNBytes);
+    mNBytes += nAdded;
     it += nAdded;
     return (nAdded == nBytes);
   }
@@ -103,10 +107,30 @@ class ELinkDecoder
 
   void computeSize();
 
-  size_t mMinimumSize{5};          /// Minimum size of the buffer
-  size_t mMaximumSize{21};         /// Maximum size of the buffer
-  std::vector<uint8_t> mBytes{};   /// Vector with encoded information
-  size_t mTotalSize{mMinimumSize}; /// Expected size of the read-out buffer
+  /// Number of pattern bytes for each value of the inputs, i.e. 4 bytes (BP and NBP) per fired chamber
+  static constexpr std::array<uint8_t, 16> sPatternSizes{0, 4, 4, 8, 4, 8, 8, 12, 4, 8, 8, 12, 8, 12, 12, 16};
+
+  /// Offset of the patterns of each chamber from the end of the buffer, for each value of the inputs.
+  /// The patterns of the first fired chamber are the last ones in the buffer
+  static constexpr std::array<std::array<uint8_t, 4>, 16> sPatternOffsets = []() {
+    std::array<std::array<uint8_t, 4>, 16> offsets{};
+    for (int mask = 0; mask < 16; ++mask) {
+      uint8_t offset = 0;
+      for (int ich = 0; ich < 4; ++ich) {
+        if ((mask >> ich) & 0x1) {
+          offset += 4;
+          offsets[mask][ich] = offset;
+        }
+      }
+    }
+    return offsets;
+  }();
+
+  size_t mMinimumSize{5};           /// Minimum size of the buffer
+  size_t mMaximumSize{21};          /// Maximum size of the buffer
+  std::array<uint8_t, 22> mBytes{}; /// Array with encoded information
+  size_t mNBytes{0};                /// Number of bytes in the array
+  size_t mTotalSize{mMinimumSize};  /// Expected size of the read-out buffer
 };
 } // namespace mid
 } // namespace o2
@@ -17,9 +17,9 @@
 #define O2_MID_ELINKMANAGER_H
 
 #include <cstdint>
-#if defined(MID_RAW_VECTORS)
 #include <vector>
-#else
+#if !defined(MID_RAW_VECTORS)
+#include <array>
 #include <unordered_map>
 #endif
 #include "MIDRaw/ELinkDataShaper.h"
@@ -61,7 +61,7 @@ class ELinkManager
 
 #else
   /// Returns the decoder
-  inline ELinkDecoder& getDecoder(uint8_t boardUniqueId, bool isLoc) { return mDecoders.find(makeUniqueId(isLoc, boardUniqueId))->second; }
+  inline ELinkDecoder& getDecoder(uint8_t boardUniqueId, bool isLoc) { return mDecoders[mIndexes[makeUniqueId(isLoc, boardUniqueId)]]; }
 
   /// Main function to be executed when decoding is done
   void onDone(const ELinkDecoder& decoder, uint8_t crateId, uint8_t locId, std::vector<ROBoard>& data, std::vector<ROFRecord>& rofs);
@@ -69,10 +69,11 @@ class ELinkManager
  private:
   /// Makes a ID which is unique for local and regional board
   inline uint16_t makeUniqueId(bool isLoc, uint8_t uniqueId) { return (isLoc ? 0 : (1 << 8)) | uniqueId; }
-  std::unordered_map<uint16_t, ELinkDataShaper> mDataShapers; /// Data shapers for each loc and reg board
-  std::unordered_map<uint16_t, ELinkDecoder> mDecoders;       /// Decoders for each loc and reg board
-  std::unordered_map<uint16_t, unsigned long int> mErrors;    /// Decoding errors
-  uint16_t mFeeId;                                            /// Front End ID
+  std::array<int16_t, 512> mIndexes{};                     /// Index in the vectors below for each unique ID, -1 if the board is not in the link
+  std::vector<ELinkDataShaper> mDataShapers;               /// Data shapers for each loc and reg board
+  std::vector<ELinkDecoder> mDecoders;                     /// Decoders for each loc and reg board
+  std::unordered_map<uint16_t, unsigned long int> mErrors; /// Decoding errors
+  uint16_t mFeeId;                                         /// Front End ID
 
 #endif
 };
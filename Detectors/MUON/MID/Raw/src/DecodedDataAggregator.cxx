@@ -16,6 +16,8 @@
 
 #include "MIDRaw/DecodedDataAggregator.h"
 
+#include <algorithm>
+
 #include "Framework/Logger.h"
 #include "MIDBase/DetectorParameters.h"
 #include "MIDRaw/CrateParameters.h"
@@ -25,41 +27,60 @@ namespace o2
 namespace mid
 {
 
-ColumnData& DecodedDataAggregator::FindColumnData(uint8_t deId, uint8_t columnId, size_t firstEntry, size_t evtTypeIdx)
+DecodedDataAggregator::DecodedDataAggregator()
 {
-  /// Gets the matching column data
-  /// Adds one if not found
-  for (auto colIt = mData[evtTypeIdx].begin() + firstEntry, end = mData[evtTypeIdx].end(); colIt != end; ++colIt) {
-    if (colIt->deId == deId && colIt->columnId == columnId) {
-      return *colIt;
+  /// Constructor: fills the position of the local boards, so that the mapping is not queried for each board
+  for (int uniqueLocId = 0; uniqueLocId < static_cast<int>(mBoardInfos.size()); ++uniqueLocId) {
+    auto& info = mBoardInfos[uniqueLocId];
+    uint16_t deBoardId = 0;
+    try {
+      deBoardId = mCrateMapper.roLocalBoardToDE(uniqueLocId);
+    } catch (const std::exception&) {
+      continue;
+    }
+    bool isRightSide = crateparams::isRightSide(raw::getCrateId(uniqueLocId));
+    auto rpcLineId = detparams::getRPCLine(detparams::getDEIdFromFEEId(deBoardId));
+    info.isValid = true;
+    info.columnId = detparams::getColumnIdFromFEEId(deBoardId);
+    info.lineId = detparams::getLineIdFromFEEId(deBoardId);
+    for (int ich = 0; ich < detparams::NChambers; ++ich) {
+      info.deIds[ich] = detparams::getDEId(isRightSide, ich, rpcLineId);
     }
   }
-  mData[evtTypeIdx].push_back({deId, columnId});
-  return mData[evtTypeIdx].back();
+  mColumnIndexes.fill(-1);
+}
+
+ColumnData& DecodedDataAggregator::findColumnData(uint8_t deId, uint8_t columnId, size_t evtTypeIdx)
+{
+  /// Gets the matching column data in the current event
+  /// Adds one if not found
+  auto& idx = mColumnIndexes[8 * deId + columnId];
+  if (idx < 0) {
+    idx = mData[evtTypeIdx].size();
+    mData[evtTypeIdx].push_back({deId, columnId});
+  }
+  return mData[evtTypeIdx][idx];
 }
 
-void DecodedDataAggregator::addData(const ROBoard& loc, size_t firstEntry, size_t evtTypeIdx)
+void DecodedDataAggregator::addData(const ROBoard& loc, size_t evtTypeIdx)
 {
   /// Converts the local board data to ColumnData
-  uint8_t uniqueLocId = loc.boardId;
-  uint8_t crateId = raw::getCrateId(uniqueLocId);
-  bool isRightSide = crateparams::isRightSide(crateId);
-  try {
-    uint16_t deBoardId = mCrateMapper.roLocalBoardToDE(uniqueLocId);
-    auto rpcLineId = detparams::getRPCLine(detparams::getDEIdFromFEEId(deBoardId));
-    auto columnId = detparams::getColumnIdFromFEEId(deBoardId);
-    auto lineId = detparams::getLineIdFromFEEId(deBoardId);
-    for (int ich = 0; ich < 4; ++ich) {
-      if (((loc.firedChambers >> ich) & 0x1) == 0) {
-        continue;
-      }
-      uint8_t deId = detparams::getDEId(isRightSide, ich, rpcLineId);
-      auto& col = FindColumnData(deId, columnId, firstEntry, evtTypeIdx);
-      col.setBendPattern(loc.patternsBP[ich], lineId);
-      col.setNonBendPattern(col.getNonBendPattern() | loc.patternsNBP[ich]);
+  const auto& info = mBoardInfos[loc.boardId];
+  if (!info.isValid) {
+    try {
+      mCrateMapper.roLocalBoardToDE(loc.boardId);
+    } catch (const std::exception& except) {
+      LOG(alarm) << except.what();
     }
-  } catch (const std::exception& except) {
-    LOG(alarm) << except.what();
+    return;
+  }
+  for (int ich = 0; ich < 4; ++ich) {
+    if (((loc.firedChambers >> ich) & 0x1) == 0) {
+      continue;
+    }
+    auto& col = findColumnData(info.deIds[ich], info.columnId, evtTypeIdx);
+    col.setBendPattern(loc.patternsBP[ich], info.lineId);
+    col.setNonBendPattern(col.getNonBendPattern() | loc.patternsNBP[ich]);
   }
 }
 
@@ -75,29 +96,36 @@ void DecodedDataAggregator::process(gsl::span<const ROBoard> localBoards, gsl::s
     rof.clear();
   }
 
-  // Fill the map with ordered events
+  // Order the events in time. The sort is stable, so that the RO frames with the same timestamp keep their order
   for (auto rofIt = rofRecords.begin(); rofIt != rofRecords.end(); ++rofIt) {
-    mEventIndexes[static_cast<int>(rofIt->eventType)][rofIt->interactionRecord.toLong()].emplace_back(rofIt - rofRecords.begin());
+    mEventIndexes[static_cast<int>(rofIt->eventType)].emplace_back(rofIt->interactionRecord.toLong(), rofIt - rofRecords.begin());
   }
 
-  const ROFRecord* rof = nullptr;
   for (size_t ievtType = 0; ievtType < mEventIndexes.size(); ++ievtType) {
-    for (auto& item : mEventIndexes[ievtType]) {
+    auto& eventIndexes = mEventIndexes[ievtType];
+    std::stable_sort(eventIndexes.begin(), eventIndexes.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (auto it = eventIndexes.begin(); it != eventIndexes.end();) {
       size_t firstEntry = mData[ievtType].size();
-      for (auto& idx : item.second) {
-        // In principle all of these ROF records have the same timestamp
-        rof = &rofRecords[idx];
+      // In principle all of these ROF records have the same timestamp
+      const ROFRecord* rof = nullptr;
+      auto irLong = it->first;
+      for (; it != eventIndexes.end() && it->first == irLong; ++it) {
+        rof = &rofRecords[it->second];
         for (size_t iloc = rof->firstEntry; iloc < rof->firstEntry + rof->nEntries; ++iloc) {
-          addData(localBoards[iloc], firstEntry, ievtType);
+          addData(localBoards[iloc], ievtType);
         }
       }
       auto nEntries = mData[ievtType].size() - firstEntry;
       if (nEntries > 0) {
         mROFRecords[ievtType].emplace_back(rof->interactionRecord, rof->eventType, firstEntry, nEntries);
       }
+      // Reset the column indexes for the next event
+      for (size_t idx = firstEntry; idx < mData[ievtType].size(); ++idx) {
+        mColumnIndexes[8 * mData[ievtType][idx].deId + mData[ievtType][idx].columnId] = -1;
+      }
     }
     // Clear the inner objects when the computation is done
-    mEventIndexes[ievtType].clear();
+    eventIndexes.clear();
   } // loop on event types
 }
 
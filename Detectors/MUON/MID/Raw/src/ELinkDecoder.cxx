@@ -31,7 +31,7 @@ void ELinkDecoder::setBareDecoder(bool isBare)
 
 bool ELinkDecoder::add(size_t& idx, gsl::span<const uint8_t> payload, size_t nBytes, size_t step)
 {
-  /// Fills inner bytes vector
+  /// Fills inner bytes array
   auto size = payload.size();
   auto end = idx + step * nBytes;
   if (size < end) {
@@ -39,7 +39,7 @@ bool ELinkDecoder::add(size_t& idx, gsl::span<const uint8_t> payload, size_t nBy
   }
   size_t nAdded = 0;
   for (; idx < end; idx += step) {
-    mBytes.emplace_back(payload[idx]);
+    mBytes[mNBytes++] = payload[idx];
     ++nAdded;
   }
   return (nAdded == nBytes);
@@ -48,11 +48,11 @@ bool ELinkDecoder::add(size_t& idx, gsl::span<const uint8_t> payload, size_t nBy
 bool ELinkDecoder::add(size_t& idx, gsl::span<const uint8_t> payload, size_t step)
 {
   /// Adds the bytes of the board
-  auto remaining = mTotalSize - mBytes.size();
+  auto remaining = mTotalSize - mNBytes;
   if (add(idx, payload, remaining, step)) {
     if (mTotalSize == mMinimumSize) {
       computeSize();
-      remaining = mTotalSize - mBytes.size();
+      remaining = mTotalSize - mNBytes;
       if (remaining) {
         return add(idx, payload, remaining, step);
       }
@@ -65,8 +65,8 @@ bool ELinkDecoder::add(size_t& idx, gsl::span<const uint8_t> payload, size_t ste
 void ELinkDecoder::addAndComputeSize(uint8_t byte)
 {
   /// Adds next byte and computes the expected data size
-  mBytes.emplace_back(byte);
-  if (mBytes.size() == mMinimumSize) {
+  mBytes[mNBytes++] = byte;
+  if (mNBytes == mMinimumSize) {
     computeSize();
   }
 }
@@ -75,43 +75,17 @@ void ELinkDecoder::computeSize()
 {
   /// Computes the board size
   if (raw::isLoc(mBytes[0])) {
-    // This is a local card
-    uint8_t mask = getInputs();
-    for (int ich = 0; ich < 4; ++ich) {
-      if ((mask >> ich) & 0x1) {
-        // We expect 2 bytes for the BP and 2 for the NBP
-        mTotalSize += 4;
-      }
-    }
+    // This is a local card: we expect 2 bytes for the BP and 2 for the NBP of each fired chamber
+    mTotalSize += sPatternSizes[getInputs()];
   }
 }
 
 void ELinkDecoder::reset()
 {
   /// Reset inner objects
-  mBytes.clear();
+  mNBytes = 0;
   mTotalSize = mMinimumSize;
 }
 
-uint16_t ELinkDecoder::getPattern(int cathode, int chamber) const
-{
-  /// Gets the pattern
-  uint8_t mask = getInputs();
-  if (((mask >> chamber) & 0x1) == 0) {
-    return 0;
-  }
-
-  int idx = mBytes.size();
-  for (int ich = 0; ich <= chamber; ++ich) {
-    if ((mask >> ich) & 0x1) {
-      idx -= 4;
-    }
-  }
-
-  idx += 2 * cathode;
-
-  return joinBytes(idx);
-}
-
 } // namespace mid
 } // namespace o2
@@ -29,6 +29,9 @@ void ELinkManager::init(uint16_t feeId, bool isDebugMode, bool isBare, const Ele
   /// Initializer
   auto gbtUniqueIds = isBare ? std::vector<uint16_t>{feeId} : feeIdConfig.getGBTUniqueIdsInLink(feeId);
   mFeeId = feeId;
+#if !defined(MID_RAW_VECTORS)
+  mIndexes.fill(-1);
+#endif
 
   for (auto& gbtUniqueId : gbtUniqueIds) {
     auto crateId = crateparams::getCrateIdFromGBTUniqueId(gbtUniqueId);
@@ -41,17 +44,14 @@ void ELinkManager::init(uint16_t feeId, bool isDebugMode, bool isBare, const Ele
       mDataShapers.emplace_back(shaper);
 #else
       auto uniqueRegLocId = makeUniqueId(isLoc, uniqueId);
-      mDataShapers.emplace(uniqueRegLocId, shaper);
+      mIndexes[uniqueRegLocId] = mDataShapers.size();
+      mDataShapers.emplace_back(shaper);
 #endif
 
       if (isBare) {
         ELinkDecoder decoder;
         decoder.setBareDecoder(true);
-#if defined(MID_RAW_VECTORS)
         mDecoders.emplace_back(decoder);
-#else
-        mDecoders.emplace(uniqueRegLocId, decoder);
-#endif
       }
     }
   }
@@ -68,8 +68,8 @@ void ELinkManager::init(uint16_t feeId, bool isDebugMode, bool isBare, const Ele
 void ELinkManager::onDone(const ELinkDecoder& decoder, uint8_t crateId, uint8_t locId, std::vector<ROBoard>& data, std::vector<ROFRecord>& rofs)
 {
   auto uniqueId = makeUniqueId(raw::isLoc(decoder.getStatusWord()), raw::makeUniqueLocID(crateId, locId));
-  auto ds = mDataShapers.find(uniqueId);
-  if (ds == mDataShapers.end()) {
+  auto idx = mIndexes[uniqueId];
+  if (idx < 0) {
     // There is something wrong: we are receiving data from a local board that is not expected to be there.
     // This usually happens when some local boards are not properly configured
     // and the crate or board ID that they return is not correct.
@@ -90,18 +90,14 @@ void ELinkManager::onDone(const ELinkDecoder& decoder, uint8_t crateId, uint8_t
     }
     return;
   }
-  return ds->second.onDone(decoder, data, rofs);
+  return mDataShapers[idx].onDone(decoder, data, rofs);
 }
 
 void ELinkManager::set(uint32_t orbit, uint32_t trigger)
 {
   /// Setup the orbit
   for (auto& shaper : mDataShapers) {
-#if defined(MID_RAW_VECTORS)
     shaper.set(orbit, trigger);
-#else
-    shaper.second.set(orbit, trigger);
-#endif
   }
 }
 
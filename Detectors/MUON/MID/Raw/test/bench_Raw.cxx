@@ -13,8 +13,14 @@
 /// \brief  Benchmark MID raw data decoder
 /// \author Diego Stocco <Diego.Stocco at cern.ch>
 /// \date   17 March 2018
+///
+/// Recorded raw data are decoded in addition to the simulated ones
+/// if the MID_RAW_BENCH_FILE environment variable points to a raw file
 
 #include "benchmark/benchmark.h"
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
 #include <vector>
 #include "Framework/Logger.h"
 #include "CommonDataFormat/InteractionRecord.h"
@@ -22,6 +28,7 @@
 #include "DPLUtils/RawParser.h"
 #include "DataFormatsMID/ColumnData.h"
 #include "MIDBase/DetectorParameters.h"
+#include "MIDRaw/DecodedDataAggregator.h"
 #include "MIDRaw/Decoder.h"
 #include "MIDRaw/Encoder.h"
 #include "MIDRaw/LinkDecoder.h"
@@ -120,6 +127,50 @@ static void BM_Decoder(benchmark::State& state)
   }
 
   state.counters["num"] = benchmark::Counter(num, benchmark::Counter::kIsRate);
+  state.SetBytesProcessed(state.iterations() * inputData.size());
+}
+
+static void BM_DecoderRecorded(benchmark::State& state)
+{
+  o2::mid::Decoder decoder;
+
+  std::vector<uint8_t> inputData;
+  if (auto filename = std::getenv("MID_RAW_BENCH_FILE")) {
+    std::ifstream file(filename, std::ios::binary);
+    inputData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  if (inputData.empty()) {
+    state.SkipWithError("no recorded raw data");
+    return;
+  }
+
+  for (auto _ : state) {
+    decoder.process(inputData);
+  }
+
+  state.SetBytesProcessed(state.iterations() * inputData.size());
+}
+
+static void BM_DecodedDataAggregator(benchmark::State& state)
+{
+  o2::mid::Decoder decoder;
+  o2::mid::DecodedDataAggregator aggregator;
+
+  int nTF = state.range(0);
+  int nEventPerTF = state.range(1);
+  int nFiredPerEvent = state.range(2);
+  double num{0};
+
+  auto inputData = generateTestData(nTF, nEventPerTF, nFiredPerEvent);
+  decoder.process(inputData);
+
+  for (auto _ : state) {
+    aggregator.process(decoder.getData(), decoder.getROFRecords());
+    ++num;
+  }
+
+  state.counters["num"] = benchmark::Counter(num, benchmark::Counter::kIsRate);
+  state.SetItemsProcessed(state.iterations() * decoder.getData().size());
 }
 
 static void BM_LinkDecoder(benchmark::State& state)
@@ -166,5 +217,7 @@ static void CustomArguments(benchmark::internal::Benchmark* bench)
 
 BENCHMARK(BM_LinkDecoder)->Apply(CustomArguments)->Unit(benchmark::kNanosecond);
 BENCHMARK(BM_Decoder)->Apply(CustomArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_DecoderRecorded)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DecodedDataAggregator)->Apply(CustomArguments)->Unit(benchmark::kNanosecond);
 
 BENCHMARK_MAIN();
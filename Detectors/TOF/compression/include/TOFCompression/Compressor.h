@@ -69,6 +69,8 @@ class Compressor
 
   void checkSummary();
   void resetCounters();
+  /** add the counters of another compressor, e.g. one running on another thread **/
+  void addCounters(const Compressor& other);
 
   void setDecoderCONET(bool val)
   {
@@ -183,9 +185,9 @@ class Compressor
   bool checkerCheck();
   void checkerCheckRDH();
 
-  uint32_t mEventCounter;
-  uint32_t mFatalCounter;
-  uint32_t mErrorCounter;
+  uint32_t mEventCounter = 0;
+  uint32_t mFatalCounter = 0;
+  uint32_t mErrorCounter = 0;
   bool mCheckerVerbose = false;
 
   struct DRMCounters_t {
@@ -19,8 +19,11 @@
 
 #include "Framework/Task.h"
 #include "Framework/DataProcessorSpec.h"
+#include "Framework/DataRef.h"
 #include "TOFCompression/Compressor.h"
 #include <fstream>
+#include <memory>
+#include <vector>
 
 using namespace o2::framework;
 
@@ -39,9 +42,17 @@ class CompressorTask : public Task
   void run(ProcessingContext& pc) final;
 
  private:
+  /** compress the input parts in parallel, each HBF sequence of a part on a single thread **/
+  void compressParts(const std::vector<o2::framework::DataRef>& parts);
+
   Compressor<RDH, verbose, paranoid> mCompressor;
   int mOutputBufferSize;
   long mPayloadLimit = -1;
+
+  int mNThreads = 1;
+  std::vector<std::unique_ptr<Compressor<RDH, verbose, paranoid>>> mThreadCompressors; // compressors of the other threads
+  std::vector<std::vector<char>> mPartBuffers;                                         // compressed output of each part
+  std::vector<uint32_t> mPartSizes;                                                    // compressed size of each part
 };
 
 } // namespace tof
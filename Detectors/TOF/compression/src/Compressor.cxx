@@ -775,6 +775,35 @@ bool Compressor<RDH, verbose, paranoid>::processTRMchain(int itrm, int ichain)
     if (nsteps > 99 && !(nsteps % 100)) {
       LOG(debug) << "processTRMchain: nsteps in while loop = " << nsteps << ", infity loop?";
     }
+    /** TDC hit detected, fast path over the whole run of hits **/
+    if (!verbose && IS_TDC_HIT(*mDecoderPointer)) {
+      mDecoderSummary.hasHits[itrm][ichain] = true;
+      /** work on local copies: the byte-sized hit counters would otherwise alias the decoder state **/
+      auto pointer = mDecoderPointer;
+      auto pointerMax = mDecoderPointerMax;
+      auto nextWord = mDecoderNextWord;
+      auto nextWordStep = mDecoderNextWordStep;
+      auto& trmDataHits = mDecoderSummary.trmDataHits[ichain];
+      auto& trmDataHit = mDecoderSummary.trmDataHit[ichain];
+      uint32_t word = *pointer;
+      do {
+        auto itdc = GET_TRMDATAHIT_TDCID(word);
+        trmDataHit[itdc][trmDataHits[itdc]++] = pointer;
+        pointer += nextWord;
+        nextWord = (nextWord + nextWordStep) & 0x3;
+        if (paranoid && pointer >= pointerMax) {
+          break;
+        }
+        word = *pointer;
+      } while (IS_TDC_HIT(word));
+      mDecoderPointer = pointer;
+      mDecoderNextWord = nextWord;
+      if (paranoid && decoderParanoid()) {
+        return true;
+      }
+      continue;
+    }
+
     /** TDC hit detected **/
     if (IS_TDC_HIT(*mDecoderPointer)) {
       mDecoderSummary.hasHits[itrm][ichain] = true;
@@ -1436,6 +1465,35 @@ void Compressor<RDH, verbose, paranoid>::resetCounters()
   }
 }
 
+template <typename RDH, bool verbose, bool paranoid>
+void Compressor<RDH, verbose, paranoid>::addCounters(const Compressor& other)
+{
+  mIntegratedBytes += other.mIntegratedBytes;
+  mIntegratedTime += other.mIntegratedTime;
+  mEventCounter += other.mEventCounter;
+  mFatalCounter += other.mFatalCounter;
+  mErrorCounter += other.mErrorCounter;
+  mDRMCounters.Headers += other.mDRMCounters.Headers;
+  mDRMCounters.EventWordsMismatch += other.mDRMCounters.EventWordsMismatch;
+  mDRMCounters.clockStatus += other.mDRMCounters.clockStatus;
+  mDRMCounters.Fault += other.mDRMCounters.Fault;
+  mDRMCounters.RTOBit += other.mDRMCounters.RTOBit;
+  for (int itrm = 0; itrm < 10; ++itrm) {
+    mTRMCounters[itrm].Headers += other.mTRMCounters[itrm].Headers;
+    mTRMCounters[itrm].Empty += other.mTRMCounters[itrm].Empty;
+    mTRMCounters[itrm].EventCounterMismatch += other.mTRMCounters[itrm].EventCounterMismatch;
+    mTRMCounters[itrm].EventWordsMismatch += other.mTRMCounters[itrm].EventWordsMismatch;
+    mTRMCounters[itrm].EBit += other.mTRMCounters[itrm].EBit;
+    for (int ichain = 0; ichain < 2; ++ichain) {
+      mTRMChainCounters[itrm][ichain].Headers += other.mTRMChainCounters[itrm][ichain].Headers;
+      mTRMChainCounters[itrm][ichain].EventCounterMismatch += other.mTRMChainCounters[itrm][ichain].EventCounterMismatch;
+      mTRMChainCounters[itrm][ichain].BadStatus += other.mTRMChainCounters[itrm][ichain].BadStatus;
+      mTRMChainCounters[itrm][ichain].BunchIDMismatch += other.mTRMChainCounters[itrm][ichain].BunchIDMismatch;
+      mTRMChainCounters[itrm][ichain].TDCerror += other.mTRMChainCounters[itrm][ichain].TDCerror;
+    }
+  }
+}
+
 template <typename RDH, bool verbose, bool paranoid>
 void Compressor<RDH, verbose, paranoid>::checkSummary()
 {
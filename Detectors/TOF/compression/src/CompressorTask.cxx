@@ -22,6 +22,15 @@
 #include "Framework/InputRecordWalker.h"
 #include "CommonUtils/VerbosityConfig.h"
 
+#include <algorithm>
+#include <cstring>
+
+#ifdef WITH_OPENMP
+#include <omp.h>
+#else
+static inline int omp_get_thread_num() { return 0; }
+#endif
+
 using namespace o2::framework;
 
 namespace o2::tof
@@ -41,13 +50,35 @@ void CompressorTask<RDH, verbose, paranoid>::init(InitContext& ic)
   auto encoderVerbose = ic.options().get<bool>("tof-compressor-encoder-verbose");
   auto checkerVerbose = ic.options().get<bool>("tof-compressor-checker-verbose");
   mOutputBufferSize = ic.options().get<int>("tof-compressor-output-buffer-size");
+  mNThreads = std::max(ic.options().get<int>("tof-compressor-nthreads"), 1);
+#ifndef WITH_OPENMP
+  mNThreads = 1;
+#endif
+  if (verbose && mNThreads > 1) {
+    LOG(warning) << "Verbose compressor, forcing to run on a single thread";
+    mNThreads = 1;
+  }
+  LOG(info) << "Compressor running on " << mNThreads << " thread(s)";
 
   mCompressor.setDecoderCONET(decoderCONET);
   mCompressor.setDecoderVerbose(decoderVerbose);
   mCompressor.setEncoderVerbose(encoderVerbose);
   mCompressor.setCheckerVerbose(checkerVerbose);
 
+  mThreadCompressors.clear();
+  for (int ithread = 1; ithread < mNThreads; ++ithread) {
+    auto& compressor = mThreadCompressors.emplace_back(std::make_unique<Compressor<RDH, verbose, paranoid>>());
+    compressor->setDecoderCONET(decoderCONET);
+    compressor->setDecoderVerbose(decoderVerbose);
+    compressor->setEncoderVerbose(encoderVerbose);
+    compressor->setCheckerVerbose(checkerVerbose);
+  }
+
   auto finishFunction = [this]() {
+    for (auto& compressor : mThreadCompressors) {
+      mCompressor.addCounters(*compressor);
+      compressor->resetCounters();
+    }
     mCompressor.checkSummary();
   };
 
@@ -111,6 +142,16 @@ void CompressorTask<RDH, verbose, paranoid>::run(ProcessingContext& pc)
     //  }
   }
 
+  /** compress the parts of all subspecs in parallel **/
+  if (mNThreads > 1) {
+    std::vector<o2::framework::DataRef> allParts;
+    for (auto& subspecPartEntry : subspecPartMap) {
+      allParts.insert(allParts.end(), subspecPartEntry.second.begin(), subspecPartEntry.second.end());
+    }
+    compressParts(allParts);
+  }
+  int ipart = 0;
+
   /** loop over subspecs **/
   for (auto& subspecPartEntry : subspecPartMap) {
 
@@ -123,11 +164,29 @@ void CompressorTask<RDH, verbose, paranoid>::run(ProcessingContext& pc)
     headerOut.dataDescription = "CRAWDATA";
     headerOut.payloadSize = 0;
     headerOut.splitPayloadParts = 1;
+    auto output = Output{headerOut.dataOrigin, "CRAWDATA", headerOut.subSpecification};
+
+    /** parts already compressed, concatenate them in the output message **/
+    if (mNThreads > 1) {
+      auto firstPart = ipart;
+      ipart += parts.size();
+      for (int jpart = firstPart; jpart < ipart; ++jpart) {
+        headerOut.payloadSize += mPartSizes[jpart];
+      }
+      auto&& v = pc.outputs().makeVector<char>(output);
+      v.resize(headerOut.payloadSize);
+      auto bufferPointer = v.data();
+      for (int jpart = firstPart; jpart < ipart; ++jpart) {
+        std::memcpy(bufferPointer, mPartBuffers[jpart].data(), mPartSizes[jpart]);
+        bufferPointer += mPartSizes[jpart];
+      }
+      pc.outputs().adoptContainer(output, std::move(v));
+      continue;
+    }
 
     /** initialise output message **/
     auto bufferSize = mOutputBufferSize >= 0 ? mOutputBufferSize + subspecBufferSize[subspec] : std::abs(mOutputBufferSize);
     auto bufferSizeDouble = bufferSize * 2;
-    auto output = Output{headerOut.dataOrigin, "CRAWDATA", headerOut.subSpecification};
     auto&& v = pc.outputs().makeVector<char>(output);
     v.resize(bufferSizeDouble);
     // Better way of doing this would be to used an offset, so that we can resize the vector
@@ -169,6 +228,48 @@ void CompressorTask<RDH, verbose, paranoid>::run(ProcessingContext& pc)
   }
 }
 
+template <typename RDH, bool verbose, bool paranoid>
+void CompressorTask<RDH, verbose, paranoid>::compressParts(const std::vector<o2::framework::DataRef>& parts)
+{
+  int nparts = parts.size();
+  if (mPartBuffers.size() < static_cast<size_t>(nparts)) {
+    mPartBuffers.resize(nparts);
+  }
+  mPartSizes.assign(nparts, 0);
+
+  /** the HBFs of a part are processed in sequence by the compressor of the thread, the parts are independent **/
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int ipart = 0; ipart < nparts; ++ipart) {
+    auto ithread = omp_get_thread_num();
+    auto& compressor = ithread == 0 ? mCompressor : *mThreadCompressors[ithread - 1];
+    const auto& ref = parts[ipart];
+    auto payloadInSize = DataRefUtils::getPayloadSize(ref);
+
+    if (mPayloadLimit > -1 && payloadInSize > mPayloadLimit) {
+      LOG(error) << "Payload larger than limit (" << mPayloadLimit << "), payload = " << payloadInSize;
+      continue;
+    }
+
+    auto bufferSize = mOutputBufferSize >= 0 ? mOutputBufferSize + payloadInSize : std::abs(mOutputBufferSize);
+    auto& buffer = mPartBuffers[ipart];
+    if (buffer.size() < static_cast<size_t>(bufferSize)) {
+      buffer.resize(bufferSize);
+    }
+
+    /** prepare compressor **/
+    compressor.setDecoderBuffer(ref.payload);
+    compressor.setDecoderBufferSize(payloadInSize);
+    compressor.setEncoderBuffer(buffer.data());
+    compressor.setEncoderBufferSize(bufferSize);
+
+    /** run **/
+    compressor.run();
+    mPartSizes[ipart] = compressor.getEncoderByteCounter();
+  }
+}
+
 template class CompressorTask<o2::header::RAWDataHeader, false, false>;
 template class CompressorTask<o2::header::RAWDataHeader, false, true>;
 template class CompressorTask<o2::header::RAWDataHeader, true, false>;
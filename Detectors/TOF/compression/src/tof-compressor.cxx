@@ -117,7 +117,8 @@ WorkflowSpec defineDataProcessing(ConfigContext const& cfgc)
         {"tof-compressor-conet-mode", VariantType::Bool, false, {"Decoder CONET flag"}},
         {"tof-compressor-decoder-verbose", VariantType::Bool, false, {"Decoder verbose flag"}},
         {"tof-compressor-encoder-verbose", VariantType::Bool, false, {"Encoder verbose flag"}},
-        {"tof-compressor-checker-verbose", VariantType::Bool, false, {"Checker verbose flag"}}}});
+        {"tof-compressor-checker-verbose", VariantType::Bool, false, {"Checker verbose flag"}},
+        {"tof-compressor-nthreads", VariantType::Int, 1, {"Number of threads compressing the input parts in parallel"}}}});
     idevice++;
   }
 
@@ -0,0 +1,145 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @file   bench_Compressor.cxx
+/// @brief  throughput benchmark of the TOF raw data compressor
+///
+/// The synthetic benchmark argument is the number of leading/trailing hit pairs per TRM chain.
+/// Recorded raw data, with the pages of each HBF stored contiguously, are used instead if the
+/// TOF_COMPRESSOR_BENCH_RAWFILE environment variable points to a raw file.
+/// The multi-threaded runs use one compressor per thread, as the compressor task does.
+
+#include "benchmark/benchmark.h"
+#include "Headers/RAWDataHeader.h"
+#include "TOFCompression/Compressor.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using namespace o2::tof;
+using RDH = o2::header::RAWDataHeader;
+
+static constexpr int NHBFS = 256;                // number of HBFs of the synthetic data
+static constexpr int OUTPUTBUFFERSIZE = 1048576; // extra size of the output buffer, as in the compressor task
+
+/// create one DRM event per HBF with all TRMs, each chain with the given number of leading/trailing hit pairs
+std::vector<char> createRawData(int nHitsPerChain)
+{
+  std::mt19937 generator(1234);
+  std::uniform_int_distribution<uint32_t> tdc(0, 14);
+  std::uniform_int_distribution<uint32_t> channel(0, 7);
+  std::uniform_int_distribution<uint32_t> time(0, (1 << 21) - 1 - 1000);
+  std::uniform_int_distribution<uint32_t> tot(1, 1000);
+  std::vector<char> buffer;
+  for (int ihbf = 0; ihbf < NHBFS; ++ihbf) {
+    std::vector<uint32_t> payload;
+    payload.push_back(0x40000000); // TOF Data Header
+    payload.push_back(ihbf);       // TOF Orbit
+    payload.push_back(0x40000001); // DRM Data Header, event words set below
+    payload.push_back(0x00027FE0); // DRM Header Word 1, all slots participating and clock status 2
+    payload.push_back(0x00007FE0); // DRM Header Word 2, all slots enabled
+    payload.push_back(0x00000000); // DRM Header Word 3
+    payload.push_back(0x00000000); // DRM Header Word 4
+    payload.push_back(0x00000000); // DRM Header Word 5
+    for (uint32_t slotId = 3; slotId < 13; ++slotId) {
+      payload.push_back(0x40000000 | slotId); // TRM Data Header
+      for (uint32_t ichain = 0; ichain < 2; ++ichain) {
+        payload.push_back((ichain << 29) | slotId); // TRM Chain Header
+        for (int ihit = 0; ihit < nHitsPerChain; ++ihit) {
+          auto hit = (tdc(generator) << 24) | (channel(generator) << 21);
+          auto hitTime = time(generator);
+          payload.push_back(0xA0000000 | hit | hitTime);                    // leading hit
+          payload.push_back(0xC0000000 | hit | (hitTime + tot(generator))); // trailing hit
+        }
+        payload.push_back((2 * ichain + 1) << 28); // TRM Chain Trailer
+      }
+      payload.push_back(0x50000003); // TRM Data Trailer
+    }
+    payload.push_back(0x50000001); // DRM Data Trailer
+    payload[2] |= (payload.size() - 2 - 6) << 4;
+
+    /** split the payload in CRU pages, the HBF is closed by an empty page **/
+    const std::size_t maxPayloadSize = 8192 - sizeof(RDH);
+    const std::size_t payloadSize = payload.size() * sizeof(uint32_t);
+    const auto payloadData = reinterpret_cast<const char*>(payload.data());
+    const int npages = (payloadSize + maxPayloadSize - 1) / maxPayloadSize;
+    for (int ipage = 0; ipage <= npages; ++ipage) {
+      auto offset = ipage * maxPayloadSize;
+      auto size = ipage < npages ? std::min(maxPayloadSize, payloadSize - offset) : 0;
+      RDH rdh;
+      rdh.orbit = ihbf;
+      rdh.dataFormat = 2;
+      rdh.pageCnt = ipage;
+      rdh.stop = ipage == npages;
+      rdh.memorySize = sizeof(RDH) + size;
+      rdh.offsetToNext = rdh.memorySize;
+      buffer.insert(buffer.end(), reinterpret_cast<const char*>(&rdh), reinterpret_cast<const char*>(&rdh) + sizeof(RDH));
+      buffer.insert(buffer.end(), payloadData + offset, payloadData + offset + size);
+    }
+  }
+  return buffer;
+}
+
+/// read the recorded raw data
+std::vector<char> readRawData(const char* filename)
+{
+  std::ifstream file(filename, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void runCompressor(benchmark::State& state, const std::vector<char>& input)
+{
+  if (input.empty()) {
+    state.SkipWithError("no input raw data");
+    return;
+  }
+  std::vector<char> output(input.size() + OUTPUTBUFFERSIZE);
+  Compressor<RDH, false, false> compressor;
+  for (auto _ : state) {
+    compressor.setDecoderBuffer(input.data());
+    compressor.setDecoderBufferSize(input.size());
+    compressor.setEncoderBuffer(output.data());
+    compressor.setEncoderBufferSize(output.size());
+    compressor.run();
+    benchmark::DoNotOptimize(compressor.getEncoderByteCounter());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+static void BM_CompressorSynthetic(benchmark::State& state)
+{
+  const auto input = createRawData(state.range(0));
+  runCompressor(state, input);
+}
+
+static void BM_CompressorRecorded(benchmark::State& state)
+{
+  const auto filename = std::getenv("TOF_COMPRESSOR_BENCH_RAWFILE");
+  const auto input = filename ? readRawData(filename) : std::vector<char>();
+  runCompressor(state, input);
+}
+
+static void CustomArguments(benchmark::internal::Benchmark* bench)
+{
+  // number of hit pairs per TRM chain
+  for (const auto nHits : {1, 10, 50}) {
+    bench->Args({nHits});
+  }
+}
+
+BENCHMARK(BM_CompressorSynthetic)->Apply(CustomArguments)->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CompressorRecorded)->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test TOFCompressor
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "Headers/RAWDataHeader.h"
+#include "TOFCompression/Compressor.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace o2::tof;
+using RDH = o2::header::RAWDataHeader;
+
+/// create one DRM event per HBF with all TRMs, the number of hits per chain varying from none to more than one CRU page per HBF
+std::vector<char> createRawData(int nHBFs)
+{
+  std::mt19937 generator(1234);
+  std::uniform_int_distribution<int> nHits(0, 60);
+  std::uniform_int_distribution<uint32_t> tdc(0, 14);
+  std::uniform_int_distribution<uint32_t> channel(0, 7);
+  std::uniform_int_distribution<uint32_t> time(0, (1 << 21) - 1 - 1000);
+  std::uniform_int_distribution<uint32_t> tot(1, 1000);
+  std::vector<char> buffer;
+  for (int ihbf = 0; ihbf < nHBFs; ++ihbf) {
+    std::vector<uint32_t> payload{0x40000000, uint32_t(ihbf), 0x40000001, 0x00027FE0, 0x00007FE0, 0, 0, 0}; // TOF and DRM headers
+    for (uint32_t slotId = 3; slotId < 13; ++slotId) {
+      payload.push_back(0x40000000 | slotId); // TRM Data Header
+      for (uint32_t ichain = 0; ichain < 2; ++ichain) {
+        payload.push_back((ichain << 29) | slotId); // TRM Chain Header
+        for (int ihit = nHits(generator); ihit--;) {
+          auto hit = (tdc(generator) << 24) | (channel(generator) << 21);
+          auto hitTime = time(generator);
+          payload.push_back(0xA0000000 | hit | hitTime);                    // leading hit
+          payload.push_back(0xC0000000 | hit | (hitTime + tot(generator))); // trailing hit
+        }
+        payload.push_back((2 * ichain + 1) << 28); // TRM Chain Trailer
+      }
+      payload.push_back(0x50000003); // TRM Data Trailer
+    }
+    payload.push_back(0x50000001); // DRM Data Trailer
+    payload[2] |= (payload.size() - 2 - 6) << 4;
+
+    // split the payload in CRU pages, the HBF is closed by an empty page
+    const std::size_t maxPayloadSize = 8192 - sizeof(RDH);
+    const std::size_t payloadSize = payload.size() * sizeof(uint32_t);
+    const auto payloadData = reinterpret_cast<const char*>(payload.data());
+    const int npages = (payloadSize + maxPayloadSize - 1) / maxPayloadSize;
+    for (int ipage = 0; ipage <= npages; ++ipage) {
+      auto offset = ipage * maxPayloadSize;
+      auto size = ipage < npages ? std::min(maxPayloadSize, payloadSize - offset) : 0;
+      RDH rdh;
+      rdh.orbit = ihbf;
+      rdh.dataFormat = 2;
+      rdh.pageCnt = ipage;
+      rdh.stop = ipage == npages;
+      rdh.memorySize = sizeof(RDH) + size;
+      rdh.offsetToNext = rdh.memorySize;
+      buffer.insert(buffer.end(), reinterpret_cast<const char*>(&rdh), reinterpret_cast<const char*>(&rdh) + sizeof(RDH));
+      buffer.insert(buffer.end(), payloadData + offset, payloadData + offset + size);
+    }
+  }
+  return buffer;
+}
+
+template <bool verbose, bool paranoid>
+std::vector<char> compress(const std::vector<char>& input)
+{
+  std::vector<char> output(2 * input.size());
+  Compressor<RDH, verbose, paranoid> compressor;
+  compressor.setDecoderBuffer(input.data());
+  compressor.setDecoderBufferSize(input.size());
+  compressor.setEncoderBuffer(output.data());
+  compressor.setEncoderBufferSize(output.size());
+  compressor.run();
+  output.resize(compressor.getEncoderByteCounter());
+  return output;
+}
+
+BOOST_AUTO_TEST_CASE(CompressorTDCHitsFastPath)
+{
+  // the verbose compressors, here with their printout disabled, decode the TDC hits word by word
+  const auto input = createRawData(64);
+  const auto reference = compress<true, false>(input);
+  BOOST_REQUIRE(!reference.empty());
+  const auto output = compress<false, false>(input);
+  BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(), reference.begin(), reference.end());
+
+  const auto referenceParanoid = compress<true, true>(input);
+  const auto outputParanoid = compress<false, true>(input);
+  BOOST_CHECK_EQUAL_COLLECTIONS(outputParanoid.begin(), outputParanoid.end(), referenceParanoid.begin(), referenceParanoid.end());
+}
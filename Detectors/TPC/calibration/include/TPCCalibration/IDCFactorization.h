@@ -437,6 +437,13 @@ class IDCFactorization : public IDCGroupHelperSector
   /// helper function for drawing IDCZero
   void drawIDCZeroHelper(const bool type, const Sector sector, const std::string filename, const float minZ, const float maxZ) const;
 
+  /// normalize the IDCs [firstIDC, lastIDC) of one integration interval of a CRU to I_0 and append them to idcOne, shared by the calculation of I_1 on the aggregator and on the FLP
+  /// \param indexOffset index of the first pad of the CRU in idcZero
+  /// \param idcZero I_0 used for the normalization (no normalization if nullptr)
+  /// \param flagMap status map used to skip pads (not checked if nullptr)
+  template <typename DataVec>
+  static void normalizeIDCs(const DataVec& idcs, const unsigned int firstIDC, const unsigned int lastIDC, const unsigned int indexOffset, const CRU cru, const IDCZero* idcZero, const CalDet<PadFlags>* flagMap, std::vector<float>& idcOne);
+
   /// get time frame and index of integrationInterval in the TF
   void getTF(unsigned int integrationInterval, unsigned int& timeFrame, unsigned int& interval) const;
 
@@ -72,6 +72,14 @@ class IDCFourierTransform : public IDCFourierTransformBase<Type>
     sNThreads = nThreads;
   }
 
+  /// This function has to be called before the constructor is called
+  /// \param batchSize number of intervals which are transformed with one FFTW many-transform plan (0 or 1: one plan per interval)
+  template <bool IsEnabled = true, typename std::enable_if<(IsEnabled && (std::is_same<Type, IDCFourierTransformBaseAggregator>::value)), int>::type = 0>
+  static void setBatchSize(const unsigned int batchSize)
+  {
+    sBatchSize = batchSize;
+  }
+
   /// calculate fourier coefficients for one TPC side
   template <bool IsEnabled = true, typename std::enable_if<(IsEnabled && (std::is_same<Type, IDCFourierTransformBaseAggregator>::value)), int>::type = 0>
   void calcFourierCoefficients(const unsigned int timeFrames = 2000)
@@ -102,6 +110,9 @@ class IDCFourierTransform : public IDCFourierTransformBase<Type>
   /// get the number of threads used for calculation of the fourier coefficients
   static int getNThreads() { return sNThreads; }
 
+  /// get the number of intervals which are transformed with one FFTW many-transform plan
+  static unsigned int getBatchSize() { return sBatchSize; }
+
   /// dump object to disc
   /// \param outFileName name of the output file
   /// \param outName name of the object in the output file
@@ -127,12 +138,17 @@ class IDCFourierTransform : public IDCFourierTransformBase<Type>
   static float getSamplingFrequencyIDCHz() { return 1e6 / (12 * o2::constants::lhc::LHCOrbitMUS); }
 
  private:
-  FourierCoeff mFourierCoefficients;         ///< fourier coefficients. interval -> coefficient
-  inline static int sFftw{1};                ///< using fftw or naive approach for calculation of fourier coefficients
-  inline static int sNThreads{1};            ///< number of threads which are used during the calculation of the fourier coefficients
-  fftwf_plan mFFTWPlan{nullptr};             ///<! FFTW plan which is used during the ft
-  std::vector<float*> mVal1DIDCs;            ///<! buffer for the 1D-IDC values for SIMD usage (each thread will get his one obejct)
-  std::vector<fftwf_complex*> mCoefficients; ///<! buffer for coefficients (each thread will get his one obejct)
+  FourierCoeff mFourierCoefficients;              ///< fourier coefficients. interval -> coefficient
+  inline static int sFftw{1};                     ///< using fftw or naive approach for calculation of fourier coefficients
+  inline static int sNThreads{1};                 ///< number of threads which are used during the calculation of the fourier coefficients
+  inline static unsigned int sBatchSize{0};       ///< number of intervals which are transformed in one go using a FFTW many-transform plan
+  fftwf_plan mFFTWPlan{nullptr};                  ///<! FFTW plan which is used during the ft
+  fftwf_plan mFFTWPlanBatch{nullptr};             ///<! FFTW many-transform plan which is used for batches of mBatchSize intervals
+  unsigned int mBatchSize{0};                     ///<! number of intervals of the many-transform plan, 0 if the intervals are transformed one by one
+  std::vector<float*> mVal1DIDCs;                 ///<! buffer for the 1D-IDC values for SIMD usage (each thread will get his one obejct)
+  std::vector<fftwf_complex*> mCoefficients;      ///<! buffer for coefficients (each thread will get his one obejct)
+  std::vector<float*> mVal1DIDCsBatch;            ///<! buffer for the 1D-IDC values of one batch of intervals (each thread will get his one obejct)
+  std::vector<fftwf_complex*> mCoefficientsBatch; ///<! buffer for coefficients of one batch of intervals (each thread will get his one obejct)
 
   /// calculate fourier coefficients
   void calcFourierCoefficientsNaive();
@@ -161,6 +177,12 @@ class IDCFourierTransform : public IDCFourierTransformBase<Type>
   /// performing of ft using FFTW
   void fftwLoop(const std::vector<float>& idcOneExpanded, const std::vector<unsigned int>& offsetIndex, const unsigned int interval, const unsigned int thread);
 
+  /// performing of ft for a batch of intervals using the FFTW many-transform plan
+  void fftwLoopBatch(const std::vector<float>& idcOneExpanded, const std::vector<unsigned int>& offsetIndex, const unsigned int firstInterval, const unsigned int thread);
+
+  /// \return returns true if the intervals are transformed in batches
+  bool useBatches() const { return mBatchSize > 1; }
+
   ClassDefNV(IDCFourierTransform, 1)
 };
 
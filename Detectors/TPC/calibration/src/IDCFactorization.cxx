@@ -18,6 +18,7 @@
 #include "TFile.h"
 #include "TPCBase/CalDet.h"
 #include <functional>
+#include <algorithm>
 #include "MemoryResources/MemoryResources.h"
 #include "CommonConstants/LHCConstants.h"
 #include "TKey.h"
@@ -341,55 +342,50 @@ void o2::tpc::IDCFactorization::calcIDCOne()
     std::fill(idcOne.mIDCOne.begin(), idcOne.mIDCOne.end(), 1);
   }
 
-#pragma omp parallel for num_threads(sNThreads)
+  // flatten TFs and integration intervals to be able to parallelise over all integration intervals (a long aggregation interval contains only a few TFs)
+  std::vector<std::pair<unsigned int, unsigned int>> intervals; // TF, local integration interval
+  intervals.reserve(integrationIntervals);
   for (unsigned int timeframe = 0; timeframe < mTimeFrames; ++timeframe) {
-    const unsigned int nIDCsSide = mNIDCsPerSector * SECTORSPERSIDE;
-    std::vector<std::vector<std::vector<float>>> idcOneSafe(mSides.size()); // side -> intervals -> IDCs
-
-    // reserve memory
-    for (auto& interavalvec : idcOneSafe) {
-      interavalvec.resize(mIntegrationIntervalsPerTF[timeframe]);
-      for (auto& idcsPerInteraval : interavalvec) {
-        idcsPerInteraval.reserve(nIDCsSide);
-      }
+    for (unsigned int interval = 0; interval < mIntegrationIntervalsPerTF[timeframe]; ++interval) {
+      intervals.emplace_back(timeframe, interval);
     }
+  }
 
-    // loop over CRUs and fill idcOneSafe vector with IDC/IDC0 values
+  const unsigned int nIDCsSide = mNIDCsPerSector * SECTORSPERSIDE;
+#pragma omp parallel for num_threads(sNThreads) schedule(dynamic)
+  for (unsigned int intervalGlobal = 0; intervalGlobal < intervals.size(); ++intervalGlobal) {
+    const auto [timeframe, interval] = intervals[intervalGlobal];
+    std::vector<std::vector<float>> idcOneSafe(mSides.size()); // side -> IDCs
+    for (auto& idcsSide : idcOneSafe) {
+      idcsSide.reserve(nIDCsSide);
+    }
+
+    // loop over CRUs and fill idcOneSafe vector with IDC/IDC0 values. The CRUs are always processed in the same order to get reproducible results
     for (unsigned int cruInd = 0; cruInd < mCRUs.size(); ++cruInd) {
       const unsigned int cru = mCRUs[cruInd];
       const o2::tpc::CRU cruTmp(cru);
       const unsigned int region = cruTmp.region();
-      const auto side = cruTmp.side();
-      const unsigned int indexSide = mSideIndex[side];
+      const unsigned int indexSide = mSideIndex[cruTmp.side()];
       const auto factorIndexGlob = mRegionOffs[region] + mNIDCsPerSector * (cruTmp.sector() % o2::tpc::SECTORSPERSIDE);
-      unsigned int integrationIntervalOffset = 0;
-      calcIDCOne(mIDCs[cru][timeframe], mNIDCsPerCRU[region], integrationIntervalOffset, factorIndexGlob, cru, idcOneSafe[indexSide], &mIDCZero[indexSide], mInputGrouped ? nullptr : mPadFlagsMap.get(), mUsePadStatusMap);
+      const auto& idcs = mIDCs[cru][timeframe];
+      const unsigned int idcsPerCRU = mNIDCsPerCRU[region];
+      const unsigned int firstIDC = interval * idcsPerCRU;
+      const unsigned int lastIDC = std::min(static_cast<unsigned int>(idcs.size()), firstIDC + idcsPerCRU);
+      const auto flagMap = (mUsePadStatusMap && !mInputGrouped) ? mPadFlagsMap.get() : nullptr;
+      normalizeIDCs(idcs, firstIDC, lastIDC, factorIndexGlob, cruTmp, &mIDCZero[indexSide], flagMap, idcOneSafe[indexSide]);
     }
 
-    // calculate global offset for interval
-    int offsInterval = 0;
-    for (unsigned int tf = 0; tf < timeframe; ++tf) {
-      offsInterval += mIntegrationIntervalsPerTF[tf];
-    }
-
-    for (int side = 0; side < mSides.size(); ++side) {
-      const unsigned int indexSide = mSideIndex[side];
-      for (int interval = 0; interval < mIntegrationIntervalsPerTF[timeframe]; ++interval) {
-
-        // calculate robust average for each slice
-        const int intervalGlobal = interval + offsInterval;
-        if (!idcOneSafe[indexSide].empty()) {
-          RobustAverage average(std::move(idcOneSafe[indexSide][interval]));
-          const float mean = average.getTrunctedMean(0.05, 0.95);
-          const float median = average.getMedian();
-          const float rms = average.getStdDev();
-          if (mean != 0) {
-            mIDCOne[indexSide].mIDCOne[intervalGlobal] = mean;
-          }
-          mIDCOne[indexSide].mIDCOneMedian[intervalGlobal] = median;
-          mIDCOne[indexSide].mIDCOneRMS[intervalGlobal] = rms;
-        }
+    // calculate robust average for each side
+    for (unsigned int indexSide = 0; indexSide < mSides.size(); ++indexSide) {
+      RobustAverage average(std::move(idcOneSafe[indexSide]));
+      const float mean = average.getTrunctedMean(0.05, 0.95);
+      const float median = average.getMedian();
+      const float rms = average.getStdDev();
+      if (mean != 0) {
+        mIDCOne[indexSide].mIDCOne[intervalGlobal] = mean;
       }
+      mIDCOne[indexSide].mIDCOneMedian[intervalGlobal] = median;
+      mIDCOne[indexSide].mIDCOneRMS[intervalGlobal] = rms;
     }
   }
 }
@@ -397,31 +393,38 @@ void o2::tpc::IDCFactorization::calcIDCOne()
 template <typename DataVec>
 void o2::tpc::IDCFactorization::calcIDCOne(const DataVec& idcsData, const int idcsPerCRU, const int integrationIntervalOffset, const unsigned int indexOffset, const CRU cru, std::vector<std::vector<float>>& idcOneTmp, const IDCZero* idcZero, const CalDet<PadFlags>* flagMap, const bool usePadStatusMap)
 {
-  for (unsigned int idcs = 0; idcs < idcsData.size(); ++idcs) {
-    if ((idcsData[idcs] == -1) || (idcsData[idcs] == 0)) {
-      continue;
+  for (unsigned int firstIDC = 0; firstIDC < idcsData.size(); firstIDC += idcsPerCRU) {
+    const unsigned int integrationInterval = firstIDC / idcsPerCRU + integrationIntervalOffset;
+    if (idcOneTmp.size() <= integrationInterval) {
+      LOGP(error, "integrationInterval {} is larger than maximum: {}", integrationInterval, idcOneTmp.size());
+      break;
     }
+    const unsigned int lastIDC = std::min(static_cast<unsigned int>(idcsData.size()), firstIDC + idcsPerCRU);
+    normalizeIDCs(idcsData, firstIDC, lastIDC, indexOffset, cru, idcZero, usePadStatusMap ? flagMap : nullptr, idcOneTmp[integrationInterval]);
+  }
+}
 
-    const unsigned int integrationInterval = idcs / idcsPerCRU + integrationIntervalOffset;
-    const unsigned int localPad = (idcs % idcsPerCRU);
-    const unsigned int indexGlob = localPad + indexOffset;
-    const auto idcZeroVal = idcZero ? idcZero->mIDCZero[indexGlob] : 1;
+template <typename DataVec>
+void o2::tpc::IDCFactorization::normalizeIDCs(const DataVec& idcs, const unsigned int firstIDC, const unsigned int lastIDC, const unsigned int indexOffset, const CRU cru, const IDCZero* idcZero, const CalDet<PadFlags>* flagMap, std::vector<float>& idcOne)
+{
+  for (unsigned int idc = firstIDC; idc < lastIDC; ++idc) {
+    if ((idcs[idc] == -1) || (idcs[idc] == 0)) {
+      continue;
+    }
 
     // check pad in case of input is not grouped
-    if (usePadStatusMap && flagMap) {
+    const unsigned int localPad = idc - firstIDC;
+    if (flagMap) {
       const o2::tpc::PadFlags flag = flagMap->getCalArray(cru).getValue(localPad);
       if ((flag & PadFlags::flagSkip) == PadFlags::flagSkip) {
         continue;
       }
     }
 
-    if (idcOneTmp.size() <= integrationInterval) {
-      LOGP(error, "integrationInterval {} is larger than maximum: {}", integrationInterval, idcOneTmp.size());
-      break;
-    }
+    const auto idcZeroVal = idcZero ? idcZero->mIDCZero[localPad + indexOffset] : 1;
     const double epsilon = 0.001;
     if (std::abs(idcZeroVal) > epsilon) {
-      idcOneTmp[integrationInterval].emplace_back(idcsData[idcs] / idcZeroVal);
+      idcOne.emplace_back(idcs[idc] / idcZeroVal);
     }
   }
 }
@@ -875,7 +878,7 @@ void o2::tpc::IDCFactorization::factorizeIDCs(const bool norm, const bool calcDe
   mIntegrationIntervalsPerTF = getAllIntegrationIntervalsPerTF();
   stop = timer::now();
   time = stop - start;
-  totalTime = time.count();
+  totalTime += time.count();
   LOGP(info, "Getting integration intervals for all TFs time: {}", time.count());
 
   LOGP(info, "Calculating IDC1");
@@ -15,6 +15,7 @@
 #include "Framework/Logger.h"
 #include "TFile.h"
 #include <fftw3.h>
+#include <algorithm>
 
 #if (defined(WITH_OPENMP) || defined(_OPENMP)) && !defined(__CLING__)
 #include <omp.h>
@@ -25,11 +26,20 @@ static inline int omp_get_thread_num() { return 0; }
 template <class Type>
 o2::tpc::IDCFourierTransform<Type>::~IDCFourierTransform()
 {
-  for (int thread = 0; thread < sNThreads; ++thread) {
+  // the buffers and plans are released as they were allocated, independently of the current number of threads and batch size
+  for (size_t thread = 0; thread < mVal1DIDCs.size(); ++thread) {
     fftwf_free(mVal1DIDCs[thread]);
     fftwf_free(mCoefficients[thread]);
   }
   fftwf_destroy_plan(mFFTWPlan);
+
+  for (size_t thread = 0; thread < mVal1DIDCsBatch.size(); ++thread) {
+    fftwf_free(mVal1DIDCsBatch[thread]);
+    fftwf_free(mCoefficientsBatch[thread]);
+  }
+  if (mFFTWPlanBatch) {
+    fftwf_destroy_plan(mFFTWPlanBatch);
+  }
 }
 
 template <class Type>
@@ -40,6 +50,24 @@ void o2::tpc::IDCFourierTransform<Type>::initFFTW3Members()
     mCoefficients[thread] = fftwf_alloc_complex(getNMaxCoefficients());
   }
   mFFTWPlan = fftwf_plan_dft_r2c_1d(this->mRangeIDC, mVal1DIDCs.front(), mCoefficients.front(), FFTW_ESTIMATE);
+
+  // many-transform plan: the intervals of one batch are stored contiguously and transformed with one call, which allows FFTW to vectorize across the transforms
+  if constexpr (std::is_same_v<Type, IDCFourierTransformBaseAggregator>) {
+    if (sBatchSize > 1) {
+      mBatchSize = sBatchSize;
+      const int rank = 1;
+      const int n[] = {static_cast<int>(this->mRangeIDC)};
+      const int nCoeff = getNMaxCoefficients();
+      mVal1DIDCsBatch.resize(sNThreads);
+      mCoefficientsBatch.resize(sNThreads);
+      for (int thread = 0; thread < sNThreads; ++thread) {
+        mVal1DIDCsBatch[thread] = fftwf_alloc_real(this->mRangeIDC * mBatchSize);
+        mCoefficientsBatch[thread] = fftwf_alloc_complex(nCoeff * mBatchSize);
+        std::fill_n(mVal1DIDCsBatch[thread], this->mRangeIDC * mBatchSize, 0.f);
+      }
+      mFFTWPlanBatch = fftwf_plan_many_dft_r2c(rank, n, mBatchSize, mVal1DIDCsBatch.front(), nullptr, 1, this->mRangeIDC, mCoefficientsBatch.front(), nullptr, 1, nCoeff, FFTW_ESTIMATE);
+    }
+  }
 }
 
 template <class Type>
@@ -105,9 +133,17 @@ void o2::tpc::IDCFourierTransform<Type>::calcFourierCoefficientsFFTW3()
   const std::vector<float>& idcOneExpanded{this->getExpandedIDCOne()}; // 1D-IDC values which will be used for the FFT
 
   if constexpr (std::is_same_v<Type, IDCFourierTransformBaseAggregator>) {
-#pragma omp parallel for num_threads(sNThreads)
-    for (unsigned int interval = 0; interval < this->getNIntervals(); ++interval) {
-      fftwLoop(idcOneExpanded, offsetIndex, interval, omp_get_thread_num());
+    if (useBatches()) {
+      const unsigned int nBatches = (this->getNIntervals() + mBatchSize - 1) / mBatchSize;
+#pragma omp parallel for num_threads(mVal1DIDCsBatch.size())
+      for (unsigned int batch = 0; batch < nBatches; ++batch) {
+        fftwLoopBatch(idcOneExpanded, offsetIndex, batch * mBatchSize, omp_get_thread_num());
+      }
+    } else {
+#pragma omp parallel for num_threads(mVal1DIDCs.size())
+      for (unsigned int interval = 0; interval < this->getNIntervals(); ++interval) {
+        fftwLoop(idcOneExpanded, offsetIndex, interval, omp_get_thread_num());
+      }
     }
   } else {
     fftwLoop(idcOneExpanded, offsetIndex, 0, 0);
@@ -124,6 +160,22 @@ inline void o2::tpc::IDCFourierTransform<Type>::fftwLoop(const std::vector<float
   std::memcpy(&(*(mFourierCoefficients.mFourierCoefficients.begin() + mFourierCoefficients.getIndex(interval, 0))), mCoefficients[thread], mFourierCoefficients.getNCoefficientsPerTF() * sizeof(float)); // store coefficients
 }
 
+template <class Type>
+void o2::tpc::IDCFourierTransform<Type>::fftwLoopBatch(const std::vector<float>& idcOneExpanded, const std::vector<unsigned int>& offsetIndex, const unsigned int firstInterval, const unsigned int thread)
+{
+  // the last batch can contain less intervals: the remaining transforms are performed on stale values and are not stored
+  const unsigned int nIntervals = std::min(mBatchSize, this->getNIntervals() - firstInterval);
+  for (unsigned int i = 0; i < nIntervals; ++i) {
+    std::memcpy(mVal1DIDCsBatch[thread] + i * this->mRangeIDC, &idcOneExpanded[offsetIndex[firstInterval + i]], this->mRangeIDC * sizeof(float));
+  }
+
+  fftwf_execute_dft_r2c(mFFTWPlanBatch, mVal1DIDCsBatch[thread], mCoefficientsBatch[thread]);
+
+  for (unsigned int i = 0; i < nIntervals; ++i) {
+    std::memcpy(&(*(mFourierCoefficients.mFourierCoefficients.begin() + mFourierCoefficients.getIndex(firstInterval + i, 0))), mCoefficientsBatch[thread] + i * getNMaxCoefficients(), mFourierCoefficients.getNCoefficientsPerTF() * sizeof(float));
+  }
+}
+
 template <class Type>
 std::vector<std::vector<float>> o2::tpc::IDCFourierTransform<Type>::inverseFourierTransformNaive() const
 {
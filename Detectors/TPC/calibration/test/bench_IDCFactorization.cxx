@@ -0,0 +1,119 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  bench_IDCFactorization.cxx
+/// \brief benchmark of the IDC factorization and of the fourier transform of the 1D-IDCs for one aggregation interval
+///
+/// The first argument is the number of threads. For the fourier transform the second argument is the number of intervals per FFTW many-transform plan (0: one plan per interval)
+
+#include "benchmark/benchmark.h"
+#include "Framework/Logger.h"
+#include "TPCCalibration/IDCFactorization.h"
+#include "TPCCalibration/IDCFourierTransform.h"
+#include <random>
+#include <numeric>
+#include <algorithm>
+
+using namespace o2::tpc;
+
+static constexpr unsigned int NTFS = 200;            // number of aggregated TFs
+static constexpr unsigned int NINTERVALS = 10;       // number of integration intervals per TF (two TFs out of three have one more)
+static constexpr unsigned int NTFSFOURIER = 2000;    // number of TFs for which the fourier coefficients are calculated
+static constexpr unsigned int RANGEIDC = 200;        // number of 1D-IDCs used to calculate the fourier coefficients
+static constexpr unsigned int NCOEFF = RANGEIDC + 2; // number of stored fourier coefficients
+
+std::vector<unsigned int> getIntegrationIntervalsPerTF(const unsigned int tfs)
+{
+  std::vector<unsigned int> intervals;
+  intervals.reserve(tfs);
+  for (unsigned int i = 0; i < tfs; ++i) {
+    intervals.emplace_back(NINTERVALS + ((i % 3) ? 1 : 0));
+  }
+  return intervals;
+}
+
+static void BM_IDCFactorization(benchmark::State& state)
+{
+  fair::Logger::SetConsoleSeverity(fair::Severity::warning);
+  std::vector<uint32_t> crus(CRU::MaxCRU);
+  std::iota(crus.begin(), crus.end(), 0);
+
+  const std::array<unsigned char, Mapper::NREGIONS> groupPads{4, 4, 4, 4, 4, 4, 4, 4, 4, 4};
+  const std::array<unsigned char, Mapper::NREGIONS> groupRows{4, 4, 4, 4, 4, 4, 4, 4, 4, 4};
+  const std::array<unsigned char, Mapper::NREGIONS> groupLastRowsThreshold{2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
+  const std::array<unsigned char, Mapper::NREGIONS> groupLastPadsThreshold{2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
+  IDCFactorization::setNThreads(state.range(0));
+  IDCFactorization factorization(groupPads, groupRows, groupLastRowsThreshold, groupLastPadsThreshold, 0, NTFS, NTFS, crus);
+
+  // grouped IDCs as they are received by the aggregator
+  std::mt19937 rng(42);
+  std::normal_distribution<float> gaus(10, 1);
+  const auto intervalsPerTF = getIntegrationIntervalsPerTF(NTFS);
+  for (const auto cru : crus) {
+    const unsigned int nIDCs = factorization.getNIDCs(CRU(cru).region());
+    for (unsigned int tf = 0; tf < NTFS; ++tf) {
+      std::vector<float> idcs(nIDCs * intervalsPerTF[tf]);
+      std::generate(idcs.begin(), idcs.end(), [&]() { return gaus(rng); });
+      factorization.setIDCs(std::move(idcs), cru, tf);
+    }
+  }
+
+  for (auto _ : state) {
+    factorization.factorizeIDCs(false, true);
+    benchmark::DoNotOptimize(factorization.getIDCOneVec(Side::A));
+  }
+}
+
+static void BM_IDCFourierTransform(benchmark::State& state)
+{
+  fair::Logger::SetConsoleSeverity(fair::Severity::warning);
+  using FtType = IDCFourierTransform<IDCFourierTransformBaseAggregator>;
+  FtType::setFFT(true);
+  FtType::setNThreads(state.range(0));
+  FtType::setBatchSize(state.range(1));
+  FtType idcFourierTransform{RANGEIDC, NCOEFF};
+
+  std::mt19937 rng(42);
+  std::normal_distribution<float> gaus(0, 0.2f);
+  const auto intervalsPerTF = getIntegrationIntervalsPerTF(NTFSFOURIER);
+  for (int i = 0; i < 2; ++i) {
+    IDCOne idcOne;
+    idcOne.mIDCOne.resize(std::accumulate(intervalsPerTF.begin(), intervalsPerTF.end(), 0u));
+    std::generate(idcOne.mIDCOne.begin(), idcOne.mIDCOne.end(), [&]() { return gaus(rng); });
+    idcFourierTransform.setIDCs(std::move(idcOne), intervalsPerTF);
+  }
+
+  for (auto _ : state) {
+    idcFourierTransform.calcFourierCoefficients(NTFSFOURIER);
+    benchmark::DoNotOptimize(idcFourierTransform.getFourierCoefficients());
+  }
+}
+
+static void CustomArgumentsFactorization(benchmark::internal::Benchmark* bench)
+{
+  for (int nThreads = 1; nThreads <= 16; nThreads *= 2) {
+    bench->Args({nThreads});
+  }
+}
+
+static void CustomArgumentsFourier(benchmark::internal::Benchmark* bench)
+{
+  for (int batchSize : {0, 16, 128}) {
+    for (int nThreads = 1; nThreads <= 16; nThreads *= 2) {
+      bench->Args({nThreads, batchSize});
+    }
+  }
+}
+
+BENCHMARK(BM_IDCFactorization)->Apply(CustomArgumentsFactorization)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_IDCFourierTransform)->Apply(CustomArgumentsFourier)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -61,10 +61,11 @@ BOOST_AUTO_TEST_CASE(IDCFourierTransformAggregator_test)
   using FtType = IDCFourierTransform<IDCFourierTransformBaseAggregator>;
   gRandom->SetSeed(0);
 
-  for (int iType = 0; iType < 2; ++iType) {
+  for (int iType = 0; iType < 3; ++iType) {
     const bool fft = iType == 0 ? false : true;
     FtType::setFFT(fft);
     FtType::setNThreads(2);
+    FtType::setBatchSize((iType == 2) ? 16 : 0); // batched FFTW many-transform plan
 
     FtType idcFourierTransform{rangeIDC, nFourierCoeff};
     const auto intervalsPerTF = getIntegrationIntervalsPerTF(integrationIntervals, tfs);
@@ -87,6 +88,7 @@ BOOST_AUTO_TEST_CASE(IDCFourierTransformAggregator_test)
       }
     }
   }
+  FtType::setBatchSize(0);
 }
 
 // testing FT of EPN
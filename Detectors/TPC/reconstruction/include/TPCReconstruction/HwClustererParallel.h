@@ -0,0 +1,112 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file HwClustererParallel.h
+/// \brief Sector parallel driver for the TPC HW cluster finding
+
+#ifndef ALICEO2_TPC_HwClustererParallel_H_
+#define ALICEO2_TPC_HwClustererParallel_H_
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <gsl/span>
+
+#include "DataFormatsTPC/Helpers.h"
+#include "DataFormatsTPC/Digit.h"
+#include "TPCBase/Sector.h"
+#include "TPCReconstruction/HwClusterer.h"
+#include "SimulationDataFormat/ConstMCTruthContainer.h"
+#include "SimulationDataFormat/MCTruthContainer.h"
+#include "SimulationDataFormat/MCCompLabel.h"
+
+namespace o2
+{
+namespace tpc
+{
+
+/// \class HwClustererParallel
+/// \brief Runs one HwClusterer per sector, processing all sectors concurrently
+///
+/// Each sector owns its HwClusterer instance together with its own cluster and MC label output,
+/// so no state is shared between the threads. The per-sector outputs can either be accessed directly
+/// or merged in ascending sector order, which makes the result independent of the number of threads.
+class HwClustererParallel
+{
+ public:
+  using MCLabelContainer = o2::dataformats::MCLabelContainer;
+  using ConstMCLabelContainerView = o2::dataformats::ConstMCLabelContainerView;
+  using SectorDigits = std::array<gsl::span<const Digit>, Sector::MAXSECTOR>;
+  using SectorLabels = std::array<ConstMCLabelContainerView, Sector::MAXSECTOR>;
+
+  /// Constructor
+  /// \param useMC create MC label output for all sectors
+  HwClustererParallel(bool useMC = false);
+
+  /// The clusterers point to the output containers owned by this object
+  HwClustererParallel(HwClustererParallel const&) = delete;
+  HwClustererParallel& operator=(HwClustererParallel const&) = delete;
+
+  /// initialize all clusterers from HwClustererParam
+  void init();
+
+  /// Set the number of threads used to process the sectors
+  /// \param nThreads number of threads, the sectors are distributed dynamically among them
+  void setNThreads(int nThreads) { mNThreads = nThreads > 0 ? nThreads : 1; }
+
+  /// Get the number of threads used to process the sectors
+  int getNThreads() const { return mNThreads; }
+
+  /// Switch for triggered / continuous readout for all sectors
+  /// \param isContinuous - false for triggered readout, true for continuous readout
+  void setContinuousReadout(bool isContinuous);
+
+  /// Process digits of all sectors, the cluster output of the previous call is cleared
+  /// \param digits time ordered digits per sector, sectors with empty input are skipped
+  /// \param mcDigitTruth MC digit truth per sector, only used if MC labels are enabled
+  void process(const SectorDigits& digits, const SectorLabels* mcDigitTruth = nullptr) { processImpl(digits, mcDigitTruth, false); }
+
+  /// Process the last digits of all sectors and flush the remaining clusters
+  /// \param digits time ordered digits per sector
+  /// \param mcDigitTruth MC digit truth per sector, only used if MC labels are enabled
+  void finishProcess(const SectorDigits& digits, const SectorLabels* mcDigitTruth = nullptr) { processImpl(digits, mcDigitTruth, true); }
+
+  /// Access the clusterer of a sector, e.g. to change its settings
+  HwClusterer& getClusterer(int sector) { return *mSectors[sector].clusterer; }
+
+  /// Cluster output of a single sector of the last call
+  const std::vector<ClusterHardwareContainer8kb>& getClusters(int sector) const { return mSectors[sector].clusters; }
+
+  /// MC label output of a single sector of the last call, nullptr if MC is disabled
+  const MCLabelContainer* getLabels(int sector) const { return mSectors[sector].labels.get(); }
+
+  /// Merge the output of all sectors in ascending sector order
+  /// \param clusters output container the cluster containers are appended to
+  /// \param labels MC label output the labels are appended to, the cluster indices continue after the clusters already in the output
+  void fillOutput(std::vector<ClusterHardwareContainer8kb>& clusters, MCLabelContainer* labels = nullptr) const;
+
+ private:
+  struct SectorClusterer {
+    std::vector<ClusterHardwareContainer8kb> clusters; ///< cluster output of this sector
+    std::unique_ptr<MCLabelContainer> labels;          ///< MC label output of this sector
+    std::unique_ptr<HwClusterer> clusterer;            ///< clusterer instance of this sector
+  };
+
+  void processImpl(const SectorDigits& digits, const SectorLabels* mcDigitTruth, bool finish);
+
+  int mNThreads = 1;                                       ///< number of threads
+  std::array<SectorClusterer, Sector::MAXSECTOR> mSectors; ///< clusterer and output per sector
+};
+
+} // namespace tpc
+} // namespace o2
+
+#endif
@@ -0,0 +1,98 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file HwClustererParallel.cxx
+/// \brief Sector parallel driver for the TPC HW cluster finding
+
+#include "TPCReconstruction/HwClustererParallel.h"
+
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+using namespace o2::tpc;
+
+//______________________________________________________________________________
+HwClustererParallel::HwClustererParallel(bool useMC)
+{
+  // the clusterers are created sequentially, since the Mapper singleton is initialized on first use
+  for (int sector = 0; sector < Sector::MAXSECTOR; ++sector) {
+    auto& sec = mSectors[sector];
+    if (useMC) {
+      sec.labels = std::make_unique<MCLabelContainer>();
+    }
+    sec.clusterer = std::make_unique<HwClusterer>(&sec.clusters, sector, sec.labels.get());
+  }
+}
+
+//______________________________________________________________________________
+void HwClustererParallel::init()
+{
+  for (auto& sec : mSectors) {
+    sec.clusterer->init();
+  }
+}
+
+//______________________________________________________________________________
+void HwClustererParallel::setContinuousReadout(bool isContinuous)
+{
+  for (auto& sec : mSectors) {
+    sec.clusterer->setContinuousReadout(isContinuous);
+  }
+}
+
+//______________________________________________________________________________
+void HwClustererParallel::processImpl(const SectorDigits& digits, const SectorLabels* mcDigitTruth, bool finish)
+{
+  const ConstMCLabelContainerView noLabels;
+
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int sector = 0; sector < Sector::MAXSECTOR; ++sector) {
+    auto& sec = mSectors[sector];
+    const auto& labels = (mcDigitTruth && sec.labels) ? (*mcDigitTruth)[sector] : noLabels;
+    if (finish) {
+      sec.clusterer->finishProcess(digits[sector], labels, true);
+    } else {
+      sec.clusterer->process(digits[sector], labels, true);
+    }
+  }
+}
+
+//______________________________________________________________________________
+void HwClustererParallel::fillOutput(std::vector<ClusterHardwareContainer8kb>& clusters, MCLabelContainer* labels) const
+{
+  size_t nContainers = clusters.size();
+  for (const auto& sec : mSectors) {
+    nContainers += sec.clusters.size();
+  }
+  clusters.reserve(nContainers);
+
+  // the cluster index of the MC labels continues over the clusters already in the output and over the sectors,
+  // clusters without label are padded such that the labels of the next sector are attached at the correct offset
+  size_t nClusters = 0;
+  for (const auto& container : clusters) {
+    nClusters += container.getContainer()->numberOfClusters;
+  }
+  for (const auto& sec : mSectors) {
+    if (labels && sec.labels) {
+      if (nClusters > 0 && labels->getIndexedSize() < nClusters) {
+        labels->addNoLabelIndex(nClusters - 1);
+      }
+      labels->mergeAtBack(*sec.labels);
+    }
+    for (const auto& container : sec.clusters) {
+      nClusters += container.getContainer()->numberOfClusters;
+    }
+    clusters.insert(clusters.end(), sec.clusters.begin(), sec.clusters.end());
+  }
+}
@@ -21,6 +21,7 @@
 #include "DataFormatsTPC/Digit.h"
 #include "TPCBase/Mapper.h"
 #include "TPCReconstruction/HwClusterer.h"
+#include "TPCReconstruction/HwClustererParallel.h"
 
 #include "SimulationDataFormat/ConstMCTruthContainer.h"
 #include "SimulationDataFormat/MCCompLabel.h"
@@ -1003,5 +1004,102 @@ BOOST_AUTO_TEST_CASE(HwClusterer_test6)
   std::cout << "##" << std::endl
             << std::endl;
 }
+
+/// @brief Test 7 sector parallel processing
+BOOST_AUTO_TEST_CASE(HwClusterer_test7)
+{
+  std::cout << "##" << std::endl;
+  std::cout << "## Starting test 7, sector parallel processing." << std::endl;
+
+  // create for each sector a few digits, with sector dependent charges and one MC label per digit
+  std::array<std::vector<Digit>, Sector::MAXSECTOR> digits;
+  std::array<o2::dataformats::ConstMCTruthContainer<o2::MCCompLabel>, Sector::MAXSECTOR> flatLabels;
+  HwClustererParallel::SectorDigits sectorDigits;
+  HwClustererParallel::SectorLabels sectorLabels;
+  for (int sector = 0; sector < Sector::MAXSECTOR; ++sector) {
+    MCLabelContainer labelContainer;
+    // Digit(int cru, float charge, int row, int pad, int time)
+    digits[sector].emplace_back(sector * 10, 100 + sector, 13, 4, 2);
+    digits[sector].emplace_back(sector * 10, 12, 13, 5, 2);
+    if (sector % 3) {
+      digits[sector].emplace_back(sector * 10, 200 + sector, 7, 10, 10);
+    }
+    for (size_t i = 0; i < digits[sector].size(); ++i) {
+      labelContainer.addElement(i, {int(i + 1), sector, 0, false});
+    }
+    labelContainer.flatten_to(flatLabels[sector]);
+    sectorDigits[sector] = digits[sector];
+    sectorLabels[sector] = flatLabels[sector];
+  }
+
+  HwClustererParallel parallelClusterer(true);
+  parallelClusterer.setContinuousReadout(false);
+  parallelClusterer.setNThreads(4);
+  parallelClusterer.process(sectorDigits, &sectorLabels);
+
+  std::vector<ClusterHardwareContainer8kb> mergedClusters;
+  MCLabelContainer mergedLabels;
+  parallelClusterer.fillOutput(mergedClusters, &mergedLabels);
+
+  // compare with sequential processing of the sectors
+  std::vector<ClusterHardwareContainer8kb> refClusters;
+  MCLabelContainer refLabels;
+  for (int sector = 0; sector < Sector::MAXSECTOR; ++sector) {
+    std::vector<ClusterHardwareContainer8kb> clusterArray;
+    MCLabelContainer labelArray;
+    HwClusterer clusterer(&clusterArray, sector, &labelArray);
+    clusterer.setContinuousReadout(false);
+    clusterer.process(digits[sector], flatLabels[sector]);
+
+    BOOST_CHECK_EQUAL(clusterArray.size(), parallelClusterer.getClusters(sector).size());
+    refClusters.insert(refClusters.end(), clusterArray.begin(), clusterArray.end());
+    refLabels.mergeAtBack(labelArray);
+  }
+
+  BOOST_CHECK_EQUAL(mergedClusters.size(), refClusters.size());
+  for (size_t i = 0; i < std::min(mergedClusters.size(), refClusters.size()); ++i) {
+    const auto* merged = mergedClusters[i].getContainer();
+    const auto* ref = refClusters[i].getContainer();
+    BOOST_CHECK_EQUAL(merged->CRU, ref->CRU);
+    BOOST_CHECK_EQUAL(merged->numberOfClusters, ref->numberOfClusters);
+    for (unsigned int c = 0; c < std::min(merged->numberOfClusters, ref->numberOfClusters); ++c) {
+      BOOST_CHECK_EQUAL(merged->clusters[c].getRow(), ref->clusters[c].getRow());
+      BOOST_CHECK_EQUAL(merged->clusters[c].getQMax(), ref->clusters[c].getQMax());
+      BOOST_CHECK_EQUAL(merged->clusters[c].getQTot(), ref->clusters[c].getQTot());
+    }
+  }
+
+  BOOST_CHECK_EQUAL(mergedLabels.getIndexedSize(), refLabels.getIndexedSize());
+  BOOST_CHECK_EQUAL(mergedLabels.getNElements(), refLabels.getNElements());
+  for (size_t i = 0; i < std::min(mergedLabels.getIndexedSize(), refLabels.getIndexedSize()); ++i) {
+    const auto merged = mergedLabels.getLabels(i);
+    const auto ref = refLabels.getLabels(i);
+    BOOST_CHECK_EQUAL(merged.size(), ref.size());
+    for (size_t l = 0; l < std::min(merged.size(), ref.size()); ++l) {
+      BOOST_CHECK(merged[l] == ref[l]);
+    }
+  }
+
+  // appending to a non-empty output, the labels continue after the clusters already in the output
+  size_t nRefClusters = 0;
+  for (const auto& container : refClusters) {
+    nRefClusters += container.getContainer()->numberOfClusters;
+  }
+  parallelClusterer.fillOutput(mergedClusters, &mergedLabels);
+  BOOST_CHECK_EQUAL(mergedClusters.size(), 2 * refClusters.size());
+  BOOST_REQUIRE_EQUAL(mergedLabels.getIndexedSize(), nRefClusters + refLabels.getIndexedSize());
+  for (size_t i = 0; i < refLabels.getIndexedSize(); ++i) {
+    const auto merged = mergedLabels.getLabels(nRefClusters + i);
+    const auto ref = refLabels.getLabels(i);
+    BOOST_CHECK_EQUAL(merged.size(), ref.size());
+    for (size_t l = 0; l < std::min(merged.size(), ref.size()); ++l) {
+      BOOST_CHECK(merged[l] == ref[l]);
+    }
+  }
+
+  std::cout << "## Test 7 done." << std::endl;
+  std::cout << "##" << std::endl
+            << std::endl;
+}
 } // namespace tpc
 } // namespace o2
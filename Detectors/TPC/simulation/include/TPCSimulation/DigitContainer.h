@@ -16,7 +16,8 @@
 #ifndef ALICEO2_TPC_DigitContainer_H_
 #define ALICEO2_TPC_DigitContainer_H_
 
-#include <deque>
+#include <vector>
+#include <memory>
 #include <algorithm>
 #include "TPCBase/CRU.h"
 #include "DataFormatsTPC/Defs.h"
@@ -36,6 +37,9 @@ class Digit;
 /// sorted into after amplification
 /// The structure assures proper sorting of the Digits when later on written out for further processing.
 /// This class holds the time bin containers.
+/// The time bins are kept in a circular buffer which only grows and is never shrunk. Time bin containers which
+/// have been written out are reset and kept in a pool to be reused for later time bins, avoiding the allocation
+/// of a full pad array for every new time bin.
 
 class DigitContainer
 {
@@ -76,14 +80,31 @@ class DigitContainer
   void fillOutputContainer(std::vector<Digit>& output, dataformats::MCTruthContainer<MCCompLabel>& mcTruth, std::vector<CommonMode>& commonModeOutput, const Sector& sector, TimeBin eventTimeBin = 0, bool isContinuous = true, bool finalFlush = false);
 
   /// Get the size of the container for one event
-  size_t size() const { return mTimeBins.size(); }
+  size_t size() const { return mNTimeBins; }
 
  private:
+  /// Access the time bin container at a given position relative to the first time bin
+  /// \param index Position relative to mFirstTimeBin
+  /// \return Reference to the slot in the circular buffer
+  std::unique_ptr<DigitTime>& getTimeBin(size_t index) { return mTimeBins[(mFirstSlot + index) % mTimeBins.size()]; }
+
+  /// Get a time bin container, either recycled from the pool or newly allocated
+  std::unique_ptr<DigitTime> acquireTimeBin();
+
+  /// Grow the circular buffer such that it can hold at least nTimeBins
+  void resizeTimeBins(size_t nTimeBins);
+
+  /// Remove the first nTimeBins from the circular buffer and move the used containers to the pool
+  void releaseTimeBins(size_t nTimeBins);
+
   TimeBin mFirstTimeBin = 0;                                  ///< First time bin to consider
   TimeBin mEffectiveTimeBin = 0;                              ///< Effective time bin of that digit
   TimeBin mTmaxTriggered = 0;                                 ///< Maximum time bin in case of triggered mode (hard cut at average drift speed with additional margin)
   TimeBin mOffset;                                            ///< Size of the container for one event
-  std::deque<DigitTime*> mTimeBins;                           ///< Time bin Container for the ADC value
+  size_t mFirstSlot = 0;                                      ///< Slot in the circular buffer corresponding to mFirstTimeBin
+  size_t mNTimeBins = 0;                                      ///< Number of time bins currently held in the circular buffer
+  std::vector<std::unique_ptr<DigitTime>> mTimeBins;          ///< Circular buffer of time bin containers for the ADC value
+  std::vector<std::unique_ptr<DigitTime>> mTimeBinPool;       ///< Reset time bin containers ready to be reused
   std::unique_ptr<DigitTime::PrevDigitInfoArray> mPrevDigArr; ///< Keep track of ToT and ion tail cumul from last time bin
   o2::utils::DebugStreamer mStreamer;                         ///< Debug streamer
 
@@ -99,18 +120,16 @@ inline DigitContainer::DigitContainer()
 
   // always have 50 % contingency for the size of the container depending on the input
   mOffset = static_cast<TimeBin>(detParam.TPCRecoWindowSim * detParam.TPClength / gasParam.DriftV / eleParam.ZbinWidth);
-  mTimeBins.resize(mOffset, nullptr);
+  resizeTimeBins(mOffset);
 }
 
 inline void DigitContainer::reset()
 {
   mFirstTimeBin = 0;
   mEffectiveTimeBin = 0;
-  for (auto& time : mTimeBins) {
-    if (time) {
-      time->reset();
-    }
-  }
+  releaseTimeBins(mNTimeBins);
+  mFirstSlot = 0;
+  resizeTimeBins(mOffset);
   if (mPrevDigArr) {
     std::fill(mPrevDigArr->begin(), mPrevDigArr->end(), PrevDigitInfo{});
   }
@@ -119,25 +138,67 @@ inline void DigitContainer::reset()
 inline void DigitContainer::reserve(TimeBin eventTimeBin)
 {
   const auto space = mOffset + eventTimeBin - mFirstTimeBin;
-  if (mTimeBins.size() < space) {
-    mTimeBins.resize(space);
+  resizeTimeBins(space);
+}
+
+inline std::unique_ptr<DigitTime> DigitContainer::acquireTimeBin()
+{
+  if (mTimeBinPool.empty()) {
+    return std::make_unique<DigitTime>();
+  }
+  auto time = std::move(mTimeBinPool.back());
+  mTimeBinPool.pop_back();
+  return time;
+}
+
+inline void DigitContainer::resizeTimeBins(size_t nTimeBins)
+{
+  if (nTimeBins <= mNTimeBins) {
+    return;
+  }
+  if (nTimeBins > mTimeBins.size()) {
+    // linearise the circular buffer into a larger one, keeping the order of the time bins
+    std::vector<std::unique_ptr<DigitTime>> timeBins(std::max(nTimeBins, 2 * mTimeBins.size()));
+    for (size_t i = 0; i < mNTimeBins; ++i) {
+      timeBins[i] = std::move(getTimeBin(i));
+    }
+    mTimeBins.swap(timeBins);
+    mFirstSlot = 0;
+  }
+  mNTimeBins = nTimeBins;
+}
+
+inline void DigitContainer::releaseTimeBins(size_t nTimeBins)
+{
+  nTimeBins = std::min(nTimeBins, mNTimeBins);
+  for (size_t i = 0; i < nTimeBins; ++i) {
+    auto& time = getTimeBin(i);
+    if (time) {
+      time->reset();
+      mTimeBinPool.emplace_back(std::move(time));
+    }
+  }
+  if (!mTimeBins.empty()) {
+    mFirstSlot = (mFirstSlot + nTimeBins) % mTimeBins.size();
   }
+  mNTimeBins -= nTimeBins;
 }
 
 inline void DigitContainer::addDigit(const MCCompLabel& label, const CRU& cru, TimeBin timeBin, GlobalPadNumber globalPad,
                                      float signal)
 {
   mEffectiveTimeBin = timeBin - mFirstTimeBin;
-  if (mEffectiveTimeBin >= mTimeBins.size()) {
+  if (mEffectiveTimeBin >= mNTimeBins) {
     // LOG(warning) << "Out of bound access to digit container .. dropping digit";
     return;
   }
 
-  if (mTimeBins[mEffectiveTimeBin] == nullptr) {
-    mTimeBins[mEffectiveTimeBin] = new DigitTime();
+  auto& time = getTimeBin(mEffectiveTimeBin);
+  if (!time) {
+    time = acquireTimeBin();
   }
 
-  mTimeBins[mEffectiveTimeBin]->addDigit(label, cru, globalPad, signal);
+  time->addDigit(label, cru, globalPad, signal);
 }
 
 } // namespace o2::tpc
@@ -194,6 +194,7 @@ inline void DigitGlobalPad::foldSignal(PrevDigitInfo& prevDigit, const int secto
 inline void DigitGlobalPad::reset()
 {
   mChargePad = 0;
+  mID = -1;
 }
 
 inline bool DigitGlobalPad::compareMClabels(const MCCompLabel& label1, const MCCompLabel& label2) const
@@ -46,7 +46,7 @@ class DigitTime
   /// Destructor
   ~DigitTime() = default;
 
-  /// Resets the container
+  /// Resets the container such that it can be reused for another time bin
   void reset();
 
   /// Get common mode for a given GEM stack
@@ -116,6 +116,8 @@ inline void DigitTime::reset()
     pad.reset();
   }
   mCommonMode.fill(0.f);
+  mDigitCounter = 0;
+  mLabels.clear();
 }
 
 inline float DigitTime::getCommonMode(const GEMstack& gemstack) const
@@ -83,7 +83,8 @@ void DigitContainer::fillOutputContainer(std::vector<Digit>& output,
     reportedSettings = true;
   }
 
-  for (auto& time : mTimeBins) {
+  for (size_t iTimeBin = 0; iTimeBin < mNTimeBins; ++iTimeBin) {
+    auto& time = getTimeBin(iTimeBin);
     /// the time bins between the last event and the timing of this event are uncorrelated and can be written out
     /// OR the readout is triggered (i.e. not continuous) and we can dump everything in any case, as long it is within one drift time interval
     if (!((nProcessedTimeBins + mFirstTimeBin < eventTimeBin) || !isContinuous || finalFlush)) {
@@ -96,7 +97,7 @@ void DigitContainer::fillOutputContainer(std::vector<Digit>& output,
 
     // fill also time bins without signal to get noise, ion tail and saturated signals
     if (needsEmptyTimeBins && !time) {
-      time = new DigitTime;
+      time = acquireTimeBin();
     }
 
     if (maxTimeBinForTimeFrame != -1 && timeBin >= maxTimeBinForTimeFrame) {
@@ -150,11 +151,7 @@ void DigitContainer::fillOutputContainer(std::vector<Digit>& output,
 
   if (nProcessedTimeBins > 0) {
     mFirstTimeBin += nProcessedTimeBins;
-    while (nProcessedTimeBins--) {
-      auto popped = mTimeBins.front();
-      mTimeBins.pop_front();
-      delete popped;
-    }
+    releaseTimeBins(nProcessedTimeBins);
   }
 }
 
@@ -167,5 +167,48 @@ BOOST_AUTO_TEST_CASE(DigitContainer_test2)
     BOOST_CHECK_CLOSE(commonMode[i].getCommonMode(), chargeSum[i] / nPads, 1E-6);
   }
 }
+/// \brief Test of the DigitContainer
+/// Digits are added to the same pad in two consecutive flushes of a continuous readout. The time bin containers
+/// written out in the first flush are recycled for the second one, so we check that no charge or MC labels leak
+BOOST_AUTO_TEST_CASE(DigitContainer_test3)
+{
+  auto& cdb = CDBInterface::instance();
+  cdb.setUseDefaults();
+  o2::conf::ConfigurableParam::updateFromString(fmt::format("TPCEleParam.DigiMode={}", (int)o2::tpc::DigitzationMode::PropagateADC)); // propagate the ADC values, otherwise the computation get complicated
+  const Mapper& mapper = Mapper::instance();
+  DigitContainer digitContainer;
+  digitContainer.reset();
+
+  const CRU cru(0);
+  const GlobalPadNumber globalPad = mapper.getPadNumberInROC(PadROCPos(cru.roc(), PadPos(12, 10)));
+  const MCCompLabel label1(22, 1, 0, false);
+  const MCCompLabel label2(7, 3, 0, false);
+  const TimeBin flushTimeBin = 100;
+
+  // first event, flushed up to the time bin of the next event
+  digitContainer.addDigit(label1, cru, 2, globalPad, 60);
+  std::vector<Digit> digits1;
+  std::vector<o2::tpc::CommonMode> commonMode1;
+  dataformats::MCTruthContainer<MCCompLabel> mcTruth1;
+  digitContainer.fillOutputContainer(digits1, mcTruth1, commonMode1, 0, flushTimeBin, true, false);
+  BOOST_CHECK(digits1.size() == 1);
+  BOOST_CHECK(digits1[0].getTimeStamp() == 2);
+  BOOST_CHECK(mcTruth1.getLabels(0).size() == 1);
+
+  // second event on the same pad, reusing the released time bin containers
+  digitContainer.reserve(flushTimeBin);
+  digitContainer.addDigit(label2, cru, flushTimeBin + 2, globalPad, 30);
+  std::vector<Digit> digits2;
+  std::vector<o2::tpc::CommonMode> commonMode2;
+  dataformats::MCTruthContainer<MCCompLabel> mcTruth2;
+  digitContainer.fillOutputContainer(digits2, mcTruth2, commonMode2, 0, flushTimeBin, true, true);
+  BOOST_CHECK(digits2.size() == 1);
+  BOOST_CHECK(digits2[0].getTimeStamp() == flushTimeBin + 2);
+  BOOST_CHECK_CLOSE(digits2[0].getChargeFloat(), 30.f, 1E-6);
+  const auto labels = mcTruth2.getLabels(0);
+  BOOST_CHECK(labels.size() == 1);
+  BOOST_CHECK(labels[0].getTrackID() == label2.getTrackID());
+  BOOST_CHECK(labels[0].getEventID() == label2.getEventID());
+}
 } // namespace tpc
 } // namespace o2
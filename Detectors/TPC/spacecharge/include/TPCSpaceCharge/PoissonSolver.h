@@ -241,6 +241,15 @@ class PoissonSolver
   void relax3D(Vector& matricesCurrentV, const Vector& matricesCurrentCharge, const int tnRRow, const int tnZColumn, const int iPhi, const int symmetry, const DataT h2, const DataT tempRatioZ,
                const std::vector<DataT>& coefficient1, const std::vector<DataT>& coefficient2, const std::vector<DataT>& coefficient3, const std::vector<DataT>& coefficient4) const;
 
+  /// Gauss-Seidel relaxation of the vertices of one colour in one phi slice
+  ///
+  /// The vertices of the other colour, including the neighbouring phi slices, are only read, so that different phi slices can be relaxed concurrently.
+  /// \param m phi slice which is relaxed
+  /// \param msw colour of the current red-black pass (1 or 2)
+  /// see relax3D for the other parameters
+  void relaxSlice3D(Vector& matricesCurrentV, const Vector& matricesCurrentCharge, const int tnRRow, const int tnZColumn, const int iPhi, const int m, const int msw, const int symmetry, const DataT h2,
+                    const DataT tempRatioZ, const std::vector<DataT>& coefficient1, const std::vector<DataT>& coefficient2, const std::vector<DataT>& coefficient3, const std::vector<DataT>& coefficient4) const;
+
   /// Relax2D
   ///
   ///    Relaxation operation for multiGrid
@@ -100,6 +100,7 @@ void PoissonSolver<DataT>::poissonMultiGrid2D(DataContainer& matricesV, const Da
   std::vector<Vector> tvChargeFMG(nLoop); // charge is restricted in full multiGrid
   std::vector<Vector> tvCharge(nLoop);    // charge <--> residue
   std::vector<Vector> tvResidue(nLoop);   // residue calculation
+  Vector prevArrayV;                      // potential of the previous cycle for the convergence check
 
   // Allocate memory for temporary grid
   for (int count = 1; count <= nLoop; ++count) {
@@ -165,7 +166,14 @@ void PoissonSolver<DataT>::poissonMultiGrid2D(DataContainer& matricesV, const Da
 
       // Do V cycle
       for (int mgCycle = 0; mgCycle < MGParameters::nMGCycle; ++mgCycle) {
+        // Copy the potential to temp array for convergence calculation
+        prevArrayV = tvArrayV[count];
         vCycle2D(count + 1, nLoop, MGParameters::nPre, MGParameters::nPost, gridSpacingR, ratioZ, tvArrayV, tvCharge, tvResidue);
+
+        /// if already converge just break move to finer grid
+        if (getConvergenceError(tvArrayV[count], prevArrayV) <= sConvergenceError) {
+          break;
+        }
       }
     }
   } else if (MGParameters::cycleType == CycleType::VCycle) {
@@ -177,7 +185,13 @@ void PoissonSolver<DataT>::poissonMultiGrid2D(DataContainer& matricesV, const Da
 
     // Do MGCycle
     for (int mgCycle = 0; mgCycle < MGParameters::nMGCycle; ++mgCycle) {
+      prevArrayV = tvArrayV[0];
       vCycle2D(gridFrom, gridTo, MGParameters::nPre, MGParameters::nPost, gridSpacingR, ratioZ, tvArrayV, tvCharge, tvResidue);
+
+      // if error already achieved then stop mg iteration
+      if (getConvergenceError(tvArrayV[0], prevArrayV) <= sConvergenceError) {
+        break;
+      }
     }
   } else if (MGParameters::cycleType == CycleType::WCycle) {
     // 3. W Cycle (TODO:)
@@ -1222,50 +1236,21 @@ void PoissonSolver<DataT>::relax3D(Vector& matricesCurrentV, const Vector& matri
 {
   // Gauss-Seidel (Read Black}
   if (MGParameters::relaxType == RelaxType::GaussSeidel) {
-    // for each slice
+    // in each pass only vertices of one colour are updated, which depend only on vertices of the other colour.
+    // The phi slices of one pass can therefore be relaxed in parallel. Only for periodic boundaries and an odd number of phi slices
+    // the first and the last slice are neighbours of the same colour: the last slice is then relaxed afterwards as in the sequential order
+    const bool relaxLastSliceAfter = (symmetry == 0) && (iPhi % 2);
+    const int nParallelSlices = relaxLastSliceAfter ? iPhi - 1 : iPhi;
     for (int iPass = 1; iPass <= 2; ++iPass) {
       const int msw = (iPass % 2) ? 1 : 2;
-      for (int m = 0; m < iPhi; ++m) {
-        const int jsw = ((msw + m) % 2) ? 1 : 2;
-        int mp1 = m + 1;
-        int signPlus = 1;
-        int mm1 = m - 1;
-        int signMinus = 1;
-        // Reflection symmetry in phi (e.g. symmetry at sector boundaries, or half sectors, etc.)
-        if (symmetry == 1) {
-          if (mp1 > iPhi - 1) {
-            mp1 = iPhi - 2;
-          }
-          if (mm1 < 0) {
-            mm1 = 1;
-          }
-        }
-        // Anti-symmetry in phi
-        else if (symmetry == -1) {
-          if (mp1 > iPhi - 1) {
-            mp1 = iPhi - 2;
-            signPlus = -1;
-          }
-          if (mm1 < 0) {
-            mm1 = 1;
-            signMinus = -1;
-          }
-        } else { // No Symmetries in phi, no boundaries, the calculation is continuous across all phi
-          if (mp1 > iPhi - 1) {
-            mp1 = m + 1 - iPhi;
-          }
-          if (mm1 < 0) {
-            mm1 = m - 1 + iPhi;
-          }
-        }
-        int isw = jsw;
-        for (int j = 1; j < tnZColumn - 1; ++j, isw = 3 - isw) {
-          for (int i = isw; i < tnRRow - 1; i += 2) {
-            (matricesCurrentV)(i, j, m) = (coefficient2[i] * (matricesCurrentV)(i - 1, j, m) + tempRatioZ * ((matricesCurrentV)(i, j - 1, m) + (matricesCurrentV)(i, j + 1, m)) + coefficient1[i] * (matricesCurrentV)(i + 1, j, m) + coefficient3[i] * (signPlus * (matricesCurrentV)(i, j, mp1) + signMinus * (matricesCurrentV)(i, j, mm1)) + (h2 * (matricesCurrentCharge)(i, j, m))) * coefficient4[i];
-          } // end cols
-        }   // end mParamGrid.NRVertices
-      }     // end phi
-    }       // end sweep
+#pragma omp parallel for num_threads(sNThreads)
+      for (int m = 0; m < nParallelSlices; ++m) {
+        relaxSlice3D(matricesCurrentV, matricesCurrentCharge, tnRRow, tnZColumn, iPhi, m, msw, symmetry, h2, tempRatioZ, coefficient1, coefficient2, coefficient3, coefficient4);
+      }
+      if (relaxLastSliceAfter) {
+        relaxSlice3D(matricesCurrentV, matricesCurrentCharge, tnRRow, tnZColumn, iPhi, iPhi - 1, msw, symmetry, h2, tempRatioZ, coefficient1, coefficient2, coefficient3, coefficient4);
+      }
+    } // end sweep
   } else if (MGParameters::relaxType == RelaxType::Jacobi) {
     // for each slice
     for (int m = 0; m < iPhi; ++m) {
@@ -1314,6 +1299,63 @@ void PoissonSolver<DataT>::relax3D(Vector& matricesCurrentV, const Vector& matri
   }
 }
 
+template <typename DataT>
+void PoissonSolver<DataT>::relaxSlice3D(Vector& matricesCurrentV, const Vector& matricesCurrentCharge, const int tnRRow, const int tnZColumn, const int iPhi, const int m, const int msw, const int symmetry,
+                                        const DataT h2, const DataT tempRatioZ, const std::vector<DataT>& coefficient1, const std::vector<DataT>& coefficient2, const std::vector<DataT>& coefficient3,
+                                        const std::vector<DataT>& coefficient4) const
+{
+  const int jsw = ((msw + m) % 2) ? 1 : 2;
+  int mp1 = m + 1;
+  int signPlus = 1;
+  int mm1 = m - 1;
+  int signMinus = 1;
+  // Reflection symmetry in phi (e.g. symmetry at sector boundaries, or half sectors, etc.)
+  if (symmetry == 1) {
+    if (mp1 > iPhi - 1) {
+      mp1 = iPhi - 2;
+    }
+    if (mm1 < 0) {
+      mm1 = 1;
+    }
+  }
+  // Anti-symmetry in phi
+  else if (symmetry == -1) {
+    if (mp1 > iPhi - 1) {
+      mp1 = iPhi - 2;
+      signPlus = -1;
+    }
+    if (mm1 < 0) {
+      mm1 = 1;
+      signMinus = -1;
+    }
+  } else { // No Symmetries in phi, no boundaries, the calculation is continuous across all phi
+    if (mp1 > iPhi - 1) {
+      mp1 = m + 1 - iPhi;
+    }
+    if (mm1 < 0) {
+      mm1 = m - 1 + iPhi;
+    }
+  }
+
+  const DataT* coeff1 = coefficient1.data();
+  const DataT* coeff2 = coefficient2.data();
+  const DataT* coeff3 = coefficient3.data();
+  const DataT* coeff4 = coefficient4.data();
+  int isw = jsw;
+  for (int j = 1; j < tnZColumn - 1; ++j, isw = 3 - isw) {
+    // the vertices in r direction are contiguous in memory: use plain pointers to the rows to allow vectorisation of the inner loop
+    DataT* pot = &matricesCurrentV(0, j, m);
+    const DataT* potZMinus = &matricesCurrentV(0, j - 1, m);
+    const DataT* potZPlus = &matricesCurrentV(0, j + 1, m);
+    const DataT* potPhiPlus = &matricesCurrentV(0, j, mp1);
+    const DataT* potPhiMinus = &matricesCurrentV(0, j, mm1);
+    const DataT* charge = &matricesCurrentCharge(0, j, m);
+    for (int i = isw; i < tnRRow - 1; i += 2) {
+      pot[i] = (coeff2[i] * pot[i - 1] + tempRatioZ * (potZMinus[i] + potZPlus[i]) + coeff1[i] * pot[i + 1] + coeff3[i] * (signPlus * potPhiPlus[i] + signMinus * potPhiMinus[i]) + (h2 * charge[i])) * coeff4[i];
+    } // end cols
+  }   // end mParamGrid.NRVertices
+}
+
 template <typename DataT>
 void PoissonSolver<DataT>::relax2D(Vector& matricesCurrentV, const Vector& matricesCurrentCharge, const int tnRRow, const int tnZColumn, const DataT h2, const DataT tempFourth, const DataT tempRatio,
                                    std::vector<DataT>& coefficient1, std::vector<DataT>& coefficient2)
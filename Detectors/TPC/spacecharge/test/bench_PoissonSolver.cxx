@@ -0,0 +1,79 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  bench_PoissonSolver.cxx
+/// \brief benchmark of the poisson solver for the standard 129x129x180 grid
+///
+/// The first argument is the number of threads, the second one switches between the full 3D (1) and the 3D2D (0) multigrid
+
+#include "benchmark/benchmark.h"
+#include "Framework/Logger.h"
+#include "TPCSpaceCharge/PoissonSolver.h"
+#include "TPCSpaceCharge/PoissonSolverHelpers.h"
+#include "TPCSpaceCharge/SpaceChargeHelpers.h"
+#include "TPCSpaceCharge/DataContainer3D.h"
+
+using namespace o2::tpc;
+
+using DataT = double;
+static constexpr unsigned short NR = 129;   // grid in r
+static constexpr unsigned short NZ = 129;   // grid in z
+static constexpr unsigned short NPHI = 180; // grid in phi
+
+static void BM_PoissonSolver3D(benchmark::State& state)
+{
+  fair::Logger::SetConsoleSeverity(fair::Severity::warning);
+  using GridProp = GridProperties<DataT>;
+  const ParamSpaceCharge params{NR, NZ, NPHI};
+  const RegularGrid3D<DataT> grid3D{GridProp::ZMIN, GridProp::RMIN, GridProp::PHIMIN, GridProp::getGridSpacingZ(NZ), GridProp::getGridSpacingR(NR), GridProp::getGridSpacingPhi(NPHI), params};
+
+  // charge density and boundary potential from the analytical formulas
+  const AnalyticalFields<DataT> analyticalFields;
+  DataContainer3D<DataT> charge(NZ, NR, NPHI);
+  DataContainer3D<DataT> boundary(NZ, NR, NPHI);
+  for (size_t iPhi = 0; iPhi < NPHI; ++iPhi) {
+    const DataT phi = grid3D.getPhiVertex(iPhi);
+    for (size_t iR = 0; iR < NR; ++iR) {
+      const DataT radius = grid3D.getRVertex(iR);
+      for (size_t iZ = 0; iZ < NZ; ++iZ) {
+        const DataT z = grid3D.getZVertex(iZ);
+        charge(iZ, iR, iPhi) = analyticalFields.evalDensity(z, radius, phi);
+        if (iR == 0 || iZ == 0 || iR == NR - 1 || iZ == NZ - 1) {
+          boundary(iZ, iR, iPhi) = analyticalFields.evalPotential(z, radius, phi);
+        }
+      }
+    }
+  }
+
+  PoissonSolver<DataT>::setNThreads(state.range(0));
+  MGParameters::isFull3D = state.range(1);
+  PoissonSolver<DataT> poissonSolver(grid3D);
+  for (auto _ : state) {
+    state.PauseTiming();
+    DataContainer3D<DataT> potential = boundary;
+    state.ResumeTiming();
+    poissonSolver.poissonSolver3D(potential, charge, 0);
+    benchmark::DoNotOptimize(potential);
+  }
+}
+
+static void CustomArguments(benchmark::internal::Benchmark* bench)
+{
+  for (int isFull3D = 1; isFull3D >= 0; --isFull3D) {
+    for (int nThreads = 1; nThreads <= 16; nThreads *= 2) {
+      bench->Args({nThreads, isFull3D});
+    }
+  }
+}
+
+BENCHMARK(BM_PoissonSolver3D)->Apply(CustomArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
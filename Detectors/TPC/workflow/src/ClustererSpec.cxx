@@ -15,11 +15,13 @@
 /// @brief  spec definition for a TPC clusterer process
 
 #include "TPCWorkflow/ClustererSpec.h"
+#include "Framework/ConfigParamRegistry.h"
 #include "Framework/ControlService.h"
 #include "Framework/InputRecordWalker.h"
 #include "Headers/DataHeader.h"
 #include "DataFormatsTPC/Digit.h"
 #include "TPCReconstruction/HwClusterer.h"
+#include "TPCReconstruction/HwClustererParallel.h"
 #include "TPCBase/Sector.h"
 #include "DataFormatsTPC/TPCSectorHeader.h"
 #include "SimulationDataFormat/MCTruthContainer.h"
@@ -51,6 +53,7 @@ DataProcessorSpec getClustererSpec(bool sendMC)
     std::vector<o2::tpc::ClusterHardwareContainer8kb> clusterArray;
     MCLabelContainer mctruthArray;
     std::array<std::shared_ptr<o2::tpc::HwClusterer>, NSectors> clusterers;
+    std::unique_ptr<o2::tpc::HwClustererParallel> parallelClusterer; // used for more than one thread
     int verbosity = 1;
     bool sendMC = false;
   };
@@ -62,6 +65,12 @@ DataProcessorSpec getClustererSpec(bool sendMC)
     // parameter to the clusterer processing function.
     auto processAttributes = std::make_shared<ProcessAttributes>();
     processAttributes->sendMC = sendMC;
+    const int nThreads = ic.options().get<int>("nthreads");
+    if (nThreads > 1) {
+      processAttributes->parallelClusterer = std::make_unique<o2::tpc::HwClustererParallel>(sendMC);
+      processAttributes->parallelClusterer->init();
+      processAttributes->parallelClusterer->setNThreads(nThreads);
+    }
 
     auto processSectorFunction = [processAttributes](ProcessingContext& pc, DataRef const& dataref, DataRef const& mclabelref) {
       auto& clusterArray = processAttributes->clusterArray;
@@ -140,11 +149,56 @@ DataProcessorSpec getClustererSpec(bool sendMC)
       }
     };
 
-    auto processingFct = [processAttributes, processSectorFunction](ProcessingContext& pc) {
-      struct SectorInputDesc {
-        DataRef dataref;
-        DataRef mclabelref;
-      };
+    struct SectorInputDesc {
+      DataRef dataref;
+      DataRef mclabelref;
+    };
+
+    // process all sectors of the inputs concurrently, the output being sent per sector as in the sequential case
+    auto processSectorsParallel = [processAttributes](ProcessingContext& pc, std::map<int, SectorInputDesc> const& inputs) {
+      auto& parallelClusterer = *processAttributes->parallelClusterer;
+      auto& verbosity = processAttributes->verbosity;
+      o2::tpc::HwClustererParallel::SectorDigits digits;
+      o2::tpc::HwClustererParallel::SectorLabels labels;
+      for (auto const& input : inputs) {
+        if (input.first < 0) {
+          continue;
+        }
+        digits[input.first] = pc.inputs().get<gsl::span<o2::tpc::Digit>>(input.second.dataref);
+        if (DataRefUtils::isValid(input.second.mclabelref)) {
+          labels[input.first] = pc.inputs().get<gsl::span<char>>(input.second.mclabelref);
+        }
+      }
+      // the sectors without input are processed with empty digits, which only clears their output
+      parallelClusterer.finishProcess(digits, processAttributes->sendMC ? &labels : nullptr);
+
+      for (auto const& input : inputs) {
+        const int sector = input.first;
+        if (sector < 0) {
+          continue;
+        }
+        auto const* sectorHeader = DataRefUtils::getHeader<o2::tpc::TPCSectorHeader*>(input.second.dataref);
+        auto const* dataHeader = DataRefUtils::getHeader<o2::header::DataHeader*>(input.second.dataref);
+        o2::header::DataHeader::SubSpecificationType fanSpec = dataHeader->subSpecification;
+        const auto& clusterArray = parallelClusterer.getClusters(sector);
+        if (verbosity > 0) {
+          LOG(info) << "clusterer produced "
+                    << std::accumulate(clusterArray.begin(), clusterArray.end(), size_t(0), [](size_t l, auto const& r) { return l + r.getContainer()->numberOfClusters; })
+                    << " cluster(s)"
+                    << " for sector " << sector
+                    << " total size " << sizeof(ClusterHardwareContainer8kb) * clusterArray.size();
+        }
+        auto outputPages = pc.outputs().make<ClusterHardwareContainer8kb>(Output{gDataOriginTPC, "CLUSTERHW", fanSpec, {*sectorHeader}}, clusterArray.size());
+        std::copy(clusterArray.begin(), clusterArray.end(), outputPages.begin());
+        if (DataRefUtils::isValid(input.second.mclabelref)) {
+          ConstMCLabelContainer mcflat;
+          parallelClusterer.getLabels(sector)->flatten_to(mcflat);
+          pc.outputs().snapshot(Output{gDataOriginTPC, "CLUSTERHWMCLBL", fanSpec, {*sectorHeader}}, mcflat);
+        }
+      }
+    };
+
+    auto processingFct = [processAttributes, processSectorFunction, processSectorsParallel](ProcessingContext& pc) {
       // loop over all inputs and their parts and associate data with corresponding mc truth data
       // by the subspecification
       std::map<int, SectorInputDesc> inputs;
@@ -170,7 +224,13 @@ DataProcessorSpec getClustererSpec(bool sendMC)
         if (processAttributes->sendMC && !DataRefUtils::isValid(input.second.mclabelref)) {
           throw std::runtime_error("missing the required MC label data for sector " + std::to_string(input.first));
         }
-        processSectorFunction(pc, input.second.dataref, input.second.mclabelref);
+        // with several threads, only the control information is handled sector by sector
+        if (!processAttributes->parallelClusterer || input.first < 0) {
+          processSectorFunction(pc, input.second.dataref, input.second.mclabelref);
+        }
+      }
+      if (processAttributes->parallelClusterer) {
+        processSectorsParallel(pc, inputs);
       }
     };
     return processingFct;
@@ -203,7 +263,8 @@ DataProcessorSpec getClustererSpec(bool sendMC)
   return DataProcessorSpec{processorName,
                            {createInputSpecs(sendMC)},
                            {createOutputSpecs(sendMC)},
-                           AlgorithmSpec(initFunction)};
+                           AlgorithmSpec(initFunction),
+                           Options{{"nthreads", VariantType::Int, 1, {"number of threads to process the sectors of a TF concurrently"}}}};
 }
 
 } // namespace tpc
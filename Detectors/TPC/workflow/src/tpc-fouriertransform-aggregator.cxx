@@ -27,6 +27,7 @@ void customize(std::vector<ConfigParamSpec>& workflowOptions)
     {"rangeIDC", VariantType::Int, 200, {"Number of 1D-IDCs which will be used for the calculation of the fourier coefficients. TODO ALREADY SET IN ABERAGEGROUP"}},
     {"nFourierCoeff", VariantType::Int, 60, {"Number of fourier coefficients (real+imag) which will be stored in the CCDB. The maximum can be 'rangeIDC + 2'."}},
     {"nthreads", VariantType::Int, 1, {"Number of threads which will be used during the calculation of the fourier coefficients."}},
+    {"fft-batch-size", VariantType::Int, 0, {"Number of intervals which are transformed with one FFTW many-transform plan (0 or 1: one plan per interval)."}},
     {"inputLanes", VariantType::Int, 2, {"Number of expected input lanes."}},
     {"sendOutput", VariantType::Bool, false, {"send fourier coefficients"}},
     {"use-naive-fft", VariantType::Bool, false, {"using naive fourier transform (true) or FFTW (false)"}},
@@ -54,6 +55,7 @@ WorkflowSpec defineDataProcessing(ConfigContext const& config)
   const auto nthreadsFourier = static_cast<unsigned long>(config.options().get<int>("nthreads"));
   TPCFourierTransformAggregatorSpec::IDCFType::setNThreads(nthreadsFourier);
   TPCFourierTransformAggregatorSpec::IDCFType::setFFT(!fft);
+  TPCFourierTransformAggregatorSpec::IDCFType::setBatchSize(static_cast<unsigned int>(std::max(config.options().get<int>("fft-batch-size"), 0)));
   const auto inputLanes = config.options().get<int>("inputLanes");
   WorkflowSpec workflow{getTPCFourierTransformAggregatorSpec(rangeIDC, nFourierCoeff, sendOutput, processSACs, inputLanes)};
   return workflow;
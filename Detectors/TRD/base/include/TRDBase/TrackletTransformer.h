@@ -16,6 +16,11 @@
 #include "DataFormatsTRD/Tracklet64.h"
 #include "DataFormatsTRD/CalibratedTracklet.h"
 #include "DataFormatsTRD/CalVdriftExB.h"
+#include "DataFormatsTRD/Constants.h"
+
+#include <gsl/span>
+#include <array>
+#include <vector>
 
 namespace o2
 {
@@ -25,13 +30,30 @@ namespace trd
 class TrackletTransformer
 {
  public:
+  /// Per-chamber quantities used by the batched transformation, they only depend on the
+  /// geometry and on the drift velocity and ExB calibration of the chamber
+  struct ChamberTable {
+    std::array<double, 12> matrixL2T{};          ///< components of the inverse of the T2L matrix, row by row with the translation last
+    std::array<float, constants::NROWC1> rowZ{}; ///< local z of each pad row, as given by calculateZ()
+    double driftTimeBins{0.};                    ///< (cdrHght / vDrift) * 10, number of time bins in the drift region
+    double padWidth{0.};                         ///< width of the inner pads
+    double lorentzCorrection{0.};                ///< tan(ExB) * xAnode
+    bool inGeometry{false};                      ///< flag whether the chamber is part of the geometry
+  };
+
   TrackletTransformer() = default;
   ~TrackletTransformer() = default;
 
   void init();
 
-  void setCalVdriftExB(const CalVdriftExB* cal) { mCalVdriftExB = cal; };
+  void setCalVdriftExB(const CalVdriftExB* cal)
+  {
+    mCalVdriftExB = cal;
+    mChamberTablesValid = false;
+  };
   void setApplyXOR() { mApplyXOR = true; }
+  void setNumberOfThreads(int n) { mNumThreads = n > 1 ? n : 1; }
+  int getNumberOfThreads() const { return mNumThreads; }
   void setApplyShift(bool f) { mApplyShift = f; }
   bool isShiftApplied() const { return mApplyShift; }
 
@@ -45,9 +67,29 @@ class TrackletTransformer
 
   CalibratedTracklet transformTracklet(Tracklet64 tracklet, bool trackingFrame = true) const;
 
+  /// Fill the per-chamber tables for the current geometry and calibration. This is done
+  /// automatically by transformTracklets() when the calibration object has been changed
+  void prepareChamberTables();
+  const std::vector<ChamberTable>& getChamberTables() const { return mChamberTables; }
+
+  /// Transform the tracklets of a whole TF using the per-chamber tables, with mNumThreads threads.
+  /// The results are the same as the ones from transformTracklet().
+  /// \param tracklets input tracklets
+  /// \param calibratedTracklets output, must have the same size as the input
+  /// \param trackingFrame if false, the calibrated tracklets are given in the local chamber frame
+  void transformTracklets(gsl::span<const Tracklet64> tracklets, gsl::span<CalibratedTracklet> calibratedTracklets, bool trackingFrame = true);
+
+  /// Same as above for the tracklets with the given indices only, the other output entries are not modified (none if indices is empty)
+  void transformTracklets(gsl::span<const Tracklet64> tracklets, gsl::span<CalibratedTracklet> calibratedTracklets, gsl::span<const int> indices, bool trackingFrame = true);
+
   double getTimebin(int detector, double x) const;
 
  private:
+  /// check the output size and prepare the chamber tables if needed, return false if the tracklets cannot be transformed
+  bool checkTransformTracklets(size_t nTracklets, size_t nCalibratedTracklets);
+
+  CalibratedTracklet transformTrackletFromTable(const Tracklet64& tracklet, bool trackingFrame) const;
+
   Geometry* mGeo{nullptr};
   bool mApplyXOR{false};
   bool mApplyShift{true};
@@ -55,6 +97,11 @@ class TrackletTransformer
   float mXAnode;
 
   const CalVdriftExB* mCalVdriftExB{nullptr};
+
+  std::vector<ChamberTable> mChamberTables; ///< per-chamber tables for the batched transformation
+  bool mChamberTablesValid{false};          ///< flag whether the tables correspond to the current calibration
+  float mCalibratedX{0.};                   ///< calibrated local x of the tracklets, the same for all chambers
+  int mNumThreads{1};                       ///< number of threads for the batched transformation
 };
 
 } // namespace trd
@@ -25,6 +25,7 @@ void TrackletTransformer::init()
 
   // 3.35 cm
   mXAnode = mGeo->cdrHght() + mGeo->camHght() / 2;
+  mChamberTablesValid = false;
 }
 
 float TrackletTransformer::calculateZ(int padrow, const PadPlane* padPlane) const
@@ -121,6 +122,107 @@ CalibratedTracklet TrackletTransformer::transformTracklet(Tracklet64 tracklet, b
   }
 }
 
+void TrackletTransformer::prepareChamberTables()
+{
+  if (!mGeo || !mCalVdriftExB) {
+    LOG(error) << "TrackletTransformer not initialised or no calibration available, cannot prepare the chamber tables";
+    return;
+  }
+  mChamberTables.resize(MAXCHAMBER);
+  for (int detector = 0; detector < MAXCHAMBER; ++detector) {
+    auto& table = mChamberTables[detector];
+    table.inGeometry = mGeo->chamberInGeometry(detector);
+    if (!table.inGeometry) {
+      continue;
+    }
+    // the inverse matrix is what is applied in transformL2T() for each space point
+    mGeo->getMatrixT2L(detector).Inverse().GetComponents(table.matrixL2T.begin());
+    const auto padPlane = mGeo->getPadPlane(detector);
+    table.rowZ.fill(0.f);
+    for (int padrow = 0; padrow < padPlane->getNrows(); ++padrow) {
+      table.rowZ[padrow] = calculateZ(padrow, padPlane);
+    }
+    // same operations as in calculateDy(), the slope dependent part is done per tracklet
+    float vDrift = mCalVdriftExB->getVdrift(detector);
+    float exb = mCalVdriftExB->getExB(detector);
+    table.driftTimeBins = (mGeo->cdrHght() / vDrift) * 10.;
+    table.padWidth = padPlane->getWidthIPad();
+    table.lorentzCorrection = TMath::Tan(exb) * mXAnode;
+  }
+  float x = mGeo->cdrHght() - 0.5;
+  mCalibratedX = calibrateX(x);
+  mChamberTablesValid = true;
+}
+
+CalibratedTracklet TrackletTransformer::transformTrackletFromTable(const Tracklet64& tracklet, bool trackingFrame) const
+{
+  const auto& table = mChamberTables[tracklet.getDetector()];
+  int slope;
+  if (mApplyXOR) {
+    slope = tracklet.getSlope() ^ 0x80;
+    if (slope & (1 << (constants::NBITSTRKLSLOPE - 1))) {
+      slope = -((~(slope - 1)) & ((1 << constants::NBITSTRKLSLOPE) - 1));
+    }
+  } else {
+    slope = tracklet.getSlopeBinSigned();
+  }
+
+  float y = tracklet.getUncalibratedY(mApplyShift);
+  float z = table.rowZ[tracklet.getPadRow()];
+  double rawDy = slope * table.driftTimeBins * table.padWidth * GRANULARITYTRKLSLOPE / ADDBITSHIFTSLOPE;
+  float dy = rawDy - table.lorentzCorrection;
+
+  if (trackingFrame) {
+    const auto& m = table.matrixL2T;
+    double xLoc = mCalibratedX, yLoc = y, zLoc = z;
+    return CalibratedTracklet(m[0] * xLoc + m[1] * yLoc + m[2] * zLoc + m[3],
+                              m[4] * xLoc + m[5] * yLoc + m[6] * zLoc + m[7],
+                              m[8] * xLoc + m[9] * yLoc + m[10] * zLoc + m[11], dy);
+  } else {
+    return CalibratedTracklet(mCalibratedX, y, z, dy); // local frame
+  }
+}
+
+bool TrackletTransformer::checkTransformTracklets(size_t nTracklets, size_t nCalibratedTracklets)
+{
+  if (nCalibratedTracklets != nTracklets) {
+    LOG(error) << "Output size " << nCalibratedTracklets << " differs from the number of tracklets " << nTracklets;
+    return false;
+  }
+  if (!mChamberTablesValid) {
+    prepareChamberTables();
+  }
+  return mChamberTablesValid;
+}
+
+void TrackletTransformer::transformTracklets(gsl::span<const Tracklet64> tracklets, gsl::span<CalibratedTracklet> calibratedTracklets, bool trackingFrame)
+{
+  if (!checkTransformTracklets(tracklets.size(), calibratedTracklets.size())) {
+    return;
+  }
+  // each tracklet is independent, the output does not depend on the number of threads
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) num_threads(mNumThreads)
+#endif
+  for (int iTrklt = 0; iTrklt < (int)tracklets.size(); ++iTrklt) {
+    calibratedTracklets[iTrklt] = transformTrackletFromTable(tracklets[iTrklt], trackingFrame);
+  }
+}
+
+void TrackletTransformer::transformTracklets(gsl::span<const Tracklet64> tracklets, gsl::span<CalibratedTracklet> calibratedTracklets, gsl::span<const int> indices, bool trackingFrame)
+{
+  if (indices.empty() || !checkTransformTracklets(tracklets.size(), calibratedTracklets.size())) {
+    return;
+  }
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) num_threads(mNumThreads)
+#endif
+  for (int i = 0; i < (int)indices.size(); ++i) {
+    const auto iTrklt = indices[i];
+    calibratedTracklets[iTrklt] = transformTrackletFromTable(tracklets[iTrklt], trackingFrame);
+  }
+}
+
 double TrackletTransformer::getTimebin(int detector, double x) const
 {
   // calculate timebin from x position within chamber
@@ -0,0 +1,163 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file testTrackletTransformer.cxx
+/// \brief Test the batched tracklet transformation against the per-tracklet one
+
+#define BOOST_TEST_MODULE Test TrackletTransformer
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "DataFormatsTRD/CalVdriftExB.h"
+#include "DataFormatsTRD/CalibratedTracklet.h"
+#include "DataFormatsTRD/Constants.h"
+#include "DataFormatsTRD/Tracklet64.h"
+#include "TRDBase/Geometry.h"
+#include "TRDBase/TrackletTransformer.h"
+
+#include <TGeoManager.h>
+#include <TGeoMaterial.h>
+#include <TGeoMatrix.h>
+#include <TGeoMedium.h>
+#include <TMath.h>
+
+#include <random>
+#include <vector>
+
+namespace o2
+{
+namespace trd
+{
+
+using namespace o2::trd::constants;
+
+// Skeleton of the TRD volume hierarchy with the node names expected by Geometry::addAlignableVolumes()
+// and Geometry::fillMatrixCache(), each chamber being placed with its own translation and rotation
+void createSkeletonGeometry()
+{
+  if (gGeoManager) {
+    return;
+  }
+  new TGeoManager("TRDSkeleton", "skeleton of the TRD geometry");
+  auto vacuum = new TGeoMedium("Vacuum", 1, new TGeoMaterial("Vacuum", 0, 0, 0));
+  auto top = gGeoManager->MakeBox("ALIC", vacuum, 1000., 1000., 1000.);
+  gGeoManager->SetTopVolume(top);
+  auto barrel = gGeoManager->MakeBox("barrel", vacuum, 900., 900., 900.);
+  top->AddNode(barrel, 1);
+  auto b077 = gGeoManager->MakeBox("B077", vacuum, 800., 800., 800.);
+  barrel->AddNode(b077, 1);
+
+  // the 4 variants of the inner super module volume, with 30 chambers each
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+  TGeoVolume* utr[4];
+  for (int iv = 0; iv < 4; iv++) {
+    utr[iv] = gGeoManager->MakeBox(Form("UTR%d", iv + 1), vacuum, 100., 100., 400.);
+    auto uts = gGeoManager->MakeBox(Form("UTS%d", iv + 1), vacuum, 100., 100., 400.);
+    auto uti = gGeoManager->MakeBox(Form("UTI%d", iv + 1), vacuum, 100., 100., 400.);
+    utr[iv]->AddNode(uts, 1);
+    uts->AddNode(uti, 1);
+    for (int idet = 0; idet < NLAYER * NSTACK; idet++) {
+      auto chamber = gGeoManager->MakeBox(Form("UT%02d", idet), vacuum, 1., 1., 1.);
+      const int layer = idet % NLAYER, stack = idet / NLAYER;
+      auto rotation = new TGeoRotation("", 90. + uniform(generator), 90. + uniform(generator), uniform(generator));
+      uti->AddNode(chamber, 1, new TGeoCombiTrans(uniform(generator), -60. + 13. * layer + uniform(generator), -240. + 120. * stack + uniform(generator), rotation));
+    }
+  }
+  for (int isector = 0; isector < NSECTOR; isector++) {
+    const double sectorAngle = 20. * isector + 10.;
+    auto segment = gGeoManager->MakeBox(Form("BSEGMO%d", isector), vacuum, 100., 100., 400.);
+    auto btrd = gGeoManager->MakeBox(Form("BTRD%d", isector), vacuum, 100., 100., 400.);
+    const double r = 330.;
+    auto rotation = new TGeoRotation("", sectorAngle + 90., 0., 0.);
+    b077->AddNode(segment, 1, new TGeoCombiTrans(r * TMath::Cos(sectorAngle * TMath::DegToRad()), r * TMath::Sin(sectorAngle * TMath::DegToRad()), 0., rotation));
+    segment->AddNode(btrd, 1);
+    const int variant = isector == 17 ? 3 : (isector >= 13 && isector <= 15 ? 2 : (isector == 11 || isector == 12 ? 1 : 0));
+    btrd->AddNode(utr[variant], 1);
+  }
+  gGeoManager->CloseGeometry();
+  Geometry::instance()->addAlignableVolumes();
+}
+
+BOOST_AUTO_TEST_CASE(TrackletTransformer_batched)
+{
+  createSkeletonGeometry();
+  TrackletTransformer transformer;
+  transformer.init();
+
+  std::mt19937 generator(4321);
+  std::uniform_real_distribution<float> uniform(0.f, 1.f);
+  CalVdriftExB calibration;
+  for (int idet = 0; idet < MAXCHAMBER; idet++) {
+    calibration.setVdrift(idet, 1.3f + 0.4f * uniform(generator));
+    calibration.setExB(idet, -0.2f + 0.1f * uniform(generator));
+  }
+  transformer.setCalVdriftExB(&calibration);
+  transformer.prepareChamberTables();
+  const auto& tables = transformer.getChamberTables();
+  BOOST_REQUIRE_EQUAL((int)tables.size(), MAXCHAMBER);
+  std::vector<int> chambers;
+  for (int idet = 0; idet < MAXCHAMBER; idet++) {
+    if (tables[idet].inGeometry) {
+      chambers.push_back(idet);
+    }
+  }
+  BOOST_REQUIRE_EQUAL((int)chambers.size(), NCHAMBER);
+
+  // random tracklets in all the chambers present in the geometry
+  std::vector<Tracklet64> tracklets;
+  for (int i = 0; i < 5000; i++) {
+    const int detector = chambers[i % chambers.size()];
+    const int hcid = 2 * detector + (uniform(generator) < 0.5f);
+    const int nRows = Geometry::getStack(detector) == 2 ? NROWC0 : NROWC1;
+    tracklets.emplace_back(1, hcid, int(nRows * uniform(generator)), int(4 * uniform(generator)),
+                           int((1 << NBITSTRKLPOS) * uniform(generator)), int((1 << NBITSTRKLSLOPE) * uniform(generator)), 0, 0, 0);
+  }
+  std::vector<int> indices;
+  for (int i = 0; i < (int)tracklets.size(); i += 3) {
+    indices.push_back(i);
+  }
+
+  for (bool applyXOR : {false, true}) {
+    if (applyXOR) {
+      transformer.setApplyXOR();
+    }
+    for (bool trackingFrame : {true, false}) {
+      std::vector<CalibratedTracklet> expected;
+      for (const auto& tracklet : tracklets) {
+        expected.push_back(transformer.transformTracklet(tracklet, trackingFrame));
+      }
+      for (int nThreads : {1, 4}) {
+        transformer.setNumberOfThreads(nThreads);
+        std::vector<CalibratedTracklet> calibrated(tracklets.size());
+        transformer.transformTracklets(tracklets, calibrated, trackingFrame);
+        const CalibratedTracklet untouched(-999.f, -999.f, -999.f, -999.f);
+        std::vector<CalibratedTracklet> selected(tracklets.size(), untouched);
+        transformer.transformTracklets(tracklets, selected, indices, trackingFrame);
+        for (size_t i = 0; i < tracklets.size(); i++) {
+          BOOST_CHECK_SMALL(calibrated[i].getX() - expected[i].getX(), 1e-3f);
+          BOOST_CHECK_SMALL(calibrated[i].getY() - expected[i].getY(), 1e-3f);
+          BOOST_CHECK_SMALL(calibrated[i].getZ() - expected[i].getZ(), 1e-3f);
+          BOOST_CHECK_SMALL(calibrated[i].getDy() - expected[i].getDy(), 1e-4f);
+          const auto& reference = i % 3 ? untouched : calibrated[i];
+          BOOST_CHECK_EQUAL(selected[i].getX(), reference.getX());
+          BOOST_CHECK_EQUAL(selected[i].getY(), reference.getY());
+          BOOST_CHECK_EQUAL(selected[i].getZ(), reference.getZ());
+          BOOST_CHECK_EQUAL(selected[i].getDy(), reference.getDy());
+        }
+      }
+    }
+  }
+}
+
+} // namespace trd
+} // namespace o2
@@ -100,6 +100,10 @@ class CruRawReader
   // reset the event storage and the counters
   void reset();
 
+  // take over the data and the counters of another reader, e.g. one which decoded other HBFs of the same TF on another thread
+  // the event records of the other reader are appended to the ones of this reader and the other reader is reset
+  void merge(CruRawReader& other);
+
   // the parsing starts here, payload from all available RDHs is copied into mHBFPayload and afterwards processHalfCRU() is called
   // returns the total number of bytes read, including RDH header
   int processHBFs();
@@ -64,6 +64,9 @@ class EventRecord
   void incTime(float duration) { mTimeTaken += duration; }
   void setIsCalibTrigger() { mIsCalibTrigger = true; }
 
+  // append the data and the counters of the same trigger read by another raw reader
+  void merge(const EventRecord& other);
+
  private:
   BCData mBCData;                       /// orbit and Bunch crossing data of the physics trigger
   std::vector<Digit> mDigits{};         /// digit data, for this event
@@ -111,6 +114,9 @@ class EventRecordContainer
   void reset();
   void accumulateStats();
 
+  // append the event records and the statistics of another container, events of already known triggers are merged
+  void merge(const EventRecordContainer& other);
+
  private:
   int mCurrEventRecord = 0;
   std::vector<EventRecord> mEventRecords;
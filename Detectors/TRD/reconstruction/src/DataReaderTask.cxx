@@ -26,6 +26,12 @@
 #include "DataFormatsCTP/TriggerOffsetsParam.h"
 #include "DataFormatsTRD/Constants.h"
 
+#include <algorithm>
+
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 namespace o2::trd
 {
 
@@ -39,6 +45,30 @@ void DataReaderTask::init(InitContext& ic)
   }
   mReader.configure(mTrackletHCHeaderState, mHalfChamberWords, mHalfChamberMajor, mOptions);
   mProcessEveryNthTF = ic.options().get<int>("every-nth-tf");
+
+#ifdef WITH_OPENMP
+  int askedThreads = ic.options().get<int>("nthreads");
+  int maxThreads = omp_get_max_threads();
+  if (askedThreads < 0) {
+    mNumThreads = maxThreads;
+  } else {
+    mNumThreads = std::max(1, std::min(maxThreads, askedThreads));
+  }
+  if (mOptions[TRDVerboseBit] && mNumThreads > 1) {
+    LOG(info) << "Verbose output requested, decoding the raw data with a single thread";
+    mNumThreads = 1;
+  }
+  LOG(info) << "TRD: Decoding raw data with " << mNumThreads << " threads";
+#endif
+  mThreadReaders.clear();
+  for (int ithread = 1; ithread < mNumThreads; ++ithread) {
+    auto& reader = mThreadReaders.emplace_back(std::make_unique<CruRawReader>());
+    reader->setMaxErrWarnPrinted(ic.options().get<int>("log-max-errors"), ic.options().get<int>("log-max-warnings"));
+    if (nTimeBins >= 0) {
+      reader->setNumberOfTimeBins(nTimeBins);
+    }
+    reader->configure(mTrackletHCHeaderState, mHalfChamberWords, mHalfChamberMajor, mOptions);
+  }
 }
 
 void DataReaderTask::endOfStream(o2::framework::EndOfStreamContext& ec)
@@ -57,6 +87,9 @@ void DataReaderTask::finaliseCCDB(ConcreteDataMatcher& matcher, void* obj)
   } else if (matcher == ConcreteDataMatcher("TRD", "LinkToHcid", 0)) {
     LOG(info) << "Updated Link ID to HCID mapping";
     mReader.setLinkMap((const o2::trd::LinkToHCIDMapping*)obj);
+    for (auto& reader : mThreadReaders) {
+      reader->setLinkMap((const o2::trd::LinkToHCIDMapping*)obj);
+    }
     return;
   }
 }
@@ -113,24 +146,44 @@ void DataReaderTask::run(ProcessingContext& pc)
   size_t datasizeInTF = 0;
   std::vector<InputSpec> sel{InputSpec{"filter", ConcreteDataTypeMatcher{"TRD", "RAWDATA"}}};
   uint64_t tfCount = 0;
+  // first collect the incoming HBFs from all half-CRUs (typically 128 * 72 per TF), they can be decoded independently
+  std::vector<DataRef> hbfRefs;
   for (auto& ref : InputRecordWalker(pc.inputs(), sel)) {
-    // loop over incoming HBFs from all half-CRUs (typically 128 * 72 iterations per TF)
+    hbfRefs.push_back(ref);
+    tfCount = DataRefUtils::getHeader<o2::header::DataHeader*>(ref)->tfCounter;
+    datasizeInTF += DataRefUtils::getPayloadSize(ref);
+  }
+
+  // with the static schedule each thread decodes a contiguous range of HBFs. Merging the readers in the thread order
+  // afterwards gives the same ordering of tracklets and digits per trigger as the sequential decoding
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) num_threads(mNumThreads)
+#endif
+  for (int iref = 0; iref < (int)hbfRefs.size(); ++iref) {
+#ifdef WITH_OPENMP
+    const int threadid = omp_get_thread_num();
+#else
+    const int threadid = 0;
+#endif
+    auto& reader = (threadid == 0) ? mReader : *mThreadReaders[threadid - 1];
+    const auto& ref = hbfRefs[iref];
     const auto* dh = DataRefUtils::getHeader<o2::header::DataHeader*>(ref);
-    tfCount = dh->tfCounter;
     const char* payloadIn = ref.payload;
     auto payloadInSize = DataRefUtils::getPayloadSize(ref);
     if (mOptions[TRDVerboseBit]) {
       LOGP(info, "Found input [{}/{}/{:#x}] TF#{} 1st_orbit:{} Payload {} : ",
            dh->dataOrigin.str, dh->dataDescription.str, dh->subSpecification, dh->tfCounter, dh->firstTForbit, payloadInSize);
     }
-    mReader.setDataBuffer(payloadIn);
-    mReader.setDataBufferSize(payloadInSize);
-    mReader.run();
-    datasizeInTF += payloadInSize;
+    reader.setDataBuffer(payloadIn);
+    reader.setDataBufferSize(payloadInSize);
+    reader.run();
     if (mOptions[TRDVerboseBit]) {
-      LOG(info) << "relevant vectors to read : " << mReader.getTrackletsFound() << " tracklets and " << mReader.getDigitsFound() << " compressed digits";
+      LOG(info) << "relevant vectors to read : " << reader.getTrackletsFound() << " tracklets and " << reader.getDigitsFound() << " compressed digits";
     }
   }
+  for (auto& reader : mThreadReaders) {
+    mReader.merge(*reader);
+  }
 
   mReader.buildDPLOutputs(pc);
   std::chrono::duration<double, std::milli> dataReadTime = std::chrono::high_resolution_clock::now() - dataReadStart;
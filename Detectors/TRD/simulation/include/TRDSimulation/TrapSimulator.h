@@ -165,6 +165,9 @@ class TrapSimulator
   unsigned short filterPedestalNextSample(int adc, int timebin, unsigned short value);
   unsigned short filterGainNextSample(int adc, unsigned short value);
   unsigned short filterTailNextSample(int adc, unsigned short value);
+  // same as above, with the filter registers already read from the TrapConfig for the loops over all channels and timebins
+  unsigned short filterPedestalNextSample(int adc, int timebin, unsigned short value, unsigned short fpnp, unsigned short fptc, unsigned short fpby);
+  unsigned short filterTailNextSample(int adc, unsigned short value, unsigned short alphaLong, unsigned short lambdaLong, unsigned short lambdaShort, bool bypass);
 
   // tracklet calculation
   void addHitToFitreg(int adc, unsigned short timebin, unsigned short qtot, short ypos);
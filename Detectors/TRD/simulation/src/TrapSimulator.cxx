@@ -858,12 +858,14 @@ unsigned short TrapSimulator::filterPedestalNextSample(int adc, int timebin, uns
   // Returns the output of the pedestal filter given the input value.
   // The output depends on the internal registers and, thus, the
   // history of the filter.
-  LOG(debug) << "BEGIN: " << __FILE__ << ":" << __func__ << ":" << __LINE__;
-
   unsigned short fpnp = mTrapConfig->getTrapReg(TrapConfig::kFPNP, mDetector, mRobPos, mMcmPos); // 0..511 -> 0..127.75, pedestal at the output
   unsigned short fptc = mTrapConfig->getTrapReg(TrapConfig::kFPTC, mDetector, mRobPos, mMcmPos); // 0..3, 0 - fastest, 3 - slowest
   unsigned short fpby = mTrapConfig->getTrapReg(TrapConfig::kFPBY, mDetector, mRobPos, mMcmPos); // 0..1 bypass, active low
+  return filterPedestalNextSample(adc, timebin, value, fpnp, fptc, fpby);
+}
 
+unsigned short TrapSimulator::filterPedestalNextSample(int adc, int timebin, unsigned short value, unsigned short fpnp, unsigned short fptc, unsigned short fpby)
+{
   unsigned short accumulatorShifted;
   unsigned short inpAdd;
 
@@ -907,11 +909,16 @@ void TrapSimulator::filterPedestal()
   // the input has been stable for a sufficiently long time.
   // LOG(debug) << "BEGIN: " << __FILE__ << ":" << __func__ << ":" << __LINE__ ;
 
-  for (int iTimeBin = 0; iTimeBin < mNTimeBin; iTimeBin++) {
-    for (int iAdc = 0; iAdc < NADCMCM; iAdc++) {
-      int oldadc = mADCF[iAdc * mNTimeBin + iTimeBin];
-      mADCF[iAdc * mNTimeBin + iTimeBin] = filterPedestalNextSample(iAdc, iTimeBin, mADCR[iAdc * mNTimeBin + iTimeBin]);
-      //    LOG(debug) << "mADCF : time : " << iTimeBin << " adc : " << iAdc << " change : " << oldadc << " -> " << mADCF[iAdc * mNTimeBin + iTimeBin];
+  // The filter registers are the same for all samples of the MCM. The internal registers are
+  // per channel, so the channels are processed one after the other on their contiguous timebins
+  unsigned short fpnp = mTrapConfig->getTrapReg(TrapConfig::kFPNP, mDetector, mRobPos, mMcmPos);
+  unsigned short fptc = mTrapConfig->getTrapReg(TrapConfig::kFPTC, mDetector, mRobPos, mMcmPos);
+  unsigned short fpby = mTrapConfig->getTrapReg(TrapConfig::kFPBY, mDetector, mRobPos, mMcmPos);
+  for (int iAdc = 0; iAdc < NADCMCM; iAdc++) {
+    const int* adcR = &mADCR[iAdc * mNTimeBin];
+    int* adcF = &mADCF[iAdc * mNTimeBin];
+    for (int iTimeBin = 0; iTimeBin < mNTimeBin; iTimeBin++) {
+      adcF[iTimeBin] = filterPedestalNextSample(iAdc, iTimeBin, adcR[iTimeBin], fpnp, fptc, fpby);
     }
   }
   // LOG(debug) << "BEGIN: " << __FILE__ << ":" << __func__ << ":" << __LINE__ ;
@@ -1045,7 +1052,12 @@ unsigned short TrapSimulator::filterTailNextSample(int adc, unsigned short value
   unsigned short alphaLong = 0x3ff & mTrapConfig->getTrapReg(TrapConfig::kFTAL, mDetector, mRobPos, mMcmPos);                            // the weight of the long component
   unsigned short lambdaLong = (1 << 10) | (1 << 9) | (mTrapConfig->getTrapReg(TrapConfig::kFTLL, mDetector, mRobPos, mMcmPos) & 0x1FF);  // the multiplier of the long component
   unsigned short lambdaShort = (0 << 10) | (1 << 9) | (mTrapConfig->getTrapReg(TrapConfig::kFTLS, mDetector, mRobPos, mMcmPos) & 0x1FF); // the multiplier of the short component
+  bool bypass = mTrapConfig->getTrapReg(TrapConfig::kFTBY, mDetector, mRobPos, mMcmPos) == 0;                                            // bypass mode, active low
+  return filterTailNextSample(adc, value, alphaLong, lambdaLong, lambdaShort, bypass);
+}
 
+unsigned short TrapSimulator::filterTailNextSample(int adc, unsigned short value, unsigned short alphaLong, unsigned short lambdaLong, unsigned short lambdaShort, bool bypass)
+{
   // intermediate signals
   unsigned int aDiff;
   unsigned int alInpv;
@@ -1078,7 +1090,7 @@ unsigned short TrapSimulator::filterTailNextSample(int adc, unsigned short value
   mInternalFilterRegisters[adc].mTailAmplShort = tmp & 0xFFF;
 
   // the output of the filter
-  if (mTrapConfig->getTrapReg(TrapConfig::kFTBY, mDetector, mRobPos, mMcmPos) == 0) { // bypass mode, active low
+  if (bypass) {
     return value;
   } else {
     return aDiff;
@@ -1089,9 +1101,14 @@ void TrapSimulator::filterTail()
 {
   // Apply tail cancellation filter to all data.
 
-  for (int iTimeBin = 0; iTimeBin < mNTimeBin; iTimeBin++) {
-    for (int iAdc = 0; iAdc < NADCMCM; iAdc++) {
-      mADCF[iAdc * mNTimeBin + iTimeBin] = filterTailNextSample(iAdc, mADCF[iAdc * mNTimeBin + iTimeBin]);
+  unsigned short alphaLong = 0x3ff & mTrapConfig->getTrapReg(TrapConfig::kFTAL, mDetector, mRobPos, mMcmPos);
+  unsigned short lambdaLong = (1 << 10) | (1 << 9) | (mTrapConfig->getTrapReg(TrapConfig::kFTLL, mDetector, mRobPos, mMcmPos) & 0x1FF);
+  unsigned short lambdaShort = (0 << 10) | (1 << 9) | (mTrapConfig->getTrapReg(TrapConfig::kFTLS, mDetector, mRobPos, mMcmPos) & 0x1FF);
+  bool bypass = mTrapConfig->getTrapReg(TrapConfig::kFTBY, mDetector, mRobPos, mMcmPos) == 0;
+  for (int iAdc = 0; iAdc < NADCMCM; iAdc++) {
+    int* adcF = &mADCF[iAdc * mNTimeBin];
+    for (int iTimeBin = 0; iTimeBin < mNTimeBin; iTimeBin++) {
+      adcF[iTimeBin] = filterTailNextSample(iAdc, adcF[iTimeBin], alphaLong, lambdaLong, lambdaShort, bypass);
     }
   }
 }
@@ -53,7 +53,8 @@ class TRDDPLTrapSimulatorTask : public o2::framework::Task
   int mNumThreads{-1};              // number of threads used for parallel processing
   std::string mTrapConfigName;      // the name of the config to be used.
   std::string mOnlineGainTableName;
-  std::unique_ptr<Calibrations> mCalib; // store the calibrations connection to CCDB. Used primarily for the gaintables in line above.
+  std::unique_ptr<Calibrations> mCalib;                                         // store the calibrations connection to CCDB. Used primarily for the gaintables in line above.
+  std::vector<std::array<TrapSimulator, constants::NMCMHCMAX>> mTrapSimulators; // the trap simulators of one half chamber for each thread, reused for all half chambers
 
   void initTrapConfig(long timeStamp);
   void setOnlineGainTables();
@@ -39,6 +39,7 @@ void TRDTrackletTransformerSpec::init(o2::framework::InitContext& ic)
     // apply artificial pad shift in case non-ideal alignment is used to compensate for shift in current alignment from real data
     mTransformer.setApplyShift(false);
   }
+  mTransformer.setNumberOfThreads(ic.options().get<int>("nthreads"));
 }
 
 void TRDTrackletTransformerSpec::run(o2::framework::ProcessingContext& pc)
@@ -97,23 +98,23 @@ void TRDTrackletTransformerSpec::run(o2::framework::ProcessingContext& pc)
 
   if (mTrigRecFilterActive) {
     // skip tracklets from TRD triggers without ITS data
+    std::vector<int> trackletIndices;
     for (size_t iTrig = 0; iTrig < trigRecs.size(); ++iTrig) {
       if (!trigRecBitfield[iTrig]) {
         continue;
       } else {
         const auto& trigRec = trigRecs[iTrig];
         for (int iTrklt = trigRec.getFirstTracklet(); iTrklt < trigRec.getFirstTracklet() + trigRec.getNumberOfTracklets(); ++iTrklt) {
-          calibratedTracklets[iTrklt] = mTransformer.transformTracklet(tracklets[iTrklt]);
-          ++nTrackletsTransformed;
+          trackletIndices.push_back(iTrklt);
         }
       }
     }
+    mTransformer.transformTracklets(tracklets, calibratedTracklets, trackletIndices);
+    nTrackletsTransformed = trackletIndices.size();
   } else {
     // transform all tracklets
-    for (size_t iTrklt = 0; iTrklt < tracklets.size(); ++iTrklt) {
-      calibratedTracklets[iTrklt] = mTransformer.transformTracklet(tracklets[iTrklt]);
-      ++nTrackletsTransformed;
-    }
+    mTransformer.transformTracklets(tracklets, calibratedTracklets);
+    nTrackletsTransformed = tracklets.size();
   }
 
   LOGF(info, "Found %lu tracklets in %lu trigger records. Applied filter for ITS IR frames: %i. Transformed %i tracklets.", tracklets.size(), trigRecs.size(), mTrigRecFilterActive, nTrackletsTransformed);
@@ -174,7 +175,8 @@ o2::framework::DataProcessorSpec getTRDTrackletTransformerSpec(bool trigRecFilte
     outputs,
     AlgorithmSpec{adaptFromTask<TRDTrackletTransformerSpec>(dataRequest, ggRequest, trigRecFilterActive)},
     Options{
-      {"apply-xor", o2::framework::VariantType::Bool, false, {"flip the 8-th bit of slope and position (for processing CTFs from 2021 pilot beam)"}}}};
+      {"apply-xor", o2::framework::VariantType::Bool, false, {"flip the 8-th bit of slope and position (for processing CTFs from 2021 pilot beam)"}},
+      {"nthreads", o2::framework::VariantType::Int, 1, {"number of threads used for the tracklet transformation"}}}};
 }
 
 } //end namespace trd
@@ -11,6 +11,7 @@
 
 #include "TRDWorkflow/TRDTrapSimulatorSpec.h"
 
+#include <algorithm>
 #include <chrono>
 #include <optional>
 #include <gsl/span>
@@ -168,6 +169,7 @@ void TRDDPLTrapSimulatorTask::init(o2::framework::InitContext& ic)
   }
   LOG(info) << "Trap simulation running with " << mNumThreads << " threads ";
 #endif
+  mTrapSimulators.resize(std::max(mNumThreads, 1));
 }
 
 void TRDDPLTrapSimulatorTask::run(o2::framework::ProcessingContext& pc)
@@ -231,42 +233,69 @@ void TRDDPLTrapSimulatorTask::run(o2::framework::ProcessingContext& pc)
   digitCountsAccum.resize(triggerRecords.size());
   digitIndicesAccum.resize(triggerRecords.size());
 
+  // the half chambers of all triggers are the units of work for the parallel processing,
+  // each one is given by the range of its digits in the sorted digit index array
   auto timeParallelStart = std::chrono::high_resolution_clock::now();
+  std::vector<int> hcTrigger;    // the trigger record of each half chamber
+  std::vector<int> hcFirstDigit; // the first entry in digitIdxArray for each half chamber
+  std::vector<int> hcDigitCount; // the number of digits for each half chamber
+  for (size_t iTrig = 0; iTrig < triggerRecords.size(); ++iTrig) {
+    int currHCId = -1;
+    for (int iDigit = triggerRecords[iTrig].getFirstDigit(); iDigit < (triggerRecords[iTrig].getFirstDigit() + triggerRecords[iTrig].getNumberOfDigits()); ++iDigit) {
+      const auto hcid = digits[digitIdxArray[iDigit]].getHCId();
+      if (hcid != currHCId) {
+        currHCId = hcid;
+        hcTrigger.push_back(iTrig);
+        hcFirstDigit.push_back(iDigit);
+        hcDigitCount.push_back(0);
+      }
+      ++hcDigitCount.back();
+    }
+  }
+  std::vector<int> nTrackletsHC(hcTrigger.size());
+  std::vector<std::vector<Tracklet64>> trackletsHC(hcTrigger.size());
+  std::vector<std::vector<short>> digitCountsHC(hcTrigger.size());
+  std::vector<std::vector<int>> digitIndicesHC(hcTrigger.size());
 
 #ifdef WITH_OPENMP
 #pragma omp parallel for schedule(dynamic) num_threads(mNumThreads)
 #endif
-  for (size_t iTrig = 0; iTrig < triggerRecords.size(); ++iTrig) {
-    int currHCId = -1;
-    std::array<TrapSimulator, NMCMHCMAX> trapSimulators{}; //the up to 64 trap simulators for a single half chamber
-    for (int iDigit = triggerRecords[iTrig].getFirstDigit(); iDigit < (triggerRecords[iTrig].getFirstDigit() + triggerRecords[iTrig].getNumberOfDigits()); ++iDigit) {
+  for (size_t iHC = 0; iHC < hcTrigger.size(); ++iHC) {
+#ifdef WITH_OPENMP
+    const int threadid = omp_get_thread_num();
+#else
+    const int threadid = 0;
+#endif
+    auto& trapSimulators = mTrapSimulators[threadid]; // the up to 64 trap simulators for a single half chamber, reused by this thread
+    for (int iDigit = hcFirstDigit[iHC]; iDigit < hcFirstDigit[iHC] + hcDigitCount[iHC]; ++iDigit) {
       const auto& digit = &digits[digitIdxArray[iDigit]];
-      if (currHCId < 0) {
-        currHCId = digit->getHCId();
-      }
-      if (currHCId != digit->getHCId()) {
-        // we switch to a new half chamber, process all TRAPs of the previous half chamber which contain data
-        processTRAPchips(nTracklets[iTrig], trackletsAccum[iTrig], trapSimulators, digitCountsAccum[iTrig], digitIndicesAccum[iTrig]);
-        currHCId = digit->getHCId();
-      }
       // fill the digit data into the corresponding TRAP chip
       int trapIdx = (digit->getROB() / 2) * NMCMROB + digit->getMCM();
       if (!trapSimulators[trapIdx].isDataSet()) {
-        trapSimulators[trapIdx].init(mTrapConfig, digit->getDetector(), digit->getROB(), digit->getMCM());
+        // the charge settings are applied before the initialisation, since they enter the tracklet word prepared there
         if (mUseFloatingPointForQ) {
           trapSimulators[trapIdx].setUseFloatingPointForQ();
         } else if (mChargeScalingFactor != -1) {
           trapSimulators[trapIdx].setChargeScalingFactor(mChargeScalingFactor);
         }
+        trapSimulators[trapIdx].init(mTrapConfig, digit->getDetector(), digit->getROB(), digit->getMCM());
       }
       if (digit->getChannel() != 22) {
         // 22 signals invalid digit read by raw reader
         trapSimulators[trapIdx].setData(digit->getChannel(), digit->getADC(), digitIdxArray[iDigit]);
       }
     }
-    // take care of the TRAPs for the last half chamber
-    processTRAPchips(nTracklets[iTrig], trackletsAccum[iTrig], trapSimulators, digitCountsAccum[iTrig], digitIndicesAccum[iTrig]);
+    processTRAPchips(nTrackletsHC[iHC], trackletsHC[iHC], trapSimulators, digitCountsHC[iHC], digitIndicesHC[iHC]);
   } // done with parallel processing
+
+  // collect the results of the half chambers per trigger, in the same order as in the sequential processing
+  for (size_t iHC = 0; iHC < hcTrigger.size(); ++iHC) {
+    const auto iTrig = hcTrigger[iHC];
+    nTracklets[iTrig] += nTrackletsHC[iHC];
+    trackletsAccum[iTrig].insert(trackletsAccum[iTrig].end(), trackletsHC[iHC].begin(), trackletsHC[iHC].end());
+    digitCountsAccum[iTrig].insert(digitCountsAccum[iTrig].end(), digitCountsHC[iHC].begin(), digitCountsHC[iHC].end());
+    digitIndicesAccum[iTrig].insert(digitIndicesAccum[iTrig].end(), digitIndicesHC[iHC].begin(), digitIndicesHC[iHC].end());
+  }
   auto parallelTime = std::chrono::high_resolution_clock::now() - timeParallelStart;
 
   // accumulate results and add MC labels
@@ -134,6 +134,9 @@ class PVertexer
 
   void setPoolDumpDirectory(const std::string& d) { mPoolDumpDirectory = d; }
 
+  void setNThreads(int n);
+  int getNThreads() const { return mNThreads; }
+
   void printInpuTracksStatus(const VertexingInput& input) const;
 
  private:
@@ -169,8 +172,10 @@ class PVertexer
 
   std::pair<int, int> getBestIR(const PVertex& vtx, const gsl::span<InteractionCandidate> intCand, int& currEntry) const;
 
-  int dbscan_RangeQuery(int idxs, std::vector<int>& cand, std::vector<int>& status);
+  int dbscan_RangeQuery(int idxs, std::vector<int>& cand, std::vector<int>& status, std::vector<int>& gridCand);
   void dbscan_clusterize();
+  void dbscan_clusterizeSegment(int idMin, int idMax, std::vector<int>& status, std::vector<TimeZCluster>& clusters);
+  void findVerticesInClusters(std::vector<PVertex>& vertices, std::vector<uint32_t>& trackIDs, std::vector<V2TRef>& v2tRefs);
   void doDBScanDump(const VertexingInput& input, gsl::span<const o2::MCCompLabel> lblTracks);
   void doVtxDump(std::vector<PVertex>& vertices, std::vector<uint32_t> trackIDsLoc, std::vector<V2TRef>& v2tRefsLoc, gsl::span<const o2::MCCompLabel> lblTracks);
   void doDBGPoolDump(gsl::span<const o2::MCCompLabel> lblTracks);
@@ -185,11 +190,13 @@ class PVertexer
   //
   std::vector<TrackVF> mTracksPool;         ///< tracks in internal representation used for vertexing, sorted in time
   std::vector<TimeZCluster> mTimeZClusters; ///< set of time clusters
+  DBScanGrid mDBScanGrid;                   ///< time-Z grid for the DBScan neighbours search
   float mITSROFrameLengthMUS = 0;           ///< ITS readout time span in \mus
   float mBz = 0.;                           ///< mag.field at beam line
   float mDBScanDeltaT = 0.;                 ///< deltaT cut for DBScan check
   float mDBSMaxZ2InvCorePoint = 0;          ///< inverse of max sigZ^2 of the track which can be core point in the DBScan
   bool mValidateWithIR = false;             ///< require vertex validation with InteractionCandidates (if available)
+  int mNThreads = 1;                        ///< number of threads for the DBScan time segments and the TZ-clusters vertex search
   o2::InteractionRecord mStartIR{0, 0};     ///< IR corresponding to the start of the TF
   // structure for the vertex refit
   o2d::VertexBase mVtxRefitOrig{};   ///< original vertex whose tracks are refitted
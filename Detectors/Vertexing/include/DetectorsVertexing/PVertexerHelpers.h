@@ -251,6 +251,46 @@ struct TimeZCluster {
   TimeEst timeEst{};
 };
 
+// time-Z grid of the tracks pool (sorted in time) for the DBScan neighbours search.
+// The tracks of each time bin are grouped in classes of Z half-width of the region where they can be a neighbour,
+// and sorted in Z within each class, so that only the tracks which may pass their own Z distance cut are inspected.
+struct DBScanGrid {
+  static constexpr int NZClasses = 16;           ///< number of classes of the Z half-width
+  static constexpr int MinZClassExp = -10;       ///< binary exponent of the lowest class Z half-width
+  static constexpr int MinTracksPerTimeBin = 4;  ///< limit the number of time bins to the number of tracks over this
+  static constexpr float HalfWidthMargin = 1e-3; ///< relative margin on the Z half-width to absorb the rounding
+
+  struct Entry {
+    float z = 0.;         ///< Z of the track
+    float halfWidth = 0.; ///< max |dZ| with which the track can be a neighbour
+    int id = -1;          ///< track index in the pool
+  };
+
+  /// build the grid for the pool, if not sorted in time or with deltaT <= 0 the grid is not valid and should not be used
+  void build(const std::vector<TrackVF>& pool, float deltaT, float maxDist2);
+  bool isValid() const { return valid; }
+  /// fill the indices of the tracks which may be neighbours of the track id in the order they are checked by the
+  /// linear scan, i.e. in decreasing index order below id, then in increasing order above it
+  void getNeighbourCandidates(int id, std::vector<int>& cand) const;
+
+  int getTimeBin(float t) const
+  {
+    int tb = int((t - tMin) * binWidthTInv);
+    return tb < 0 ? 0 : (tb < nTBins ? tb : nTBins - 1);
+  }
+
+  std::vector<float> times{};       ///< times of the pool tracks
+  std::vector<float> zs{};          ///< Z of the pool tracks
+  std::vector<Entry> entries{};     ///< tracks sorted in time bin, Z class, Z
+  std::vector<int> cellOffsets{};   ///< first entry of each time bin and Z class cell
+  std::vector<float> cellMaxHW{};   ///< max Z half-width of the tracks of each cell
+  float deltaT = 0.;                ///< DBScan time difference cut
+  float tMin = 0.;                  ///< time of the 1st track
+  float binWidthTInv = 0.;          ///< inverse time bin width
+  int nTBins = 0;                   ///< number of time bins
+  bool valid = false;
+};
+
 // structure to produce debug dump for neighbouring vertices comparison
 struct PVtxCompDump {
   PVertex vtx0{};
@@ -34,6 +34,7 @@ struct PVertexerParams : public o2::conf::ConfigurableParamHelper<PVertexerParam
   float dbscanDeltaT = -0.9;   ///< abs. time difference cut, should be ~ 0.5 ITS ROF duration if ITS SA tracks used, if < 0 then the value calculated as mITSROFrameLengthMUS*(-dbscanDeltaT)
   float dbscanAdaptCoef = 0.1; ///< adapt dbscan minPts for each cluster as minPts=max(minPts, currentSize*dbscanAdaptCoef).
   float dbscanMaxSigZCorPoint = 0.1; ///< max sigZ of the track which can be core points in the DBScan
+  bool dbscanUseGrid = true;         ///< use time-Z grid for the DBScan neighbours search (same result as the linear scan)
 
   int maxVerticesPerCluster = 10; ///< max vertices per time-z cluster to look for
   int maxTrialsPerCluster = 100;  ///< max unsucessful trials for vertex search per vertex
@@ -33,6 +33,7 @@
 #include "StrangenessTracking/StrangenessTracker.h"
 #include "DataFormatsTPC/TrackTPC.h"
 #include <numeric>
+#include <limits>
 #include <algorithm>
 #include "GPUO2InterfaceRefit.h"
 #include "TPCFastTransform.h"
@@ -103,7 +104,8 @@ class SVertexer
     float minR = 0; // track lowest point r
     bool hasTPC = false;
     int8_t nITSclu = -1;
-    bool compatibleProton = false; // dE/dx compatibility with proton hypothesis (FIXME: use better, uint8_t compat mask?)
+    bool compatibleProton = false;        // dE/dx compatibility with proton hypothesis (FIXME: use better, uint8_t compat mask?)
+    o2::math_utils::CircleXYf_t circle{}; // helix circle in the lab frame, for the preselection of pairs
     bool hasITS() const
     {
       return nITSclu > 0;
@@ -150,6 +152,48 @@ class SVertexer
   std::array<size_t, 3> getNFitterCalls() const;
   void setSources(GIndex::mask_t src) { mSrc = src; }
 
+  ///< set the helix circle of the seed, as the DCA fitter calculates it
+  static void setSeedCircle(TrackCand& seed, float bz)
+  {
+    float sna, csa;
+    seed.getCircleParams(bz, seed.circle, sna, csa);
+  }
+
+  ///< check if the DCA fitter may find a seed for the pair: it rejects the pairs of circles separated by more than maxDXY
+  static bool checkSeedCircles(const TrackCand& seedP, const TrackCand& seedN, float maxDXY)
+  {
+    const auto &cP = seedP.circle, &cN = seedN.circle;
+    if (maxDXY < 0 || cP.rC < o2::constants::math::Almost0 || cN.rC < o2::constants::math::Almost0) { // straight lines are not preselected
+      return true;
+    }
+    float dx = cP.xC - cN.xC, dy = cP.yC - cN.yC;
+    return std::sqrt(dx * dx + dy * dy) - (cP.rC + cN.rC) <= maxDXY;
+  }
+
+  ///< bounding box of the seed circle
+  struct SeedBox {
+    float xMin = 0, xMax = 0, yMin = 0, yMax = 0;
+  };
+
+  ///< get the bounding box of the seed circle, enlarged to cover the rounding of checkSeedCircles, unbounded for straight lines
+  static SeedBox getSeedBox(const TrackCand& seed)
+  {
+    const auto& c = seed.circle;
+    if (c.rC < o2::constants::math::Almost0) {
+      constexpr float Inf = std::numeric_limits<float>::infinity();
+      return {-Inf, Inf, -Inf, Inf};
+    }
+    float tolX = 1e-5f * (std::abs(c.xC) + c.rC), tolY = 1e-5f * (std::abs(c.yC) + c.rC);
+    return {c.xC - c.rC - tolX, c.xC + c.rC + tolX, c.yC - c.rC - tolY, c.yC + c.rC + tolY};
+  }
+
+  ///< check if the boxes of the seed circles are closer than maxDXY: necessary condition for checkSeedCircles to pass
+  static bool checkSeedBoxes(const SeedBox& boxP, const SeedBox& boxN, float maxDXY)
+  {
+    return maxDXY < 0 || (boxN.xMin <= boxP.xMax + maxDXY && boxN.xMax >= boxP.xMin - maxDXY &&
+                          boxN.yMin <= boxP.yMax + maxDXY && boxN.yMax >= boxP.yMin - maxDXY);
+  }
+
  private:
   template <class TVI, class TCI, class T3I, class TR>
   void extractPVReferences(const TVI& v0s, TR& vtx2V0Refs, const TCI& cascades, TR& vtx2CascRefs, const T3I& vtxs3, TR& vtx2body3Refs);
@@ -158,6 +202,8 @@ class SVertexer
   int check3bodyDecays(const V0Index& v0Idx, const V0& v0, float rv0, std::array<float, 3> pV0, float p2V0, int avoidTrackID, int posneg, VBracket v0vlist, int ithread);
   void setupThreads();
   void buildT2V(const o2::globaltracking::RecoContainer& recoTracks);
+  void buildNegSeedsIndex();
+  void selectPairCandidates(const SeedBox& boxP, int firstN, std::vector<int>& candidates) const;
   void updateTimeDependentParams();
   bool acceptTrack(const GIndex gid, const o2::track::TrackParCov& trc) const;
   bool processTPCTrack(const o2::tpc::TrackTPC& trTPC, GIndex gid, int vtxid);
@@ -187,6 +233,13 @@ class SVertexer
   std::vector<std::vector<Decay3BodyIndex>> m3bodyIdxTmp;
   std::array<std::vector<TrackCand>, 2> mTracksPool{}; // pools of positive and negative seeds sorted in min VtxID
   std::array<std::vector<int>, 2> mVtxFirstTrack{};    // 1st pos. and neg. track of the pools for each vertex
+  // index of the neg. seeds for the pairs preselection: the seeds with the same lowest-ID vertex form a group, sorted in xMin of their circle box
+  std::vector<SeedBox> mNegBoxes;                   // circle box of each neg. seed
+  std::vector<int> mNegGroupFirst;                  // 1st seed of the group of each neg. seed
+  std::vector<int> mNegGroupEnd;                    // end of the group of each neg. seed
+  std::vector<int> mNegSortedID;                    // neg. seeds of each group sorted in box xMin
+  std::vector<float> mNegSortedXMin;                // box xMin of the seeds in mNegSortedID
+  std::vector<std::vector<int>> mPairCandidatesTmp; // per thread neg. seeds of a group selected for a pos. seed
 
   o2::dataformats::VertexBase mMeanVertex{{0., 0., 0.}, {0.1 * 0.1, 0., 0.1 * 0.1, 0., 0., 6. * 6.}};
   const SVertexerParams* mSVParams = nullptr;
@@ -206,6 +259,9 @@ class SVertexer
   float mMaxDCAXY2ToMeanVertex = 0;
   float mMaxDCAXY2ToMeanVertexV0Casc = 0;
   float mMaxDCAXY2ToMeanVertex3bodyV0 = 0;
+  float mMaxDXYPreselection = -1;    // max XY distance of the seed circles in the pairs preselection, negative to disable it
+  float mMaxDXYPreselectionTPC = -1; // same for the TPC-only pairs with the photon tuning
+  float mMaxDXYPreselectionBox = -1; // max XY distance of the seed circle boxes in the index, covering both cases above
   float mMinR2DiffV0Casc = 0;
   float mMaxR2ToMeanVertexCascV0 = 0;
   float mMinPt2V0 = 1e-6;
@@ -43,6 +43,9 @@ struct SVertexerParams : public o2::conf::ConfigurableParamHelper<SVertexerParam
   float maxDXYIni = 4.;         ///< don't consider as a seed (circles intersection) if XY distance exceeds this
   float maxRIni = 150;          ///< don't consider as a seed (circles intersection) if its R exceeds this
   //
+  bool preselectPairs = true;      ///< skip before the DCA fit the pairs whose helix circles are farther apart than maxDXYIni
+  float preselectionMargin = 0.01; ///< margin added to the max. XY distance of the circles in the pairs preselection
+  //
   // propagation options
   int matCorr = int(o2::base::Propagator::MatCorrType::USEMatCorrNONE); ///< material correction to use
   float minRFor3DField = 40;                                            ///< above this radius use 3D field
@@ -19,6 +19,7 @@
 #include "Math/SVector.h"
 #include "MathUtils/fit.h"
 #include <unordered_map>
+#include <iterator>
 #include "CommonUtils/StringUtils.h"
 #include <TH2F.h>
 
@@ -63,17 +64,19 @@ int PVertexer::runVertexing(const gsl::span<o2d::GlobalTrackID> gids, const gsl:
   std::vector<float> validationTimes;
   std::vector<o2::MCEventLabel> lblVtxLoc;
   mTimeVertexing.Start();
-  int cntTZ = 0;
-  for (auto tc : mTimeZClusters) {
-    size_t nnold = verticesLoc.size();
-    VertexingInput inp;
-    inp.idRange = gsl::span<int>(tc.trackIDs);
-    inp.scaleSigma2 = mPVParams->iniScale2;
-    inp.timeEst = tc.timeEst;
+  if (mNThreads > 1) {
+    findVerticesInClusters(verticesLoc, trackIDs, v2tRefsLoc);
+  } else {
+    for (auto tc : mTimeZClusters) {
+      VertexingInput inp;
+      inp.idRange = gsl::span<int>(tc.trackIDs);
+      inp.scaleSigma2 = mPVParams->iniScale2;
+      inp.timeEst = tc.timeEst;
 #ifdef _PV_DEBUG_TREE_
-    doDBScanDump(inp, lblTracks);
+      doDBScanDump(inp, lblTracks);
 #endif
-    findVertices(inp, verticesLoc, trackIDs, v2tRefsLoc);
+      findVertices(inp, verticesLoc, trackIDs, v2tRefsLoc);
+    }
   }
   mTimeVertexing.Stop();
   // sort in time
@@ -223,23 +226,64 @@ int PVertexer::findVertices(const VertexingInput& input, std::vector<PVertex>& v
     auto clTime = tCurr - tStart;
     if (clTime > mPVParams->maxTimeMSPerCluster) {
       LOGP(warn, "Time per TZ-cluster ({}ms) of {} tracks exceeded limit after {} trials, abandon", clTime, mult, nTrials);
+#ifdef WITH_OPENMP
+#pragma omp critical(pvertexer_pool_dump)
+#endif
       if (!mPoolDumpProduced) {
-        dumpPool();
+        dumpPool(); // weights and vertex IDs of other clusters may be in flux with several threads, they are reset when replayed
       }
       break;
     }
   }
-  mTotTrials += nTrials;
-  if (size_t(nTrials) > mMaxTrialPerCluster) {
-    mMaxTrialPerCluster = nTrials;
-  }
-  if (tCurr - tStart > mLongestClusterTimeMS) {
-    mLongestClusterTimeMS = tCurr - tStart;
-    mLongestClusterMult = mult;
+#ifdef WITH_OPENMP
+#pragma omp critical(pvertexer_stat)
+#endif
+  {
+    mTotTrials += nTrials;
+    if (size_t(nTrials) > mMaxTrialPerCluster) {
+      mMaxTrialPerCluster = nTrials;
+    }
+    if (tCurr - tStart > mLongestClusterTimeMS) {
+      mLongestClusterTimeMS = tCurr - tStart;
+      mLongestClusterMult = mult;
+    }
   }
   return nfound;
 }
 
+//______________________________________________
+void PVertexer::findVerticesInClusters(std::vector<PVertex>& vertices, std::vector<uint32_t>& trackIDs, std::vector<V2TRef>& v2tRefs)
+{
+  // find vertices in the TZ-clusters in parallel: the clusters have no track in common, so their vertices are searched in separate
+  // containers, which are then merged in the clusters order to have the same result as the sequential search.
+  int nClusters = mTimeZClusters.size();
+  std::vector<std::vector<PVertex>> verticesClus(nClusters);
+  std::vector<std::vector<uint32_t>> trackIDsClus(nClusters);
+  std::vector<std::vector<V2TRef>> v2tRefsClus(nClusters);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int icl = 0; icl < nClusters; icl++) {
+    auto& tc = mTimeZClusters[icl];
+    VertexingInput inp;
+    inp.idRange = gsl::span<int>(tc.trackIDs);
+    inp.scaleSigma2 = mPVParams->iniScale2;
+    inp.timeEst = tc.timeEst;
+    findVertices(inp, verticesClus[icl], trackIDsClus[icl], v2tRefsClus[icl]);
+  }
+  for (int icl = 0; icl < nClusters; icl++) {
+    int vtxOffs = vertices.size(), trcOffs = trackIDs.size();
+    vertices.insert(vertices.end(), verticesClus[icl].begin(), verticesClus[icl].end());
+    for (const auto& ref : v2tRefsClus[icl]) {
+      v2tRefs.emplace_back(ref.getFirstEntry() + trcOffs, ref.getEntries());
+    }
+    for (auto id : trackIDsClus[icl]) {
+      trackIDs.push_back(id);
+      mTracksPool[id].vtxID += vtxOffs; // vertex ID was assigned within the cluster
+    }
+  }
+}
+
 //______________________________________________
 bool PVertexer::findVertex(const VertexingInput& input, PVertex& vtx)
 {
@@ -1019,7 +1063,7 @@ bool PVertexer::setCompatibleIR(PVertex& vtx)
 }
 
 //___________________________________________________________________
-int PVertexer::dbscan_RangeQuery(int id, std::vector<int>& cand, std::vector<int>& status)
+int PVertexer::dbscan_RangeQuery(int id, std::vector<int>& cand, std::vector<int>& status, std::vector<int>& gridCand)
 {
   // find neighbours for dbscan cluster core point candidate
   // Since we use asymmetric distance definition, is it bit more complex than simple search within chi2 proximity
@@ -1049,6 +1093,13 @@ int PVertexer::dbscan_RangeQuery(int id, std::vector<int>& cand, std::vector<int
     }
     return 1;
   };
+  if (mDBScanGrid.isValid()) { // check only the tracks which may pass the distance cut, in the same order as the scan below
+    mDBScanGrid.getNeighbourCandidates(id, gridCand);
+    for (auto idN : gridCand) {
+      procPnt(idN);
+    }
+    return nFound;
+  }
   int idL = id;
   while (--idL >= 0) { // index in time decreasing direction
     if (procPnt(idL) < 0) {
@@ -1065,20 +1116,19 @@ int PVertexer::dbscan_RangeQuery(int id, std::vector<int>& cand, std::vector<int
 }
 
 //_____________________________________________________
-void PVertexer::dbscan_clusterize()
+void PVertexer::dbscan_clusterizeSegment(int idMin, int idMax, std::vector<int>& status, std::vector<TimeZCluster>& clusters)
 {
-  mTimeZClusters.clear();
-  int ntr = mTracksPool.size();
-  std::vector<int> status(ntr, DBS_UNDEF);
+  // clusterize tracks idMin:idMax-1 of the pool, none of them being a neighbour of the tracks outside this range.
+  // The cluster IDs used as status are local to the segment.
   int clID = -1;
 
-  std::vector<int> nbVec;
-  for (int it = 0; it < ntr; it++) {
+  std::vector<int> nbVec, gridCand;
+  for (int it = idMin; it < idMax; it++) {
     if (status[it] != DBS_UNDEF) {
       continue;
     }
     nbVec.clear();
-    auto nnb0 = dbscan_RangeQuery(it, nbVec, status);
+    auto nnb0 = dbscan_RangeQuery(it, nbVec, status, gridCand);
     int minNeighbours = mPVParams->minTracksPerVtx - 1;
     if (nnb0 < minNeighbours) {
       status[it] = DBS_NOISE; // noise
@@ -1088,7 +1138,7 @@ void PVertexer::dbscan_clusterize()
       minNeighbours = std::max(minNeighbours, int(nnb0 * mPVParams->dbscanAdaptCoef));
     }
     status[it] = ++clID;
-    auto& clusVec = mTimeZClusters.emplace_back().trackIDs; // new cluster
+    auto& clusVec = clusters.emplace_back().trackIDs; // new cluster
     clusVec.push_back(it);
 
     for (int j = 0; j < nnb0; j++) {
@@ -1107,7 +1157,7 @@ void PVertexer::dbscan_clusterize()
       if (clusVec.size() > minNeighbours) {
         minNeighbours = std::max(minNeighbours, int(clusVec.size() * mPVParams->dbscanAdaptCoef));
       }
-      auto nnb1 = dbscan_RangeQuery(jt, nbVec, status);
+      auto nnb1 = dbscan_RangeQuery(jt, nbVec, status, gridCand);
       if (nnb1 < minNeighbours) {
         for (unsigned k = ncurr; k < nbVec.size(); k++) {
           if (status[nbVec[k]] < DBS_INCHECK) {
@@ -1120,6 +1170,45 @@ void PVertexer::dbscan_clusterize()
       }
     }
   }
+}
+
+//_____________________________________________________
+void PVertexer::dbscan_clusterize()
+{
+  mTimeZClusters.clear();
+  int ntr = mTracksPool.size();
+  std::vector<int> status(ntr, DBS_UNDEF);
+  if (mPVParams->dbscanUseGrid) {
+    mDBScanGrid.build(mTracksPool, mDBScanDeltaT, mPVParams->dbscanMaxDist2);
+  } else {
+    mDBScanGrid.valid = false;
+  }
+
+  // tracks separated by a time gap exceeding the DBScan deltaT cut cannot be neighbours: the segments of the pool between such gaps
+  // are clustered independently and their clusters are merged in the time order, as when the whole pool is clustered at once
+  std::vector<int> segStart{0};
+  for (int it = 1; it < ntr; it++) {
+    float tPrev = mTracksPool[it - 1].timeEst.getTimeStamp(), t = mTracksPool[it].timeEst.getTimeStamp();
+    if (t < tPrev) { // not sorted in time, process as a single segment
+      segStart.resize(1);
+      break;
+    }
+    if (std::abs(t - tPrev) > mDBScanDeltaT) {
+      segStart.push_back(it);
+    }
+  }
+  segStart.push_back(ntr);
+  int nSeg = segStart.size() - 1;
+  std::vector<std::vector<TimeZCluster>> segClusters(nSeg);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int iseg = 0; iseg < nSeg; iseg++) {
+    dbscan_clusterizeSegment(segStart[iseg], segStart[iseg + 1], status, segClusters[iseg]);
+  }
+  for (auto& clusters : segClusters) {
+    std::move(clusters.begin(), clusters.end(), std::back_inserter(mTimeZClusters));
+  }
 
   for (auto& clus : mTimeZClusters) {
     if (clus.trackIDs.size() < mPVParams->minTracksPerVtx) {
@@ -1370,6 +1459,7 @@ int PVertexer::processFromExternalPool(const std::vector<TrackVF>& pool, std::ve
   std::vector<o2::MCEventLabel> lblVtx;
 
   std::vector<GTrackID> gids;
+  mTracksPool.clear();
   for (auto tr : pool) {
     tr.vtxID = TrackVF::kNoVtx;
     tr.wgh = 0.;
@@ -1379,6 +1469,16 @@ int PVertexer::processFromExternalPool(const std::vector<TrackVF>& pool, std::ve
   return runVertexing(gids, intCand, vertices, vertexTrackIDs, v2tRefs, lblTracks, lblVtx);
 }
 
+//______________________________________________
+void PVertexer::setNThreads(int n)
+{
+#if defined(WITH_OPENMP) && !defined(_PV_DEBUG_TREE_)
+  mNThreads = n > 0 ? n : 1;
+#else
+  mNThreads = 1;
+#endif
+}
+
 //______________________________________________
 void PVertexer::setTrackSources(GTrackID::mask_t s)
 {
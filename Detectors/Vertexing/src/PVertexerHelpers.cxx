@@ -14,6 +14,9 @@
 /// \author ruben.shahoyan@cern.ch
 
 #include "DetectorsVertexing/PVertexerHelpers.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 using namespace o2::vertexing;
 
@@ -60,3 +63,85 @@ void TrackVF::reportBadTrack(const o2::track::TrackParCov& src, const TimeEst& t
     LOG(warn) << msg;
   }
 }
+
+void DBScanGrid::build(const std::vector<TrackVF>& pool, float dT, float maxDist2)
+{
+  valid = false;
+  int ntr = pool.size();
+  if (dT <= 0.f || ntr < 2) {
+    return;
+  }
+  times.resize(ntr);
+  zs.resize(ntr);
+  for (int i = 0; i < ntr; i++) {
+    times[i] = pool[i].timeEst.getTimeStamp();
+    zs[i] = pool[i].z;
+    if (!std::isfinite(times[i]) || !std::isfinite(zs[i]) || (i && times[i] < times[i - 1])) {
+      return; // the linear scan will be used
+    }
+  }
+  deltaT = dT;
+  tMin = times.front();
+  float binWidthT = std::max(dT, (times.back() - tMin) * MinTracksPerTimeBin / ntr);
+  binWidthTInv = 1.f / binWidthT;
+  nTBins = int((times.back() - tMin) * binWidthTInv) + 1;
+
+  // the distance to the neighbour is at least dZ^2 * sig2ZI of the neighbour, hence its max |dZ|
+  std::vector<int> cellID(ntr);
+  cellOffsets.assign(nTBins * NZClasses + 1, 0);
+  cellMaxHW.assign(nTBins * NZClasses, 0.f);
+  entries.resize(ntr);
+  for (int i = 0; i < ntr; i++) {
+    const auto& trc = pool[i];
+    float hw = trc.sig2ZI > 0.f ? std::sqrt(maxDist2 / trc.sig2ZI) * (1.f + HalfWidthMargin) : std::numeric_limits<float>::infinity();
+    if (!(hw < std::numeric_limits<float>::max())) {
+      hw = std::numeric_limits<float>::infinity();
+    }
+    int cls = hw > 0.f ? std::ilogb(hw) - MinZClassExp : 0;
+    cls = cls < 0 ? 0 : (cls < NZClasses ? cls : NZClasses - 1);
+    int cell = getTimeBin(times[i]) * NZClasses + cls;
+    cellID[i] = cell;
+    cellOffsets[cell + 1]++;
+    cellMaxHW[cell] = std::max(cellMaxHW[cell], hw);
+    entries[i] = Entry{trc.z, hw, i};
+  }
+  for (size_t ic = 1; ic < cellOffsets.size(); ic++) {
+    cellOffsets[ic] += cellOffsets[ic - 1];
+  }
+  std::vector<int> fill(cellOffsets.begin(), cellOffsets.end() - 1);
+  std::vector<Entry> sorted(ntr);
+  for (int i = 0; i < ntr; i++) {
+    sorted[fill[cellID[i]]++] = entries[i];
+  }
+  entries.swap(sorted);
+  for (int ic = 0; ic < nTBins * NZClasses; ic++) {
+    std::sort(entries.begin() + cellOffsets[ic], entries.begin() + cellOffsets[ic + 1], [](const Entry& a, const Entry& b) { return a.z < b.z; });
+  }
+  valid = true;
+}
+
+void DBScanGrid::getNeighbourCandidates(int id, std::vector<int>& cand) const
+{
+  cand.clear();
+  const float t = times[id], z = zs[id];
+  // the linear scan stops at the first track with |dt| > deltaT in each direction, for the tracks sorted in time these are the window limits
+  int idLow = std::partition_point(times.begin(), times.begin() + id, [t, this](float tL) { return std::abs(t - tL) > deltaT; }) - times.begin();
+  int idUp = std::partition_point(times.begin() + id + 1, times.end(), [t, this](float tU) { return !(std::abs(t - tU) > deltaT); }) - times.begin();
+  int tbMax = getTimeBin(times[idUp - 1]);
+  for (int tb = getTimeBin(times[idLow]); tb <= tbMax; tb++) {
+    for (int ic = tb * NZClasses; ic < (tb + 1) * NZClasses; ic++) {
+      if (cellOffsets[ic] == cellOffsets[ic + 1]) {
+        continue;
+      }
+      const float hw = cellMaxHW[ic];
+      auto it = std::lower_bound(entries.begin() + cellOffsets[ic], entries.begin() + cellOffsets[ic + 1], z - hw, [](const Entry& e, float v) { return e.z < v; });
+      for (auto last = entries.begin() + cellOffsets[ic + 1]; it != last && it->z <= z + hw; ++it) {
+        if (it->id >= idLow && it->id < idUp && it->id != id && std::abs(it->z - z) <= it->halfWidth) {
+          cand.push_back(it->id);
+        }
+      }
+    }
+  }
+  std::sort(cand.begin(), cand.end());
+  std::reverse(cand.begin(), std::lower_bound(cand.begin(), cand.end(), id));
+}
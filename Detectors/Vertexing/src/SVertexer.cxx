@@ -62,21 +62,32 @@ void SVertexer::process(const o2::globaltracking::RecoContainer& recoData, o2::f
       LOG(debug) << "No partner is found for pos.track " << itp << " out of " << ntrP;
       continue;
     }
-    for (int itn = firstN; itn < ntrN; itn++) { // start from the 1st negative track of lowest-ID vertex of positive
-      auto& seedN = mTracksPool[NEG][itn];
-      if (seedN.vBracket > seedP.vBracket) { // all vertices compatible with seedN are in future wrt that of seedP
+#ifdef WITH_OPENMP
+    int iThread = omp_get_thread_num();
+#else
+    int iThread = 0;
+#endif
+    const auto boxP = getSeedBox(seedP);
+    auto& candidates = mPairCandidatesTmp[iThread];
+    // loop over the groups of negative tracks with the same lowest-ID vertex, starting from the 1st negative track of lowest-ID vertex of positive
+    for (int groupN = firstN; groupN < ntrN; groupN = mNegGroupEnd[groupN]) {
+      if (mTracksPool[NEG][groupN].vBracket > seedP.vBracket) { // all vertices compatible with the seeds of the group are in future wrt that of seedP
         LOG(debug) << "Brackets do not match";
         break;
       }
-      if (mSVParams->maxPVContributors < 2 && seedP.gid.isPVContributor() + seedN.gid.isPVContributor() > mSVParams->maxPVContributors) {
-        continue;
+      selectPairCandidates(boxP, groupN, candidates);
+      for (int itn : candidates) {
+        auto& seedN = mTracksPool[NEG][itn];
+        if (mSVParams->maxPVContributors < 2 && seedP.gid.isPVContributor() + seedN.gid.isPVContributor() > mSVParams->maxPVContributors) {
+          continue;
+        }
+        // skip the pairs for which the DCA fitter would find no seed, with the max. XY distance it uses for this pair
+        bool isTPConly = seedP.gid.getSource() == GIndex::TPC || seedN.gid.getSource() == GIndex::TPC;
+        if (!checkSeedCircles(seedP, seedN, (mSVParams->mTPCTrackPhotonTune && isTPConly) ? mMaxDXYPreselectionTPC : mMaxDXYPreselection)) {
+          continue;
+        }
+        checkV0(seedP, seedN, itp, itn, iThread);
       }
-#ifdef WITH_OPENMP
-      int iThread = omp_get_thread_num();
-#else
-      int iThread = 0;
-#endif
-      checkV0(seedP, seedN, itp, itn, iThread);
     }
   }
 
@@ -282,6 +293,12 @@ void SVertexer::updateTimeDependentParams()
     mMaxTgl2Casc = mSVParams->maxTglCasc * mSVParams->maxTglCasc;
     mMinPt23Body = mSVParams->minPt3Body * mSVParams->minPt3Body;
     mMaxTgl23Body = mSVParams->maxTgl3Body * mSVParams->maxTgl3Body;
+    mMaxDXYPreselection = (mSVParams->preselectPairs && mSVParams->maxDXYIni > 0) ? mSVParams->maxDXYIni + mSVParams->preselectionMargin : -1.f;
+    mMaxDXYPreselectionTPC = (mSVParams->preselectPairs && mSVParams->mTPCTrackMaxDXYIni > 0) ? mSVParams->mTPCTrackMaxDXYIni + mSVParams->preselectionMargin : -1.f;
+    mMaxDXYPreselectionBox = mMaxDXYPreselection;
+    if (mSVParams->mTPCTrackPhotonTune && mMaxDXYPreselectionBox >= 0) {
+      mMaxDXYPreselectionBox = mMaxDXYPreselectionTPC < 0 ? -1.f : std::max(mMaxDXYPreselectionBox, mMaxDXYPreselectionTPC);
+    }
     setupThreads();
   }
   auto bz = o2::base::Propagator::Instance()->getNominalBz();
@@ -346,6 +363,7 @@ void SVertexer::setupThreads()
   mCascadesIdxTmp.resize(mNThreads);
   m3bodyIdxTmp.resize(mNThreads);
   mFitterV0.resize(mNThreads);
+  mPairCandidatesTmp.resize(mNThreads);
   mBz = o2::base::Propagator::Instance()->getNominalBz();
   int fitCounter = 0;
   for (auto& fitter : mFitterV0) {
@@ -559,12 +577,14 @@ void SVertexer::buildT2V(const o2::globaltracking::RecoContainer& recoData) // a
       }
     }
   }
-  // register 1st track of each charge for each vertex
+  // register 1st track of each charge for each vertex and set the circles of the final seeds, with the field of the fitter
+  const float bzFitter = mFitterV0[0].getBz();
   for (int pn = 0; pn < 2; pn++) {
     auto& vtxFirstT = mVtxFirstTrack[pn];
-    const auto& tracksPool = mTracksPool[pn];
+    auto& tracksPool = mTracksPool[pn];
     for (unsigned i = 0; i < tracksPool.size(); i++) {
-      const auto& t = tracksPool[i];
+      auto& t = tracksPool[i];
+      setSeedCircle(t, bzFitter);
       for (int j{t.vBracket.getMin()}; j <= t.vBracket.getMax(); ++j) {
         if (vtxFirstT[j] == -1) {
           vtxFirstT[j] = i;
@@ -573,9 +593,62 @@ void SVertexer::buildT2V(const o2::globaltracking::RecoContainer& recoData) // a
     }
   }
 
+  buildNegSeedsIndex();
+
   LOG(info) << "Collected " << mTracksPool[POS].size() << " positive and " << mTracksPool[NEG].size() << " negative seeds";
 }
 
+//__________________________________________________________________
+void SVertexer::buildNegSeedsIndex()
+{
+  // group the negative seeds with the same lowest-ID vertex, which are contiguous in the pool, and sort each group in the xMin of the seed circle boxes
+  const auto& tracksPool = mTracksPool[NEG];
+  int ntr = tracksPool.size();
+  mNegBoxes.resize(ntr);
+  mNegGroupFirst.resize(ntr);
+  mNegGroupEnd.resize(ntr);
+  mNegSortedID.resize(ntr);
+  mNegSortedXMin.resize(ntr);
+  for (int i = 0; i < ntr; i++) {
+    mNegBoxes[i] = getSeedBox(tracksPool[i]);
+  }
+  for (int first = 0, end = 0; first < ntr; first = end) {
+    while (end < ntr && tracksPool[end].vBracket.getMin() == tracksPool[first].vBracket.getMin()) {
+      end++;
+    }
+    std::fill(mNegGroupFirst.begin() + first, mNegGroupFirst.begin() + end, first);
+    std::fill(mNegGroupEnd.begin() + first, mNegGroupEnd.begin() + end, end);
+    std::iota(mNegSortedID.begin() + first, mNegSortedID.begin() + end, first);
+    std::sort(mNegSortedID.begin() + first, mNegSortedID.begin() + end, [this](int i1, int i2) { return mNegBoxes[i1].xMin < mNegBoxes[i2].xMin; });
+    for (int i = first; i < end; i++) {
+      mNegSortedXMin[i] = mNegBoxes[mNegSortedID[i]].xMin;
+    }
+  }
+}
+
+//__________________________________________________________________
+void SVertexer::selectPairCandidates(const SeedBox& boxP, int firstN, std::vector<int>& candidates) const
+{
+  // select the negative seeds of the group of firstN, from firstN on, whose circle box is close enough to the one of the positive seed
+  candidates.clear();
+  int groupFirst = mNegGroupFirst[firstN], groupEnd = mNegGroupEnd[firstN];
+  if (mMaxDXYPreselectionBox < 0) {
+    for (int i = firstN; i < groupEnd; i++) {
+      candidates.push_back(i);
+    }
+    return;
+  }
+  // only the seeds with xMin below the xMax of the positive seed box may pass
+  int sortedEnd = std::upper_bound(mNegSortedXMin.begin() + groupFirst, mNegSortedXMin.begin() + groupEnd, boxP.xMax + mMaxDXYPreselectionBox) - mNegSortedXMin.begin();
+  for (int is = groupFirst; is < sortedEnd; is++) {
+    int i = mNegSortedID[is];
+    if (i >= firstN && checkSeedBoxes(boxP, mNegBoxes[i], mMaxDXYPreselectionBox)) {
+      candidates.push_back(i);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end()); // the pairs are checked in the order of the pool
+}
+
 //__________________________________________________________________
 bool SVertexer::checkV0(const TrackCand& seedP, const TrackCand& seedN, int iP, int iN, int ithread)
 {
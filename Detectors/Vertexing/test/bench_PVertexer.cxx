@@ -0,0 +1,159 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  bench_PVertexer.cxx
+/// \brief benchmark of the primary vertex finder on a tracks pool
+///
+/// The synthetic benchmark arguments are the number of vertices in the pool, the usage of the time-Z grid for
+/// the DBScan neighbours search and the number of threads. The tracks pool dumped by the PVertexer, as done by
+/// the primary vertexing workflow with --pool-dumps-directory, is replayed as well if the PVERTEXER_BENCH_POOL
+/// environment variable points to its file, with the configurable params given by PVERTEXER_BENCH_CONFIG, if set.
+/// The equivalence of the vertices found with the different settings is checked by the PVertexer unit test.
+
+#include "benchmark/benchmark.h"
+#include "DetectorsVertexing/PVertexer.h"
+#include "DetectorsBase/Propagator.h"
+#include "Field/MagneticField.h"
+#include <TFile.h>
+#include <TGeoGlobalMagField.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+using namespace o2::vertexing;
+
+static constexpr float ITSROFLENGTHMUS = 198 * o2::constants::lhc::LHCBunchSpacingNS * 1e-3; // ITS ROFrame duration in \mus
+static constexpr float TFLENGTHMUS = 32 * o2::constants::lhc::LHCOrbitMUS;                   // time span of the pool
+
+void initField()
+{
+  static std::once_flag flag;
+  std::call_once(flag, [] {
+    auto field = new o2::field::MagneticField("Maps", "Maps", 1., 1., o2::field::MagFieldParam::k5kG);
+    TGeoGlobalMagField::Instance()->SetField(field);
+    TGeoGlobalMagField::Instance()->Lock();
+    o2::base::Propagator::Instance();
+    if (const auto config = std::getenv("PVERTEXER_BENCH_CONFIG")) {
+      o2::conf::ConfigurableParam::updateFromString(config);
+    }
+  });
+}
+
+/// create the pool of tracks sorted in time, from vertices at random time in the TF with 2 to 60 tracks
+std::vector<TrackVF> createPool(int nVertices)
+{
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<float> uniform(0., 1.);
+  std::normal_distribution<float> gaus(0., 1.);
+  std::vector<TrackVF> pool;
+  for (int iv = 0; iv < nVertices; iv++) {
+    float tv = TFLENGTHMUS * uniform(generator), zv = 6. * gaus(generator);
+    int ntr = 2 + int(59 * uniform(generator));
+    for (int it = 0; it < ntr; it++) {
+      float sigYZ = 0.002 + 0.02 * uniform(generator), sigT = uniform(generator) < 0.3 ? ITSROFLENGTHMUS / std::sqrt(12.f) : 0.1f;
+      float alpha = 2. * M_PI * uniform(generator), tgl = 2. * (uniform(generator) - 0.5);
+      std::array<float, 5> params = {sigYZ * gaus(generator), zv + sigYZ * gaus(generator), 0.2f * (uniform(generator) - 0.5f), tgl,
+                                     (uniform(generator) > 0.5 ? 1.f : -1.f) / (0.1f + 3.f * uniform(generator))};
+      std::array<float, 15> covm = {sigYZ * sigYZ, 0., sigYZ * sigYZ, 0., 0., 1e-6, 0., 0., 0., 1e-6, 0., 0., 0., 0., 1e-4};
+      o2::track::TrackParCov trc(0., alpha, params, covm);
+      int entry = pool.size();
+      pool.emplace_back(trc, TimeEst{tv + sigT * gaus(generator), sigT}, entry, GTrackID(entry, GTrackID::ITSTPC), 0.1 * 0.1, 0.005 * 0.005);
+    }
+  }
+  std::sort(pool.begin(), pool.end(), [](const TrackVF& a, const TrackVF& b) { return a.timeEst.getTimeStamp() < b.timeEst.getTimeStamp(); });
+  return pool;
+}
+
+/// read the tracks pool dumped by the PVertexer
+std::vector<TrackVF> readPool(const char* filename)
+{
+  std::vector<TrackVF> pool;
+  TFile poolFile(filename);
+  if (const auto poolPtr = (std::vector<TrackVF>*)poolFile.GetObjectUnchecked("pool")) {
+    pool = *poolPtr;
+  }
+  return pool;
+}
+
+std::unique_ptr<PVertexer> createVertexer(bool useGrid, int nThreads)
+{
+  o2::conf::ConfigurableParam::setValue<bool>("pvertexer", "dbscanUseGrid", useGrid);
+  auto vertexer = std::make_unique<PVertexer>();
+  vertexer->setITSROFrameLength(ITSROFLENGTHMUS);
+  vertexer->setNThreads(nThreads);
+  vertexer->init();
+  return vertexer;
+}
+
+void runVertexer(benchmark::State& state, const std::vector<TrackVF>& pool, bool useGrid, int nThreads)
+{
+  if (pool.empty()) {
+    state.SkipWithError("no input tracks pool");
+    return;
+  }
+  auto vertexer = createVertexer(useGrid, nThreads);
+  std::vector<PVertex> vertices;
+  std::vector<o2::dataformats::VtxTrackIndex> vertexTrackIDs;
+  std::vector<V2TRef> v2tRefs;
+  for (auto _ : state) {
+    vertexer->processFromExternalPool(pool, vertices, vertexTrackIDs, v2tRefs);
+    benchmark::DoNotOptimize(vertices.data());
+  }
+  state.counters["vertices"] = vertices.size();
+  state.counters["TZClusters"] = vertexer->getNTZClusters();
+  state.SetItemsProcessed(state.iterations() * pool.size());
+}
+
+static void BM_PVertexerSynthetic(benchmark::State& state)
+{
+  initField();
+  const auto pool = createPool(state.range(0));
+  runVertexer(state, pool, state.range(1), state.range(2));
+}
+
+static void BM_PVertexerRecorded(benchmark::State& state)
+{
+  initField();
+  const auto filename = std::getenv("PVERTEXER_BENCH_POOL");
+  const auto pool = filename ? readPool(filename) : std::vector<TrackVF>();
+  runVertexer(state, pool, state.range(0), state.range(1));
+}
+
+static void SyntheticArguments(benchmark::internal::Benchmark* bench)
+{
+  // number of vertices, usage of the DBScan grid and number of threads
+  for (const auto nVertices : {100, 1000, 5000}) {
+    for (const auto useGrid : {0, 1}) {
+      for (const auto nThreads : {1, 4, 8}) {
+        bench->Args({nVertices, useGrid, nThreads});
+      }
+    }
+  }
+}
+
+static void RecordedArguments(benchmark::internal::Benchmark* bench)
+{
+  // usage of the DBScan grid and number of threads
+  for (const auto useGrid : {0, 1}) {
+    for (const auto nThreads : {1, 4, 8}) {
+      bench->Args({useGrid, nThreads});
+    }
+  }
+}
+
+BENCHMARK(BM_PVertexerSynthetic)->Apply(SyntheticArguments)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PVertexerRecorded)->Apply(RecordedArguments)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
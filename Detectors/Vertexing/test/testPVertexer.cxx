@@ -0,0 +1,106 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test PVertexer
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "DetectorsVertexing/PVertexer.h"
+#include "DetectorsBase/Propagator.h"
+#include "Field/MagneticField.h"
+#include <TGeoGlobalMagField.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace o2
+{
+namespace vertexing
+{
+
+static constexpr float ITSROFLENGTHMUS = 198 * o2::constants::lhc::LHCBunchSpacingNS * 1e-3; // ITS ROFrame duration in \mus
+
+/// create the pool of tracks sorted in time, from vertices at random time in 32 orbits with 2 to 60 tracks
+std::vector<TrackVF> createPool(int nVertices)
+{
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<float> uniform(0., 1.);
+  std::normal_distribution<float> gaus(0., 1.);
+  std::vector<TrackVF> pool;
+  for (int iv = 0; iv < nVertices; iv++) {
+    float tv = 32 * o2::constants::lhc::LHCOrbitMUS * uniform(generator), zv = 6. * gaus(generator);
+    int ntr = 2 + int(59 * uniform(generator));
+    for (int it = 0; it < ntr; it++) {
+      float sigYZ = 0.002 + 0.02 * uniform(generator), sigT = uniform(generator) < 0.3 ? ITSROFLENGTHMUS / std::sqrt(12.f) : 0.1f;
+      float alpha = 2. * M_PI * uniform(generator), tgl = 2. * (uniform(generator) - 0.5);
+      std::array<float, 5> params = {sigYZ * gaus(generator), zv + sigYZ * gaus(generator), 0.2f * (uniform(generator) - 0.5f), tgl,
+                                     (uniform(generator) > 0.5 ? 1.f : -1.f) / (0.1f + 3.f * uniform(generator))};
+      std::array<float, 15> covm = {sigYZ * sigYZ, 0., sigYZ * sigYZ, 0., 0., 1e-6, 0., 0., 0., 1e-6, 0., 0., 0., 0., 1e-4};
+      o2::track::TrackParCov trc(0., alpha, params, covm);
+      int entry = pool.size();
+      pool.emplace_back(trc, TimeEst{tv + sigT * gaus(generator), sigT}, entry, GTrackID(entry, GTrackID::ITSTPC), 0.1 * 0.1, 0.005 * 0.005);
+    }
+  }
+  std::sort(pool.begin(), pool.end(), [](const TrackVF& a, const TrackVF& b) { return a.timeEst.getTimeStamp() < b.timeEst.getTimeStamp(); });
+  return pool;
+}
+
+struct Result {
+  std::vector<PVertex> vertices;
+  std::vector<o2::dataformats::VtxTrackIndex> vertexTrackIDs;
+  std::vector<V2TRef> v2tRefs;
+};
+
+Result findVertices(const std::vector<TrackVF>& pool, bool useGrid, int nThreads)
+{
+  o2::conf::ConfigurableParam::setValue<bool>("pvertexer", "dbscanUseGrid", useGrid);
+  PVertexer vertexer;
+  vertexer.setITSROFrameLength(ITSROFLENGTHMUS);
+  vertexer.setNThreads(nThreads);
+  vertexer.init();
+  Result result;
+  vertexer.processFromExternalPool(pool, result.vertices, result.vertexTrackIDs, result.v2tRefs);
+  return result;
+}
+
+BOOST_AUTO_TEST_CASE(PVertexerGridAndThreads)
+{
+  auto field = new o2::field::MagneticField("Maps", "Maps", 1., 1., o2::field::MagFieldParam::k5kG);
+  TGeoGlobalMagField::Instance()->SetField(field);
+  TGeoGlobalMagField::Instance()->Lock();
+  o2::base::Propagator::Instance();
+
+  // the vertices found with the DBScan grid and with several threads must be the ones found sequentially with the linear scan
+  const auto pool = createPool(500);
+  const auto reference = findVertices(pool, false, 1);
+  BOOST_REQUIRE(!reference.vertices.empty());
+  for (const bool useGrid : {false, true}) {
+    for (const int nThreads : {1, 4}) {
+      const auto result = findVertices(pool, useGrid, nThreads);
+      BOOST_REQUIRE_EQUAL(result.vertices.size(), reference.vertices.size());
+      BOOST_CHECK(result.vertexTrackIDs == reference.vertexTrackIDs);
+      for (size_t iv = 0; iv < reference.vertices.size(); iv++) {
+        const auto &vtx = result.vertices[iv], &vtxRef = reference.vertices[iv];
+        BOOST_CHECK_EQUAL(vtx.getX(), vtxRef.getX());
+        BOOST_CHECK_EQUAL(vtx.getY(), vtxRef.getY());
+        BOOST_CHECK_EQUAL(vtx.getZ(), vtxRef.getZ());
+        BOOST_CHECK_EQUAL(vtx.getNContributors(), vtxRef.getNContributors());
+        BOOST_CHECK_EQUAL(vtx.getTimeStamp().getTimeStamp(), vtxRef.getTimeStamp().getTimeStamp());
+        BOOST_CHECK_EQUAL(result.v2tRefs[iv].getFirstEntry(), reference.v2tRefs[iv].getFirstEntry());
+      }
+    }
+  }
+}
+
+} // namespace vertexing
+} // namespace o2
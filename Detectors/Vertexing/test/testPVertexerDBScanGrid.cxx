@@ -0,0 +1,98 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test PVertexer DBScan grid
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "DetectorsVertexing/PVertexerHelpers.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace o2
+{
+namespace vertexing
+{
+
+/// create a pool of tracks sorted in time, from vertices with a spread of Z and time errors and some tracks without Z error
+std::vector<TrackVF> createPool(int nVertices, std::mt19937& generator)
+{
+  std::uniform_real_distribution<float> uniform(0., 1.);
+  std::normal_distribution<float> gaus(0., 1.);
+  std::vector<TrackVF> pool;
+  for (int iv = 0; iv < nVertices; iv++) {
+    float tv = 1000. * uniform(generator), zv = 6. * gaus(generator);
+    int ntr = 1 + int(40 * uniform(generator));
+    for (int it = 0; it < ntr; it++) {
+      auto& trc = pool.emplace_back();
+      float sigZ = std::pow(10.f, -3.f + 3.f * uniform(generator)), sigT = uniform(generator) < 0.3 ? 2.5f : 0.1f;
+      trc.z = zv + sigZ * gaus(generator);
+      trc.sig2ZI = uniform(generator) < 0.01 ? 0.f : 1.f / (sigZ * sigZ);
+      trc.timeEst = TimeEst{tv + sigT * gaus(generator), sigT};
+    }
+  }
+  std::sort(pool.begin(), pool.end(), [](const TrackVF& a, const TrackVF& b) { return a.timeEst.getTimeStamp() < b.timeEst.getTimeStamp(); });
+  return pool;
+}
+
+BOOST_AUTO_TEST_CASE(PVertexerDBScanGrid)
+{
+  std::mt19937 generator(1234);
+  const float maxDist2 = 9., deltaT = 3.;
+  const auto pool = createPool(200, generator);
+  int ntr = pool.size();
+
+  DBScanGrid grid;
+  grid.build(pool, deltaT, maxDist2);
+  BOOST_REQUIRE(grid.isValid());
+
+  // the neighbours found in the grid candidates must be the ones of the linear scan, in the same order
+  std::vector<int> cand, nbGrid, nbScan;
+  size_t nCand = 0, nNeighbours = 0;
+  for (int id = 0; id < ntr; id++) {
+    const auto& tI = pool[id];
+    nbScan.clear();
+    for (int idL = id - 1; idL >= 0 && std::abs(tI.timeEst.getTimeStamp() - pool[idL].timeEst.getTimeStamp()) <= deltaT; idL--) {
+      if (pool[idL].getDist2(tI) < maxDist2) {
+        nbScan.push_back(idL);
+      }
+    }
+    for (int idU = id + 1; idU < ntr && std::abs(tI.timeEst.getTimeStamp() - pool[idU].timeEst.getTimeStamp()) <= deltaT; idU++) {
+      if (pool[idU].getDist2(tI) < maxDist2) {
+        nbScan.push_back(idU);
+      }
+    }
+    grid.getNeighbourCandidates(id, cand);
+    nbGrid.clear();
+    for (auto idN : cand) {
+      if (pool[idN].getDist2(tI) < maxDist2) {
+        nbGrid.push_back(idN);
+      }
+    }
+    BOOST_CHECK_EQUAL_COLLECTIONS(nbGrid.begin(), nbGrid.end(), nbScan.begin(), nbScan.end());
+    nCand += cand.size();
+    nNeighbours += nbScan.size();
+  }
+  BOOST_CHECK(nNeighbours > 0);
+  BOOST_TEST_MESSAGE("grid candidates: " << nCand << ", neighbours: " << nNeighbours);
+
+  // a pool not sorted in time cannot use the grid
+  auto unsorted = pool;
+  std::swap(unsorted.front(), unsorted.back());
+  grid.build(unsorted, deltaT, maxDist2);
+  BOOST_CHECK(!grid.isValid());
+}
+
+} // namespace vertexing
+} // namespace o2
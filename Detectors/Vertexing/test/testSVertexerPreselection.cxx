@@ -0,0 +1,87 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test SVertexer pairs preselection
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "DetectorsVertexing/SVertexer.h"
+#include "DCAFitter/DCAFitterN.h"
+#include <array>
+#include <random>
+#include <vector>
+
+namespace o2
+{
+namespace vertexing
+{
+
+/// create seeds starting at random points up to 50 cm from the beam line, as secondary tracks
+std::vector<SVertexer::TrackCand> createSeeds(int nSeeds, float sign, std::mt19937& generator)
+{
+  std::uniform_real_distribution<float> uniform(0., 1.);
+  const std::array<float, 15> covm = {1e-4, 0., 1e-4, 0., 0., 1e-6, 0., 0., 0., 1e-6, 0., 0., 0., 0., 4e-4};
+  std::vector<SVertexer::TrackCand> seeds;
+  for (int i = 0; i < nSeeds; i++) {
+    float r = 50. * uniform(generator), alpha = 2. * M_PI * uniform(generator);
+    std::array<float, 5> params = {r * (uniform(generator) - 0.5f), 20.f * (uniform(generator) - 0.5f), 1.6f * (uniform(generator) - 0.5f),
+                                   uniform(generator) - 0.5f, sign / (0.1f + 3.f * uniform(generator))};
+    seeds.emplace_back(SVertexer::TrackCand{o2::track::TrackParCov(r, alpha, params, covm)});
+  }
+  return seeds;
+}
+
+BOOST_AUTO_TEST_CASE(SVertexerPreselection)
+{
+  constexpr int NSeeds = 300;
+  constexpr float Bz = 5.;
+  std::mt19937 generator(1234);
+  auto seedsP = createSeeds(NSeeds, 1., generator);
+  auto seedsN = createSeeds(NSeeds, -1., generator);
+  for (auto& seed : seedsP) {
+    SVertexer::setSeedCircle(seed, Bz);
+  }
+  for (auto& seed : seedsN) {
+    SVertexer::setSeedCircle(seed, Bz);
+  }
+
+  for (float maxDXY : {4.f, 8.f}) {
+    DCAFitterN<2> fitter;
+    fitter.setBz(Bz);
+    fitter.setUseAbsDCA(true);
+    fitter.setPropagateToPCA(false);
+    fitter.setMaxDXYIni(maxDXY);
+    int nPairs = 0, nRejected = 0, nLost = 0, nRejectedBox = 0, nLostBox = 0;
+    for (const auto& seedP : seedsP) {
+      const auto boxP = SVertexer::getSeedBox(seedP);
+      for (const auto& seedN : seedsN) {
+        nPairs++;
+        bool passCircles = SVertexer::checkSeedCircles(seedP, seedN, maxDXY);
+        if (!passCircles) {
+          nRejected++;
+          nLost += fitter.process(seedP, seedN) > 0; // the preselection must not reject pairs the fitter accepts
+        }
+        if (!SVertexer::checkSeedBoxes(boxP, SVertexer::getSeedBox(seedN), maxDXY)) {
+          nRejectedBox++;
+          nLostBox += passCircles; // the index of the seed boxes must not reject pairs the circles preselection accepts
+        }
+      }
+    }
+    BOOST_TEST_MESSAGE("max. XY distance " << maxDXY << ": " << nRejected << " out of " << nPairs << " pairs preselected out, " << nRejectedBox << " by their boxes");
+    BOOST_CHECK(nRejected > 0);
+    BOOST_CHECK_EQUAL(nLost, 0);
+    BOOST_CHECK_EQUAL(nLostBox, 0);
+  }
+}
+
+} // namespace vertexing
+} // namespace o2
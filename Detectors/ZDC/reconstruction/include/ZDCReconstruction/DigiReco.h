@@ -11,6 +11,7 @@
 
 #include <map>
 #include <deque>
+#include <vector>
 #include <gsl/span>
 #include <TFile.h>
 #include <TTree.h>
@@ -60,6 +61,25 @@ struct DigiRecoTDC {
   o2::InteractionRecord ir;
 };
 
+/// Working state of the reconstruction of a range of consecutive bunch crossings.
+/// Independent ranges are processed in parallel, each thread with its own state
+struct DigiRecoState {
+  float offset[NChannels];            /// Offset in current orbit
+  uint32_t offsetOrbit = 0xffffffff;  /// Current orbit
+  uint8_t source[NChannels];          /// Source of pedestal
+  bool inError = false;               /// Reconstruction ended in error
+  // Configuration of interpolation for current signal
+  int nbun;                           /// Number of adjacent bunches
+  int nsam;                           /// Number of acquired samples
+  int ntot;                           /// Total number of points in the interpolated arrays
+  int ilast;                          /// Index of last acquired sample
+  int nint;                           /// Total points in the interpolation region (-1)
+  O2_ZDC_DIGIRECO_FLT firstSample;    /// First acquired sample
+  O2_ZDC_DIGIRECO_FLT lastSample;     /// Last acquired sample
+  std::vector<O2_ZDC_DIGIRECO_FLT> y; /// Acquired samples extended by TSL points on each side
+  std::vector<O2_ZDC_DIGIRECO_FLT> s; /// Interpolated points for one phase of the sinc function
+};
+
 class DigiReco
 {
  public:
@@ -133,6 +153,9 @@ class DigiReco
     LOG(warn) << __func__ << " Configuration of TDC pile-up correction: " << (mCorrBackground ? "enabled" : "disabled");
   };
   bool getCorrBackground() { return mCorrBackground; };
+  // Number of threads used to process independent ranges of bunch crossings
+  void setNThreads(int n) { mNThreads = n > 1 ? n : 1; };
+  int getNThreads() const { return mNThreads; };
   bool inError()
   {
     return mInError;
@@ -143,37 +166,38 @@ class DigiReco
   const std::vector<o2::zdc::RecEventAux>& getReco() { return mReco; }
 
  private:
-  const ModuleConfig* mModuleConfig = nullptr;              /// Trigger/readout configuration object
-  void updateOffsets(int ibun);                             /// Update offsets to process current bunch
-  void lowPassFilter();                                     /// low-pass filtering of digitized data
-  int reconstructTDC(int seq_beg, int seq_end);             /// Reconstruction of uncorrected TDCs
-  int reconstruct(int seq_beg, int seq_end);                /// Main method for data reconstruction
-  int processTrigger(int itdc, int ibeg, int iend);         /// Replay of trigger algorithm on acquired data
-  int processTriggerExtended(int itdc, int ibeg, int iend); /// Replay of trigger algorithm on acquired data
-  int interpolate(int itdc, int ibeg, int iend);            /// Interpolation of samples to evaluate signal amplitude and arrival time
-  int fullInterpolation(int itdc, int ibeg, int iend);      /// Interpolation of samples
-  void correctTDCPile();                                    /// Correction of pile-up in TDC
-  bool mLowPassFilter = true;                               /// Enable low pass filtering
-  bool mLowPassFilterSet = false;                           /// Low pass filtering set via function call
-  bool mFullInterpolation = false;                          /// Full waveform interpolation
-  bool mFullInterpolationSet = false;                       /// Full waveform interpolation set via function call
-  int mFullInterpolationMinLength = 2;                      /// Minimum length to perform full interpolation
-  int mInterpolationStep = 25;                              /// Coarse interpolation step
-  bool mCorrSignal = true;                                  /// Enable TDC signal correction
-  bool mCorrSignalSet = false;                              /// TDC signal correction set via function call
-  bool mCorrBackground = true;                              /// Enable TDC pile-up correction
-  bool mCorrBackgroundSet = false;                          /// TDC pile-up correction set via function call
-  bool mInError = false;                                    /// ZDC reconstruction ends in error
-  int mAssignedTDC[NTDCChannels] = {0};                     /// Number of assigned TDCs in sequence (debugging)
+  const ModuleConfig* mModuleConfig = nullptr;                                 /// Trigger/readout configuration object
+  void updateOffsets(DigiRecoState& st, int ibun);                             /// Update offsets to process current bunch
+  void lowPassFilter();                                                        /// low-pass filtering of digitized data
+  int findSequences();                                                         /// Find ranges of consecutive bunch crossings
+  int reconstructTDC(DigiRecoState& st, int seq_beg, int seq_end);             /// Reconstruction of uncorrected TDCs
+  int reconstruct(DigiRecoState& st, int seq_beg, int seq_end);                /// Main method for data reconstruction
+  int processTrigger(DigiRecoState& st, int itdc, int ibeg, int iend);         /// Replay of trigger algorithm on acquired data
+  int processTriggerExtended(DigiRecoState& st, int itdc, int ibeg, int iend); /// Replay of trigger algorithm on acquired data
+  int interpolate(DigiRecoState& st, int itdc, int ibeg, int iend);            /// Interpolation of samples to evaluate signal amplitude and arrival time
+  int fullInterpolation(DigiRecoState& st, int itdc, int ibeg, int iend);      /// Interpolation of samples
+  void correctTDCPile();                                                       /// Correction of pile-up in TDC
+  bool mLowPassFilter = true;                                                  /// Enable low pass filtering
+  bool mLowPassFilterSet = false;                                              /// Low pass filtering set via function call
+  bool mFullInterpolation = false;                                             /// Full waveform interpolation
+  bool mFullInterpolationSet = false;                                          /// Full waveform interpolation set via function call
+  int mFullInterpolationMinLength = 2;                                         /// Minimum length to perform full interpolation
+  int mInterpolationStep = 25;                                                 /// Coarse interpolation step
+  bool mCorrSignal = true;                                                     /// Enable TDC signal correction
+  bool mCorrSignalSet = false;                                                 /// TDC signal correction set via function call
+  bool mCorrBackground = true;                                                 /// Enable TDC pile-up correction
+  bool mCorrBackgroundSet = false;                                             /// TDC pile-up correction set via function call
+  bool mInError = false;                                                       /// ZDC reconstruction ends in error
+  int mAssignedTDC[NTDCChannels] = {0};                                        /// Number of assigned TDCs in sequence (debugging)
 
   int correctTDCSignal(int itdc, int16_t TDCVal, float TDCAmp, float& fTDCVal, float& fTDCAmp, bool isbeg, bool isend); /// Correct TDC single signal
   int correctTDCBackground(int ibc, int itdc, std::deque<DigiRecoTDC>& tdc);                                            /// TDC amplitude and time corrections due to pile-up from previous bunches
 
-  O2_ZDC_DIGIRECO_FLT getPoint(int itdc, int ibeg, int iend, int i); /// Interpolation for current TDC
-  void setPoint(int itdc, int ibeg, int iend, int i);                /// Interpolation for current TDC
+  O2_ZDC_DIGIRECO_FLT getPoint(DigiRecoState& st, int itdc, int ibeg, int iend, int i); /// Interpolation for current TDC
+  void setPoints(DigiRecoState& st, int isig, int ibeg, int iend);                      /// Interpolation of all the points of current signal
 
-  void assignTDC(int ibun, int ibeg, int iend, int itdc, int tdc, float amp); /// Set reconstructed TDC values
-  void findSignals(int ibeg, int iend);                                       /// Find signals around main-main that satisfy condition on TDC
+  void assignTDC(DigiRecoState& st, int ibun, int ibeg, int iend, int itdc, int tdc, float amp); /// Set reconstructed TDC values
+  void findSignals(DigiRecoState& st, int ibeg, int iend);                                       /// Find signals around main-main that satisfy condition on TDC
   const RecoParamZDC* mRopt = nullptr;
   bool mIsContinuous = true;                     /// continuous (self-triggered) or externally-triggered readout
   uint8_t mTriggerCondition = 0x3;               /// Trigger condition: 0x1 single, 0x3 double and 0x7 triple
@@ -189,6 +213,7 @@ class DigiReco
   const RecoConfigZDC* mRecoConfigZDC = nullptr; /// CCDB configuration parameters
   int32_t mVerbosity = DbgMinimal;
   O2_ZDC_DIGIRECO_FLT mTS[NTS];                     /// Tapered sinc function
+  O2_ZDC_DIGIRECO_FLT mTSNorm[TSN];                 /// Sum of the tapered sinc function coefficients for each interpolation phase
   bool mTreeDbg = false;                            /// Write reconstructed data in debug output file
   std::unique_ptr<TFile> mDbg = nullptr;            /// Debug output file
   std::unique_ptr<TTree> mTDbg = nullptr;           /// Debug tree
@@ -197,9 +222,9 @@ class DigiReco
   gsl::span<const o2::zdc::ChannelData> mChData;    /// Payload
   std::vector<o2::zdc::RecEventAux> mReco;          /// Reconstructed data
   std::map<uint32_t, int> mOrbit;                   /// Information about orbit
-  float mOffset[NChannels];                         /// Offset in current orbit
-  uint32_t mOffsetOrbit = 0xffffffff;               /// Current orbit
-  uint8_t mSource[NChannels];                       /// Source of pedestal
+  int mNThreads = 1;                                /// Number of threads
+  std::vector<DigiRecoState> mState;                /// Working state, one per thread
+  std::vector<std::pair<int, int>> mSequences;      /// Ranges of consecutive bunch crossings
   static constexpr int mNSB = TSN * NTimeBinsPerBC; /// Total number of interpolated points per bunch crossing
   RecEventAux mRec;                                 /// Debug reconstruction event
   int mNBC = 0;
@@ -212,14 +237,6 @@ class DigiReco
   float tdc_offset[NTDCChannels] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0}; /// TDC offset
   constexpr static uint16_t mMask[NTimeBinsPerBC] = {0x0001, 0x002, 0x004, 0x008, 0x0010, 0x0020, 0x0040, 0x0080, 0x0100, 0x0200, 0x0400, 0x0800};
   O2_ZDC_DIGIRECO_FLT mAlpha = 3; // Parameter of interpolation function
-  // Configuration of interpolation for current TDC
-  int mNbun;  // Number of adjacent bunches
-  int mNsam;  // Number of acquired samples
-  int mNtot;  // Total number of points in the interpolated arrays
-  int mIlast; // Index of last acquired sample
-  int mNint;  // Total points in the interpolation region (-1)
-  O2_ZDC_DIGIRECO_FLT mFirstSample;
-  O2_ZDC_DIGIRECO_FLT mLastSample;
 };
 } // namespace zdc
 } // namespace o2
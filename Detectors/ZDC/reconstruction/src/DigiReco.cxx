@@ -14,6 +14,12 @@
 #include "ZDCReconstruction/DigiReco.h"
 #include "ZDCReconstruction/RecoParamZDC.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#else
+static inline int omp_get_thread_num() { return 0; }
+#endif
+
 namespace o2
 {
 namespace zdc
@@ -486,6 +492,14 @@ void DigiReco::prepareInterpolation()
     mTS[n + tsi] = fs * fg;
     mTS[n - tsi] = mTS[n + tsi]; // Function is even
   }
+  // Sum of the coefficients used for each phase of the interpolation (same order of operations as in getPoint)
+  for (int im = 0; im < TSN; im++) {
+    O2_ZDC_DIGIRECO_FLT sum = 0;
+    for (int is = TSN - im; is < NTS; is += TSN) {
+      sum += mTS[is];
+    }
+    mTSNorm[im] = sum;
+  }
   LOG(info) << "Interpolation numeric precision is " << sizeof(O2_ZDC_DIGIRECO_FLT);
   LOG(info) << "Interpolation alpha = " << mAlpha;
 }
@@ -628,63 +642,87 @@ int DigiReco::process(const gsl::span<const o2::zdc::OrbitData>& orbitdata, cons
   // With this definition of "consecutive" bunch crossings gaps in the sample data
   // may be present, therefore in the reconstruction method we take into account for signals
   // that do not span the entire range
-  int seq_beg = 0;
-  int seq_end = 0;
   if (mVerbosity > DbgMinimal) {
     LOG(info) << "Processing ZDC reconstruction for " << mNBC << " bunch crossings";
   }
+  int seq_err = findSequences();
+  int nseq = mSequences.size();
 
-  // TDC reconstruction
-  for (int ibc = 0; ibc < mNBC; ibc++) {
-    auto& ir = mBCData[seq_end].ir;
-    auto bcd = mBCData[ibc].ir.differenceInBC(ir);
-    if (bcd < 0) {
-      LOG(error) << "Bunch order error in TDC reconstruction";
-      for (int ibcdump = 0; ibcdump < mNBC; ibcdump++) {
-        LOG(error) << "mBCData[" << ibcdump << "] @ " << mBCData[ibcdump].ir.orbit << "." << mBCData[ibcdump].ir.bc;
-      }
-      LOG(error) << "Orbit number is not increasing " << mBCData[seq_end].ir.orbit << "." << mBCData[seq_end].ir.bc << " followed by " << mBCData[ibc].ir.orbit << "." << mBCData[ibc].ir.bc;
-      return __LINE__;
-    } else if (bcd > 1) {
-      // Detected a gap
-      int rval = reconstructTDC(seq_beg, seq_end);
-      if (rval) {
-        return rval;
-      }
-
-      seq_beg = ibc;
-      seq_end = ibc;
-    } else if (ibc == (mNBC - 1)) {
-      // Last bunch
-      seq_end = ibc;
-      int rval = reconstructTDC(seq_beg, seq_end);
-      if (rval) {
-        return rval;
-      }
-
-      seq_beg = mNBC;
-      seq_end = mNBC;
-    } else {
-      // Look for another bunch
-      seq_end = ibc;
-    }
+  // Ranges of consecutive bunch crossings are independent and are processed in parallel,
+  // each thread with its own working state. Debug output needs the sequential order
+  int nThreads = mTreeDbg ? 1 : mNThreads;
 #ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
-    // Here in order to avoid mixing information
-    mBCData[ibc].print(mTriggerMask);
+  nThreads = 1;
 #endif
+  if (mState.size() < static_cast<size_t>(nThreads)) {
+    mState.resize(nThreads);
+  }
+  for (auto& st : mState) {
+    st.inError = false;
+  }
+  std::vector<int> rval(nseq, 0);
+
+  // TDC reconstruction
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads)
+#endif
+  for (int iseq = 0; iseq < nseq; iseq++) {
+    rval[iseq] = reconstructTDC(mState[omp_get_thread_num()], mSequences[iseq].first, mSequences[iseq].second);
+  }
+  for (auto& st : mState) {
+    mInError = mInError || st.inError;
+  }
+  for (int iseq = 0; iseq < nseq; iseq++) {
+    if (rval[iseq]) {
+      return rval[iseq];
+    }
+  }
+  if (seq_err) {
+    return seq_err;
   }
 
   // Apply pile-up correction for TDCs to get corrected TDC amplitudes and values
   correctTDCPile();
 
+  // After pile-up correction, find signals around main-main that satisfy condition on TDC
+  // This is done for all the ranges before ADC reconstruction because it looks at the
+  // fired channels of the preceding bunch crossings (lonely bunches are not reconstructed)
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads)
+#endif
+  for (int iseq = 0; iseq < nseq; iseq++) {
+    if (mSequences[iseq].first != mSequences[iseq].second) {
+      findSignals(mState[omp_get_thread_num()], mSequences[iseq].first, mSequences[iseq].second);
+    }
+  }
+
   // ADC reconstruction
-  seq_beg = 0;
-  seq_end = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads)
+#endif
+  for (int iseq = 0; iseq < nseq; iseq++) {
+    rval[iseq] = reconstruct(mState[omp_get_thread_num()], mSequences[iseq].first, mSequences[iseq].second);
+  }
+  for (int iseq = 0; iseq < nseq; iseq++) {
+    if (rval[iseq] != 0) {
+      return rval[iseq];
+    }
+  }
+  return 0;
+} // process
+
+int DigiReco::findSequences()
+{
+  // Ranges of consecutive bunch crossings [seq_beg, seq_end] in mSequences
+  // In case of error, the ranges found before the error are kept
+  mSequences.clear();
+  int seq_beg = 0;
+  int seq_end = 0;
   for (int ibc = 0; ibc < mNBC; ibc++) {
     auto& ir = mBCData[seq_end].ir;
     auto bcd = mBCData[ibc].ir.differenceInBC(ir);
     if (bcd < 0) {
-      LOG(error) << "Bunch order error in ADC reconstruction";
+      LOG(error) << "Bunch order error in ZDC reconstruction";
       for (int ibcdump = 0; ibcdump < mNBC; ibcdump++) {
         LOG(error) << "mBCData[" << ibcdump << "] @ " << mBCData[ibcdump].ir.orbit << "." << mBCData[ibcdump].ir.bc;
       }
@@ -692,28 +730,26 @@ int DigiReco::process(const gsl::span<const o2::zdc::OrbitData>& orbitdata, cons
       return __LINE__;
     } else if (bcd > 1) {
       // Detected a gap
-      int rval = reconstruct(seq_beg, seq_end);
-      if (rval != 0) {
-        return rval;
-      }
+      mSequences.emplace_back(seq_beg, seq_end);
       seq_beg = ibc;
       seq_end = ibc;
     } else if (ibc == (mNBC - 1)) {
       // Last bunch
       seq_end = ibc;
-      int rval = reconstruct(seq_beg, seq_end);
-      if (rval != 0) {
-        return rval;
-      }
+      mSequences.emplace_back(seq_beg, seq_end);
       seq_beg = mNBC;
       seq_end = mNBC;
     } else {
       // Look for another bunch
       seq_end = ibc;
     }
+#ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
+    // Here in order to avoid mixing information
+    mBCData[ibc].print(mTriggerMask);
+#endif
   }
   return 0;
-} // process
+} // findSequences
 
 void DigiReco::lowPassFilter()
 {
@@ -725,9 +761,13 @@ void DigiReco::lowPassFilter()
   LOG(info) << __func__;
 #endif
   constexpr int MaxTimeBin = NTimeBinsPerBC - 1;
-  for (int itdc = 0; itdc < NTDCChannels; itdc++) {
-    auto isig = TDCSignal[itdc];
-    for (int ibc = 0; ibc < mNBC; ibc++) {
+  // Bunch crossings are independent, each of them is filtered for all TDC channels
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) num_threads(mNThreads)
+#endif
+  for (int ibc = 0; ibc < mNBC; ibc++) {
+    for (int itdc = 0; itdc < NTDCChannels; itdc++) {
+      auto isig = TDCSignal[itdc];
       // Indexes of current, previous and next recorded bunch crossings
       auto ref_c = mReco[ibc].ref[isig];
       uint32_t ref_p = ZDCRefInitVal;
@@ -743,53 +783,40 @@ void DigiReco::lowPassFilter()
         bcd_n = mReco[ibc + 1].ir.differenceInBC(mReco[ibc].ir); // b.c. number of (ibc+1) -  b.c. number (ibc)
       }
       if (ref_c != ZDCRefInitVal) { // Should always be true
+        // Samples of current bunch crossing with one sample before and after
+        int32_t ext[NTimeBinsPerBC + 2];
         for (int is = 0; is < NTimeBinsPerBC; is++) {
-          int32_t sum = mChData[ref_c].data[is];
-          if (is == 0) {
-            sum += mChData[ref_c].data[1];
-            if (ref_p != ZDCRefInitVal && bcd_p == 1) {
-              // Add last sample of previous bunch crossing
-              sum += mChData[ref_p].data[MaxTimeBin];
-            } else {
-              // As a backup we count twice the first sample
-              sum += mChData[ref_c].data[0];
-            }
-          } else if (is == MaxTimeBin) {
-            sum += mChData[ref_c].data[MaxTimeBin - 1];
-            if (ref_n != ZDCRefInitVal && bcd_n == 1) {
-              // Add first sample of next bunch crossing
-              sum += mChData[ref_n].data[0];
-            } else {
-              // As a backup we count twice the last sample
-              sum += mChData[ref_c].data[MaxTimeBin];
-            }
-          } else {
-            // Not on the bunch boundary
-            sum += mChData[ref_c].data[is - 1];
-            sum += mChData[ref_c].data[is + 1];
-          }
-          // Make the average taking into account rounding and sign
-          bool isNegative = sum < 0;
-          if (isNegative) {
-            sum = -sum;
-          }
-          auto mod = sum % 3;
-          sum = sum / 3;
-          if (mod == 2) {
-            sum++;
-          }
-          if (isNegative) {
-            sum = -sum;
-          }
+          ext[is + 1] = mChData[ref_c].data[is];
+        }
+        if (ref_p != ZDCRefInitVal && bcd_p == 1) {
+          // Add last sample of previous bunch crossing
+          ext[0] = mChData[ref_p].data[MaxTimeBin];
+        } else {
+          // As a backup we count twice the first sample
+          ext[0] = ext[1];
+        }
+        if (ref_n != ZDCRefInitVal && bcd_n == 1) {
+          // Add first sample of next bunch crossing
+          ext[NTimeBinsPerBC + 1] = mChData[ref_n].data[0];
+        } else {
+          // As a backup we count twice the last sample
+          ext[NTimeBinsPerBC + 1] = ext[NTimeBinsPerBC];
+        }
+        auto& data = mReco[ibc].data[isig];
+        for (int is = 0; is < NTimeBinsPerBC; is++) {
+          int32_t sum = ext[is] + ext[is + 1] + ext[is + 2];
+          // Make the average taking into account rounding and sign: |sum| = 3q + r is rounded
+          // to q + 1 if r == 2, i.e. to (|sum| + 1) / 3 (branchless to allow vectorization)
+          int32_t avg = (std::abs(sum) + 1) / 3;
           // Store filtered values
-          mReco[ibc].data[isig][is] = sum;
+          data[is] = sum < 0 ? -avg : avg;
         }
       }
     }
   }
 }
 
-int DigiReco::reconstructTDC(int ibeg, int iend)
+int DigiReco::reconstructTDC(DigiRecoState& st, int ibeg, int iend)
 {
 #ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
   LOG(info) << "________________________________________________________________________________";
@@ -817,9 +844,9 @@ int DigiReco::reconstructTDC(int ibeg, int iend)
           // Need data for at least two consecutive bunch crossings
           int rval = 0;
           if (mRopt->doExtendedSearch) {
-            rval = processTriggerExtended(itdc, istart, istop);
+            rval = processTriggerExtended(st, itdc, istart, istop);
           } else {
-            rval = processTrigger(itdc, istart, istop);
+            rval = processTrigger(st, itdc, istart, istop);
           }
           if (rval) {
             return rval;
@@ -833,9 +860,9 @@ int DigiReco::reconstructTDC(int ibeg, int iend)
     if (istart >= 0 && (istop - istart) > 0) {
       int rval = 0;
       if (mRopt->doExtendedSearch) {
-        rval = processTriggerExtended(itdc, istart, istop);
+        rval = processTriggerExtended(st, itdc, istart, istop);
       } else {
-        rval = processTrigger(itdc, istart, istop);
+        rval = processTrigger(st, itdc, istart, istop);
       }
       if (rval) {
         return rval;
@@ -870,7 +897,7 @@ int DigiReco::reconstructTDC(int ibeg, int iend)
           // A gap is detected
           if (istart >= 0 && (istop - istart + 1) >= mFullInterpolationMinLength) {
             // Need data for at least mFullInterpolationMinLength (two) consecutive bunch crossings
-            int rval = fullInterpolation(isig, istart, istop);
+            int rval = fullInterpolation(st, isig, istart, istop);
             if (rval) {
               return rval;
             }
@@ -881,7 +908,7 @@ int DigiReco::reconstructTDC(int ibeg, int iend)
       }
       // Check if there are mFullInterpolationMinLength consecutive bunch crossings at the end of group
       if (istart >= 0 && (istop - istart + 1) >= mFullInterpolationMinLength) {
-        int rval = fullInterpolation(isig, istart, istop);
+        int rval = fullInterpolation(st, isig, istart, istop);
         if (rval) {
           return rval;
         }
@@ -908,7 +935,7 @@ int DigiReco::reconstructTDC(int ibeg, int iend)
   return 0;
 } // reconstructTDC
 
-int DigiReco::reconstruct(int ibeg, int iend)
+int DigiReco::reconstruct(DigiRecoState& st, int ibeg, int iend)
 {
 #ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
   LOG(info) << "________________________________________________________________________________";
@@ -916,9 +943,18 @@ int DigiReco::reconstruct(int ibeg, int iend)
 #endif
   // Process consecutive BCs
   if (ibeg == iend) {
+#ifdef WITH_OPENMP
+#pragma omp atomic
+#endif
     mNLonely++;
+#ifdef WITH_OPENMP
+#pragma omp atomic
+#endif
     mLonely[mReco[ibeg].ir.bc]++;
     if (mBCData[ibeg].triggers != 0x0) {
+#ifdef WITH_OPENMP
+#pragma omp atomic
+#endif
       mLonelyTrig[mReco[ibeg].ir.bc]++;
     }
     // Cannot reconstruct lonely bunch
@@ -939,8 +975,8 @@ int DigiReco::reconstruct(int ibeg, int iend)
   }
 #endif
 
-  // After pile-up correction, find signals around main-main that satisfy condition on TDC
-  findSignals(ibeg, iend);
+  // N.B. Signals around main-main that satisfy condition on TDC have been identified
+  // by findSignals(..) after pile-up correction
 
   // For each calorimeter that has detects a collision at the time of main-main
   // collisions we reconstruct integrated charges and fill output tree
@@ -997,7 +1033,7 @@ int DigiReco::reconstruct(int ibeg, int iend)
     }
     // Analyze all bunches
     for (int ibun = ibeg; ibun <= iend; ibun++) {
-      updateOffsets(ibun); // Get Orbit pedestals
+      updateOffsets(st, ibun); // Get Orbit pedestals
       auto& rec = mReco[ibun];
       // Check if the corresponding TDC is fired
       ref[0] = mReco[ibun].ref[ich];
@@ -1036,8 +1072,8 @@ int DigiReco::reconstruct(int ibeg, int iend)
           // (reference can be orbit or QC). If pile-up is detected we use orbit pedestal
           // instead of event pedestal
           // TODO: pedestal event could have a TM..
-          if (hasEvPed && (mSource[ich] == PedOr || mSource[ich] == PedQC)) {
-            auto pedref = mOffset[ich];
+          if (hasEvPed && (st.source[ich] == PedOr || st.source[ich] == PedQC)) {
+            auto pedref = st.offset[ich];
             if (evPed > pedref && (evPed - pedref) > mRopt->ped_thr_hi[ich]) {
               // Anomalous offset (put a warning but use event pedestal)
               rec.offPed[ich] = true;
@@ -1051,11 +1087,11 @@ int DigiReco::reconstruct(int ibeg, int iend)
           if (hasEvPed && rec.pilePed[ich] == false) {
             myPed = evPed;
             rec.adcPedEv[ich] = true;
-          } else if (mSource[ich] == PedOr) {
-            myPed = mOffset[ich];
+          } else if (st.source[ich] == PedOr) {
+            myPed = st.offset[ich];
             rec.adcPedOr[ich] = true;
-          } else if (mSource[ich] == PedQC) {
-            myPed = mOffset[ich];
+          } else if (st.source[ich] == PedQC) {
+            myPed = st.offset[ich];
             rec.adcPedQC[ich] = true;
           } else {
             rec.adcPedMissing[ich] = true;
@@ -1111,18 +1147,18 @@ int DigiReco::reconstruct(int ibeg, int iend)
   return 0;
 } // reconstruct
 
-void DigiReco::updateOffsets(int ibun)
+void DigiReco::updateOffsets(DigiRecoState& st, int ibun)
 {
   auto orbit = mBCData[ibun].ir.orbit;
-  if (orbit == mOffsetOrbit) {
+  if (orbit == st.offsetOrbit) {
     return;
   }
-  mOffsetOrbit = orbit;
+  st.offsetOrbit = orbit;
 
   // Reset information about pedestal origin
   for (int ich = 0; ich < NChannels; ich++) {
-    mSource[ich] = PedND;
-    mOffset[ich] = std::numeric_limits<float>::infinity();
+    st.source[ich] = PedND;
+    st.offset[ich] = std::numeric_limits<float>::infinity();
   }
 
   // Default TDC pedestal is from orbit
@@ -1134,8 +1170,8 @@ void DigiReco::updateOffsets(int ibun)
       auto myped = float(orbitdata.data[ich]) * mModuleConfig->baselineFactor;
       if (myped >= ADCMin && myped <= ADCMax) {
         // Pedestal information is present for this channel
-        mOffset[ich] = myped;
-        mSource[ich] = PedOr;
+        st.offset[ich] = myped;
+        st.source[ich] = PedOr;
       }
     }
   }
@@ -1143,30 +1179,33 @@ void DigiReco::updateOffsets(int ibun)
   // Use average "QC" pedestal if orbit pedestals are missing
   if (mPedParam != nullptr) {
     for (int ich = 0; ich < NChannels; ich++) {
-      if (mSource[ich] == PedND) {
+      if (st.source[ich] == PedND) {
         auto myped = mPedParam->getCalib(ich);
         if (myped >= ADCMin && myped <= ADCMax) {
-          mOffset[ich] = myped;
-          mSource[ich] = PedQC;
+          st.offset[ich] = myped;
+          st.source[ich] = PedQC;
         }
       }
     }
   }
 
   for (int ich = 0; ich < NChannels; ich++) {
-    if (mSource[ich] == PedND) {
+    if (st.source[ich] == PedND) {
+#ifdef WITH_OPENMP
+#pragma omp atomic
+#endif
       mMissingPed[ich]++;
       if (mVerbosity > DbgMinimal) {
-        LOGF(error, "Missing pedestal for ch %2d %s orbit %u ", ich, ChannelNames[ich], mOffsetOrbit);
+        LOGF(error, "Missing pedestal for ch %2d %s orbit %u ", ich, ChannelNames[ich], st.offsetOrbit);
       }
     }
 #ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
-    LOGF(info, "Pedestal for ch %2d %s orbit %u %s: %f", ich, ChannelNames[ich], mOffsetOrbit, mSource[ich] == PedOr ? "OR" : (mSource[ich] == PedQC ? "QC" : "??"), mOffset[ich]);
+    LOGF(info, "Pedestal for ch %2d %s orbit %u %s: %f", ich, ChannelNames[ich], st.offsetOrbit, st.source[ich] == PedOr ? "OR" : (st.source[ich] == PedQC ? "QC" : "??"), st.offset[ich]);
 #endif
   }
 } // updateOffsets
 
-int DigiReco::processTrigger(int itdc, int ibeg, int iend)
+int DigiReco::processTrigger(DigiRecoState& st, int itdc, int ibeg, int iend)
 {
 #ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
   LOG(info) << __func__ << "(itdc=" << itdc << "[" << ChannelNames[TDCSignal[itdc]] << "], " << ibeg << ", " << iend << "): " << mReco[ibeg].ir.orbit << "." << mReco[ibeg].ir.bc << " - " << mReco[iend].ir.orbit << "." << mReco[iend].ir.bc;
@@ -1258,10 +1297,10 @@ int DigiReco::processTrigger(int itdc, int ibeg, int iend)
       break;
     }
   }
-  return interpolate(itdc, ibeg, iend);
+  return interpolate(st, itdc, ibeg, iend);
 } // processTrigger
 
-int DigiReco::processTriggerExtended(int itdc, int ibeg, int iend)
+int DigiReco::processTriggerExtended(DigiRecoState& st, int itdc, int ibeg, int iend)
 {
   auto isig = TDCSignal[itdc];
 #ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
@@ -1269,13 +1308,13 @@ int DigiReco::processTriggerExtended(int itdc, int ibeg, int iend)
 #endif
   // Extends search zone at the beginning of sequence. Need pedestal information.
   // For simplicity we use information for current bunch/orbit
-  updateOffsets(ibeg);
-  if (mSource[isig] == PedND) {
+  updateOffsets(st, ibeg);
+  if (st.source[isig] == PedND) {
     // Fall back to normal trigger
     // Message will be produced when computing amplitude (if a hit is found in this bunch)
     // In this framework we have a potential undetected inefficiency, however pedestal
     // problem is a serious problem and will be noticed anyway
-    return processTrigger(itdc, ibeg, iend);
+    return processTrigger(st, itdc, ibeg, iend);
   }
 
   int nbun = iend - ibeg + 1;
@@ -1311,9 +1350,9 @@ int DigiReco::processTriggerExtended(int itdc, int ibeg, int iend)
         LOG(error) << __func__ << " @ " << __LINE__ << " Missing information for bunch crossing " << mReco[b2].ir.orbit << "." << mReco[b2].ir.bc << " sig = " << isig;
         return __LINE__;
       }
-      diff = mOffset[isig] - mChData[ref_s].data[s2];
+      diff = st.offset[isig] - mChData[ref_s].data[s2];
 #ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
-      m[0] = mOffset[isig];
+      m[0] = st.offset[isig];
       s[0] = mChData[ref_s].data[s2];
 #endif
     } else {
@@ -1371,25 +1410,25 @@ int DigiReco::processTriggerExtended(int itdc, int ibeg, int iend)
       break;
     }
   }
-  return interpolate(itdc, ibeg, iend);
+  return interpolate(st, itdc, ibeg, iend);
 } // processTriggerExtended
 
 // Interpolation for single point
-O2_ZDC_DIGIRECO_FLT DigiReco::getPoint(int isig, int ibeg, int iend, int i)
+O2_ZDC_DIGIRECO_FLT DigiReco::getPoint(DigiRecoState& st, int isig, int ibeg, int iend, int i)
 {
   constexpr int nsbun = TSN * NTimeBinsPerBC; // Total number of interpolated points per bunch crossing
-  if (i >= mNtot || i < 0) {
-    LOG(error) << "Error addressing isig=" << isig << " i=" << i << " mNtot=" << mNtot;
-    mInError = true;
+  if (i >= st.ntot || i < 0) {
+    LOG(error) << "Error addressing isig=" << isig << " i=" << i << " ntot=" << st.ntot;
+    st.inError = true;
     return std::numeric_limits<float>::infinity();
   }
   // Constant extrapolation at the beginning and at the end of the array
   if (i < TSNH) {
     // Return value of first sample
-    return mFirstSample;
-  } else if (i >= mIlast) {
+    return st.firstSample;
+  } else if (i >= st.ilast) {
     // Return value of last sample
-    return mLastSample;
+    return st.lastSample;
   } else {
     // Identification of the point to be assigned
     int ibun = ibeg + i / nsbun;
@@ -1402,7 +1441,7 @@ O2_ZDC_DIGIRECO_FLT DigiReco::getPoint(int isig, int ibeg, int iend, int i)
       int ib = ibeg + (i / TSN) / NTimeBinsPerBC;
       if (ib != ibun) {
         LOG(error) << "ib=" << ib << " ibun=" << ibun;
-        mInError = true;
+        st.inError = true;
         return std::numeric_limits<float>::infinity();
       }
       return mReco[ibun].data[isig][ip]; // Filtered point
@@ -1414,16 +1453,16 @@ O2_ZDC_DIGIRECO_FLT DigiReco::getPoint(int isig, int ibeg, int iend, int i)
       O2_ZDC_DIGIRECO_FLT sum = 0;
       for (int is = TSN - im, ii = ip - TSL + 1; is < NTS; is += TSN, ii++) {
         // Default is first point in the array
-        O2_ZDC_DIGIRECO_FLT yy = mFirstSample;
+        O2_ZDC_DIGIRECO_FLT yy = st.firstSample;
         if (ii > 0) {
-          if (ii < mNsam) {
+          if (ii < st.nsam) {
             int ip = ii % NTimeBinsPerBC;
             int ib = ibeg + ii / NTimeBinsPerBC;
             yy = mReco[ib].data[isig][ip];
             // yy = mChData[mReco[ib].ref[isig]].data[ip];
           } else {
             // Last acquired point
-            yy = mLastSample;
+            yy = st.lastSample;
           }
         }
         sum += mTS[is];
@@ -1435,8 +1474,9 @@ O2_ZDC_DIGIRECO_FLT DigiReco::getPoint(int isig, int ibeg, int iend, int i)
   }
 }
 
-void DigiReco::setPoint(int isig, int ibeg, int iend, int i)
+void DigiReco::setPoints(DigiRecoState& st, int isig, int ibeg, int iend)
 {
+  // Interpolation of all the points of signal isig, in consecutive bunches from ibeg to iend
   // This function needs to be used only if mFullInterpolation is true otherwise the
   // vectors are not allocated
   if (!mFullInterpolation) {
@@ -1444,28 +1484,56 @@ void DigiReco::setPoint(int isig, int ibeg, int iend, int i)
     return;
   }
   constexpr int nsbun = TSN * NTimeBinsPerBC; // Total number of interpolated points per bunch crossing
-  if (i >= mNtot || i < 0) {
-    LOG(error) << "Error addressing signal isig=" << isig << " i=" << i << " mNtot=" << mNtot;
-    mInError = true;
-    return;
+  // Acquired samples extended with the first and last sample, as in getPoint: y[ii + TSL] is sample ii
+  st.y.resize(st.nsam + 2 * TSL);
+  for (int ii = -TSL; ii < st.nsam + TSL; ii++) {
+    O2_ZDC_DIGIRECO_FLT yy = st.firstSample;
+    if (ii > 0) {
+      if (ii < st.nsam) {
+        yy = mReco[ibeg + ii / NTimeBinsPerBC].data[isig][ii % NTimeBinsPerBC];
+      } else {
+        yy = st.lastSample;
+      }
+    }
+    st.y[ii + TSL] = yy;
   }
   // Constant extrapolation at the beginning and at the end of the array
-  if (i < TSNH) {
-    // Assign value of first sample
-    mReco[ibeg].inter[isig][i] = mFirstSample;
-  } else if (i >= mIlast) {
-    // Assign value of last sample
-    int isam = i % nsbun;
-    mReco[iend].inter[isig][isam] = mLastSample;
-  } else {
-    // Identification of the point to be assigned
-    int ibun = ibeg + i / nsbun;
-    int isam = i % nsbun;
-    mReco[ibun].inter[isig][isam] = getPoint(isig, ibeg, iend, i);
+  for (int i = 0; i < TSNH; i++) {
+    mReco[ibeg].inter[isig][i] = st.firstSample;
+  }
+  for (int i = st.ilast; i < st.ntot; i++) {
+    mReco[iend].inter[isig][i % nsbun] = st.lastSample;
+  }
+  // Acquired points (N.B. the last one is in the constant extrapolation region)
+  int np = st.nsam - 1;
+  for (int ip = 0; ip < np; ip++) {
+    int i = TSNH + ip * TSN;
+    mReco[ibeg + i / nsbun].inter[isig][i % nsbun] = st.y[ip + TSL];
+  }
+  // Interpolated points, one phase of the interpolating function at a time. The points of
+  // the same phase share the coefficients: the loop on points is vectorized while each point
+  // is computed with the same sequence of operations as in getPoint
+  st.s.resize(np);
+  for (int im = 1; im < TSN; im++) {
+    O2_ZDC_DIGIRECO_FLT* __restrict__ s = st.s.data();
+    const O2_ZDC_DIGIRECO_FLT* __restrict__ y = st.y.data() + 1;
+    for (int ip = 0; ip < np; ip++) {
+      s[ip] = 0;
+    }
+    for (int is = TSN - im, ii = 0; is < NTS; is += TSN, ii++) {
+      const O2_ZDC_DIGIRECO_FLT ts = mTS[is];
+      for (int ip = 0; ip < np; ip++) {
+        s[ip] += y[ip + ii] * ts;
+      }
+    }
+    for (int ip = 0; ip < np; ip++) {
+      int i = TSNH + ip * TSN + im;
+      mReco[ibeg + i / nsbun].inter[isig][i % nsbun] = s[ip] / mTSNorm[im];
+    }
   }
-} // setPoint
+} // setPoints
 
-int DigiReco::fullInterpolation(int isig, int ibeg, int iend)
+int DigiReco::fullInterpolation(DigiRecoState& st, int isig, int ibeg, int iend)
 {
   // Interpolation of signal isig, in consecutive bunches from ibeg to iend
   // This function works for all signals and does not evaluate trigger
@@ -1480,11 +1548,11 @@ int DigiReco::fullInterpolation(int isig, int ibeg, int iend)
   constexpr int MaxTimeBin = NTimeBinsPerBC - 1; //< number of samples per BC
 
   // Set data members for interpolation of the current channel
-  mNbun = iend - ibeg + 1;                    // Number of adjacent bunches
-  mNsam = mNbun * NTimeBinsPerBC;             // Number of acquired samples
-  mNtot = mNsam * TSN;                        // Total number of points in the interpolated arrays
-  mNint = (mNbun * NTimeBinsPerBC - 1) * TSN; // Total points in the interpolation region (-1)
-  mIlast = mNtot - TSNH;                      // Index of last acquired sample
+  st.nbun = iend - ibeg + 1;                      // Number of adjacent bunches
+  st.nsam = st.nbun * NTimeBinsPerBC;             // Number of acquired samples
+  st.ntot = st.nsam * TSN;                        // Total number of points in the interpolated arrays
+  st.nint = (st.nbun * NTimeBinsPerBC - 1) * TSN; // Total points in the interpolation region (-1)
+  st.ilast = st.ntot - TSNH;                      // Index of last acquired sample
 
   // At this level there should be no need to check if the channel is connected
   // since a fatal should have been raised already
@@ -1496,23 +1564,21 @@ int DigiReco::fullInterpolation(int isig, int ibeg, int iend)
     }
   }
 
-  mFirstSample = mReco[ibeg].data[isig][0];
-  mLastSample = mReco[iend].data[isig][MaxTimeBin];
+  st.firstSample = mReco[ibeg].data[isig][0];
+  st.lastSample = mReco[iend].data[isig][MaxTimeBin];
 
   // Allocate and fill array of interpolated points
   for (int ibun = ibeg; ibun <= iend; ibun++) {
     mReco[ibun].allocate(isig);
   }
-  for (int i = 0; i < mNtot; i++) {
-    setPoint(isig, ibeg, iend, i);
-  }
-  if (mInError) {
+  setPoints(st, isig, ibeg, iend);
+  if (st.inError) {
     return __LINE__;
   }
   return 0;
 }
 
-int DigiReco::interpolate(int itdc, int ibeg, int iend)
+int DigiReco::interpolate(DigiRecoState& st, int itdc, int ibeg, int iend)
 {
   // Interpolation of TDC channel itdc, in consecutive bunches from ibeg to iend
   int isig = TDCSignal[itdc];
@@ -1528,11 +1594,11 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
   constexpr int nsbun = TSN * NTimeBinsPerBC;    // Total number of interpolated points per bunch crossing
 
   // Set data members for interpolation of the current TDC
-  mNbun = iend - ibeg + 1;                    // Number of adjacent bunches
-  mNsam = mNbun * NTimeBinsPerBC;             // Number of acquired samples
-  mNtot = mNsam * TSN;                        // Total number of points in the interpolated arrays
-  mNint = (mNbun * NTimeBinsPerBC - 1) * TSN; // Total points in the interpolation region (-1)
-  mIlast = mNtot - TSNH;                      // Index of last acquired sample
+  st.nbun = iend - ibeg + 1;                      // Number of adjacent bunches
+  st.nsam = st.nbun * NTimeBinsPerBC;             // Number of acquired samples
+  st.ntot = st.nsam * TSN;                        // Total number of points in the interpolated arrays
+  st.nint = (st.nbun * NTimeBinsPerBC - 1) * TSN; // Total points in the interpolation region (-1)
+  st.ilast = st.ntot - TSNH;                      // Index of last acquired sample
 
   constexpr int nsp = 5; // Number of points to be searched
 
@@ -1551,8 +1617,8 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
   // mFirstSample = mChData[ref_beg].data[0]; // Original points
   // mLastSample = mChData[ref_end].data[MaxTimeBin]; // Original points
 
-  mFirstSample = mReco[ibeg].data[isig][0];
-  mLastSample = mReco[iend].data[isig][MaxTimeBin];
+  st.firstSample = mReco[ibeg].data[isig][0];
+  st.lastSample = mReco[iend].data[isig][MaxTimeBin];
 
   // mFullInterpolation turns on full interpolation for debugging
   // otherwise the interpolation is performed only around actual signal
@@ -1560,11 +1626,9 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
     for (int ibun = ibeg; ibun <= iend; ibun++) {
       mReco[ibun].allocate(isig);
     }
-    for (int i = 0; i < mNtot; i++) {
-      setPoint(isig, ibeg, iend, i);
-    }
+    setPoints(st, isig, ibeg, iend);
   }
-  if (mInError) {
+  if (st.inError) {
     return __LINE__;
   }
   // Looking for a local maximum in a search zone
@@ -1577,7 +1641,7 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
   int ip[nsp] = {-1, -1, -1, -1, -1};
   // N.B. Points at the extremes are constant therefore no local maximum
   // can occur in these two regions
-  for (int i = 0; i < mNint; i += mInterpolationStep) {
+  for (int i = 0; i < st.nint; i += mInterpolationStep) {
     int isam = i + TSNH;
     // Check if trigger is fired for this point
     // For the moment we don't take into account possible extensions of the search zone
@@ -1692,8 +1756,8 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
             sbeg = 0;
             send = sbeg + TSN;
           }
-          if (send > (mNint + TSNH)) {
-            send = mNint + TSNH;
+          if (send > (st.nint + TSNH)) {
+            send = st.nint + TSNH;
             sbeg = send - TSN;
           }
           if (sbeg < 0) {
@@ -1701,7 +1765,7 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
           }
           for (int spos = sbeg; spos < send; spos++) {
             // Perform interpolation for the searched point
-            O2_ZDC_DIGIRECO_FLT myval = getPoint(isig, ibeg, iend, spos);
+            O2_ZDC_DIGIRECO_FLT myval = getPoint(st, isig, ibeg, iend, spos);
             // Get local minimum of waveform
             if (myval < amp) {
               amp = myval;
@@ -1711,19 +1775,19 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
         }
         // Store identified peak
         int ibun = ibeg + isam_amp / nsbun;
-        updateOffsets(ibun);
+        updateOffsets(st, ibun);
         // At this level offsets are from Orbit or QC therefore
         // the TDC amplitude and time are affected by pile-up from
         // previous collisions. Pile up correction needs to be
         // performed after all signals have been identified
-        if (mSource[isig] != PedND) {
-          amp = mOffset[isig] - amp;
+        if (st.source[isig] != PedND) {
+          amp = st.offset[isig] - amp;
         } else {
           LOGF(error, "%u.%-4d Missing pedestal for TDC %d %s ", mBCData[ibun].ir.orbit, mBCData[ibun].ir.bc, itdc, ChannelNames[TDCSignal[itdc]]);
           amp = std::numeric_limits<float>::infinity();
         }
         int tdc = isam_amp % nsbun;
-        assignTDC(ibun, ibeg, iend, itdc, tdc, amp);
+        assignTDC(st, ibun, ibeg, iend, itdc, tdc, amp);
       }
       amp = std::numeric_limits<float>::infinity();
       isam_amp = 0;
@@ -1737,7 +1801,7 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
         myval = mReco[ib_cur].inter[isig][mysam];
       } else {
         // Perform interpolation for the searched point
-        myval = getPoint(isig, ibeg, iend, isam);
+        myval = getPoint(st, isig, ibeg, iend, isam);
       }
       // Get local minimum of waveform
       if (myval < amp) {
@@ -1746,7 +1810,7 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
       }
     }
   } // Loop on interpolated points
-  if (mInError) {
+  if (st.inError) {
     return __LINE__;
   }
 
@@ -1762,8 +1826,8 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
           sbeg = 0;
           send = sbeg + TSN;
         }
-        if (send > (mNint + TSNH)) {
-          send = mNint + TSNH;
+        if (send > (st.nint + TSNH)) {
+          send = st.nint + TSNH;
           sbeg = send - TSN;
         }
         if (sbeg < 0) {
@@ -1771,7 +1835,7 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
         }
         for (int spos = sbeg; spos < send; spos++) {
           // Perform interpolation for the searched point
-          O2_ZDC_DIGIRECO_FLT myval = getPoint(isig, ibeg, iend, spos);
+          O2_ZDC_DIGIRECO_FLT myval = getPoint(st, isig, ibeg, iend, spos);
           // Get local minimum of waveform
           if (myval < amp) {
             amp = myval;
@@ -1781,25 +1845,25 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
       }
       // Store identified peak
       int ibun = ibeg + isam_amp / nsbun;
-      updateOffsets(ibun);
-      if (mSource[isig] != PedND) {
-        amp = mOffset[isig] - amp;
+      updateOffsets(st, ibun);
+      if (st.source[isig] != PedND) {
+        amp = st.offset[isig] - amp;
       } else {
         LOGF(error, "%u.%-4d Missing pedestal for TDC %d %s ", mBCData[ibun].ir.orbit, mBCData[ibun].ir.bc, itdc, ChannelNames[TDCSignal[itdc]]);
         amp = std::numeric_limits<float>::infinity();
       }
       int tdc = isam_amp % nsbun;
-      assignTDC(ibun, ibeg, iend, itdc, tdc, amp);
+      assignTDC(st, ibun, ibeg, iend, itdc, tdc, amp);
     }
   }
-  if (mInError) {
+  if (st.inError) {
     return __LINE__;
   }
   // TODO: add logic to assign TDC in presence of overflow
   return 0;
 } // interpolate
 
-void DigiReco::assignTDC(int ibun, int ibeg, int iend, int itdc, int tdc, float amp)
+void DigiReco::assignTDC(DigiRecoState& st, int ibun, int ibeg, int iend, int itdc, int tdc, float amp)
 {
   constexpr int nsbun = TSN * NTimeBinsPerBC; // Total number of interpolated points per bunch crossing
   constexpr int tdc_max = nsbun / 2;
@@ -1854,11 +1918,11 @@ void DigiReco::assignTDC(int ibun, int ibeg, int iend, int itdc, int tdc, float
   }
 #endif
   // Assign info about pedestal subtration
-  if (mSource[isig] == PedOr) {
+  if (st.source[isig] == PedOr) {
     rec.tdcPedOr[isig] = true;
-  } else if (mSource[isig] == PedQC) {
+  } else if (st.source[isig] == PedQC) {
     rec.tdcPedQC[isig] = true;
-  } else if (mSource[isig] == PedEv) {
+  } else if (st.source[isig] == PedEv) {
     // In present implementation this never happens
     rec.tdcPedEv[isig] = true;
   } else {
@@ -1867,7 +1931,7 @@ void DigiReco::assignTDC(int ibun, int ibeg, int iend, int itdc, int tdc, float
 #ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
   LOG(info) << __func__ << " itdc=" << itdc << " " << ChannelNames[isig] << " @ ibun=" << ibun << " " << mReco[ibun].ir.orbit << "." << mReco[ibun].ir.bc << " "
             << " tdc=" << tdc << " -> " << TDCValCorr << " shift=" << tdc_shift[itdc] << " -> TDCVal=" << TDCVal << "=" << TDCVal * o2::zdc::FTDCVal
-            << " mSource[" << isig << "] = " << unsigned(mSource[isig]) << " = " << mOffset[isig]
+            << " source[" << isig << "] = " << unsigned(st.source[isig]) << " = " << st.offset[isig]
             << " amp=" << amp << " -> " << TDCAmpCorr << " calib=" << tdc_calib[itdc] << " offset=" << tdc_offset[itdc] << " -> TDCAmp=" << TDCAmp
             << (ibun == ibeg ? " B" : "") << (ibun == iend ? " E" : "");
   mAssignedTDC[itdc]++;
@@ -1875,7 +1939,7 @@ void DigiReco::assignTDC(int ibun, int ibeg, int iend, int itdc, int tdc, float
   ihit++;
 } // assignTDC
 
-void DigiReco::findSignals(int ibeg, int iend)
+void DigiReco::findSignals(DigiRecoState& st, int ibeg, int iend)
 {
   // N.B. findSignals is called after pile-up correction on TDCs
 #ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
@@ -1883,7 +1947,7 @@ void DigiReco::findSignals(int ibeg, int iend)
 #endif
   // Identify TDC signals
   for (int ibun = ibeg; ibun <= iend; ibun++) {
-    updateOffsets(ibun); // Get orbit pedestals or run pedestals as a fallback
+    updateOffsets(st, ibun); // Get orbit pedestals or run pedestals as a fallback
     auto& rec = mReco[ibun];
     for (int itdc = 0; itdc < NTDCChannels; itdc++) {
 #ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
@@ -2012,6 +2076,14 @@ void DigiReco::correctTDCPile()
   // TODO: Perform actual pile-up correction for TDCs.. this is still work in progress..
   // For the moment this function has pile-up detection
 
+  // TDC channels are corrected independently
+  int nThreads = mNThreads;
+#ifdef ALICEO2_ZDC_DIGI_RECO_DEBUG
+  nThreads = 1;
+#endif
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads)
+#endif
   for (int itdc = 0; itdc < NTDCChannels; itdc++) {
     // Queue is empty at first event of the time frame
     // TODO: collect information from previous time frame
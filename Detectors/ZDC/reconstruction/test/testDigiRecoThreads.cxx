@@ -0,0 +1,238 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test ZDC DigiReco threads
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "ZDCBase/Constants.h"
+#include "ZDCBase/ModuleConfig.h"
+#include "ZDCReconstruction/DigiReco.h"
+#include "ZDCReconstruction/RecoConfigZDC.h"
+#include "ZDCReconstruction/ZDCTDCParam.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace o2::zdc;
+
+namespace
+{
+constexpr float Baseline = 1800.f; // ADC baseline of all the channels
+constexpr int NOrbits = 3;         // orbits of the synthetic time frame, the last one without pedestal information
+
+struct DigitStream {
+  std::vector<OrbitData> orbits;
+  std::vector<BCData> bcs;
+  std::vector<ChannelData> channels;
+};
+
+// readout and trigger configuration of the CreateModuleConfig.C macro
+const ModuleConfig& getModuleConfig()
+{
+  static ModuleConfig conf;
+  if (conf.modules[0].id < 0) {
+    const int8_t ids[NModules][NChPerModule] = {{IdZNAC, IdZNASum, IdZNA1, IdZNA2}, {IdZNAC, IdZNASum, IdZNA3, IdZNA4},
+                                                {IdZNCC, IdZNCSum, IdZNC1, IdZNC2}, {IdZNCC, IdZNCSum, IdZNC3, IdZNC4},
+                                                {IdZPAC, IdZEM1, IdZPA1, IdZPA2}, {IdZPAC, IdZPASum, IdZPA3, IdZPA4},
+                                                {IdZPCC, IdZEM2, IdZPC3, IdZPC4}, {IdZPCC, IdZPCSum, IdZPC1, IdZPC2}};
+    conf.nBunchAverage = 2;
+    conf.baselineFactor = 1.f / NTimeBinsPerBC;
+    for (int im = 0; im < NModules; im++) {
+      auto& module = conf.modules[im];
+      module.id = im;
+      const bool hasZEM = (im == 4 || im == 6);
+      module.setChannel(0, ids[im][0], 2 * im, im % 2 == 0, true, -5, 6, 4, 12);
+      module.setChannel(1, ids[im][1], 2 * im, im % 2 == 1 || hasZEM, hasZEM, -5, 6, 4, 12);
+      module.setChannel(2, ids[im][2], 2 * im + 1, true, false, -5, 6, 4, 12);
+      module.setChannel(3, ids[im][3], 2 * im + 1, true, false, -5, 6, 4, 12);
+    }
+  }
+  return conf;
+}
+
+// reconstruction configuration of the CreateRecoConfigZDC.C and CreateTDCCalib.C macros
+const RecoConfigZDC& getRecoConfig()
+{
+  static RecoConfigZDC conf;
+  conf.setDoubleTrigger();
+  for (int ich = 0; ich < NChannels; ich++) {
+    conf.setIntegration(ich, 6, 8, -12, -8);
+  }
+  return conf;
+}
+
+const ZDCTDCParam& getTDCParam()
+{
+  static ZDCTDCParam param;
+  for (int itdc = 0; itdc < NTDCChannels; itdc++) {
+    param.setShift(itdc, 12.5);
+    param.setFactor(itdc, 1.);
+  }
+  return param;
+}
+
+// ranges of 2 to 5 consecutive bunch crossings with gaussian pulses of random amplitude and time on top of the baseline
+DigitStream createDigits()
+{
+  const auto& config = getModuleConfig();
+  uint32_t chBit[NChannels] = {0};
+  for (int im = 0; im < NModules; im++) {
+    for (int ic = 0; ic < NChPerModule; ic++) {
+      if (config.modules[im].readChannel[ic]) {
+        chBit[config.modules[im].channelID[ic]] = 0x1 << (4 * im + ic);
+      }
+    }
+  }
+  uint32_t chMask = 0;
+  for (int ich = 0; ich < NChannels; ich++) {
+    chMask |= chBit[ich];
+  }
+
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<float> uniform(0.f, 1.f);
+  std::normal_distribution<float> noise(0.f, 1.5f);
+  DigitStream digits;
+  for (uint32_t orbit = 1; orbit <= NOrbits; orbit++) {
+    if (orbit < NOrbits) {
+      std::array<int16_t, NChannels> ped;
+      std::array<uint16_t, NChannels> scaler;
+      ped.fill(int16_t(std::lround(Baseline / config.baselineFactor)));
+      scaler.fill(10);
+      digits.orbits.emplace_back(o2::InteractionRecord(0, orbit), ped, scaler);
+    }
+    for (int bc = 10 + int(20 * uniform(generator)); bc < 3500; bc += 2 + int(50 * uniform(generator))) {
+      const int nbc = 2 + int(4 * uniform(generator));
+      const int nsam = nbc * NTimeBinsPerBC;
+      std::vector<float> wave[NChannels];
+      uint32_t triggers[5] = {0};
+      for (int ich = 0; ich < NChannels; ich++) {
+        wave[ich].resize(nsam);
+        for (auto& s : wave[ich]) {
+          s = Baseline + noise(generator);
+        }
+      }
+      for (int ibc = 0; ibc < nbc; ibc++) {
+        if (uniform(generator) < 0.5f) {
+          continue;
+        }
+        const float t0 = ibc * NTimeBinsPerBC + 4.f + 4.f * uniform(generator);
+        for (int ich = 0; ich < NChannels; ich++) {
+          if (uniform(generator) < 0.3f) {
+            continue;
+          }
+          const float amp = 30.f + 1500.f * uniform(generator);
+          for (int is = 0; is < nsam; is++) {
+            const float x = (is - t0) / 1.2f;
+            wave[ich][is] -= amp * std::exp(-0.5f * x * x);
+          }
+          if (amp > 100.f) {
+            triggers[ibc] |= chBit[ich];
+          }
+        }
+      }
+      for (int ibc = 0; ibc < nbc; ibc++) {
+        digits.bcs.emplace_back(digits.channels.size(), NChannels, o2::InteractionRecord(bc + ibc, orbit), chMask, triggers[ibc], 0);
+        for (int ich = 0; ich < NChannels; ich++) {
+          auto& chd = digits.channels.emplace_back();
+          chd.id = ich;
+          for (int is = 0; is < NTimeBinsPerBC; is++) {
+            chd.data[is] = int16_t(std::clamp(std::lround(wave[ich][ibc * NTimeBinsPerBC + is]), long(ADCMin), long(ADCMax)));
+          }
+        }
+      }
+      bc += nbc;
+    }
+  }
+  return digits;
+}
+
+void reconstruct(DigiReco& dr, const DigitStream& digits, bool fullInterpolation, int nThreads)
+{
+  dr.setModuleConfig(&getModuleConfig());
+  dr.setRecoConfigZDC(&getRecoConfig());
+  dr.setTDCParam(&getTDCParam());
+  dr.setFullInterpolation(fullInterpolation);
+  dr.setNThreads(nThreads);
+  dr.setVerbosity(DbgZero);
+  dr.init();
+  BOOST_REQUIRE_EQUAL(dr.process(digits.orbits, digits.bcs, digits.channels), 0);
+}
+
+// every field filled by DigiReco must be identical. The flags and err members of RecEventAux are not filled.
+// The eor counters of missing pedestals are not compared: they count the refills of the per-thread pedestal cache
+void checkEqual(const RecEventAux& a, const RecEventAux& b)
+{
+  BOOST_CHECK(a.ir == b.ir);
+  BOOST_CHECK_EQUAL(a.channels, b.channels);
+  BOOST_CHECK_EQUAL(a.ezdcDecoded, b.ezdcDecoded);
+  BOOST_CHECK_EQUAL(a.triggers, b.triggers);
+  BOOST_CHECK(a.ezdc == b.ezdc);
+  for (int itdc = 0; itdc < NTDCChannels; itdc++) {
+    BOOST_CHECK_EQUAL_COLLECTIONS(a.TDCVal[itdc].begin(), a.TDCVal[itdc].end(), b.TDCVal[itdc].begin(), b.TDCVal[itdc].end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(a.TDCAmp[itdc].begin(), a.TDCAmp[itdc].end(), b.TDCAmp[itdc].begin(), b.TDCAmp[itdc].end());
+    BOOST_CHECK(a.TDCPile[itdc] == b.TDCPile[itdc]);
+    BOOST_CHECK_EQUAL(a.ntdc[itdc], b.ntdc[itdc]);
+    BOOST_CHECK_EQUAL(a.pattern[itdc], b.pattern[itdc]);
+    BOOST_CHECK_EQUAL(a.fired[itdc], b.fired[itdc]);
+  }
+  for (int ich = 0; ich < NChannels; ich++) {
+    BOOST_CHECK_EQUAL_COLLECTIONS(a.inter[ich].begin(), a.inter[ich].end(), b.inter[ich].begin(), b.inter[ich].end());
+    BOOST_CHECK_EQUAL(a.chfired[ich], b.chfired[ich]);
+    BOOST_CHECK_EQUAL(a.ref[ich], b.ref[ich]);
+    BOOST_CHECK(a.data[ich] == b.data[ich]);
+  }
+  const std::array<bool, NChannels> RecEventFlat::*flags[] = {
+    &RecEventFlat::genericE, &RecEventFlat::tdcPedEv, &RecEventFlat::tdcPedOr, &RecEventFlat::tdcPedQC,
+    &RecEventFlat::tdcPedMissing, &RecEventFlat::adcPedEv, &RecEventFlat::adcPedOr, &RecEventFlat::adcPedQC,
+    &RecEventFlat::adcPedMissing, &RecEventFlat::offPed, &RecEventFlat::pilePed, &RecEventFlat::pileTM,
+    &RecEventFlat::adcMissingwTDC, &RecEventFlat::tdcPileEvC, &RecEventFlat::tdcPileEvE, &RecEventFlat::tdcPileM1C,
+    &RecEventFlat::tdcPileM1E, &RecEventFlat::tdcPileM2C, &RecEventFlat::tdcPileM2E, &RecEventFlat::tdcPileM3C,
+    &RecEventFlat::tdcPileM3E, &RecEventFlat::tdcSigE};
+  for (auto flag : flags) {
+    BOOST_CHECK(a.*flag == b.*flag);
+  }
+}
+
+void checkThreads(bool fullInterpolation)
+{
+  const auto digits = createDigits();
+  DigiReco single, multi;
+  reconstruct(single, digits, fullInterpolation, 1);
+  reconstruct(multi, digits, fullInterpolation, 4);
+  const auto& recSingle = single.getReco();
+  const auto& recMulti = multi.getReco();
+  BOOST_REQUIRE_EQUAL(recSingle.size(), digits.bcs.size());
+  BOOST_REQUIRE_EQUAL(recMulti.size(), recSingle.size());
+  size_t nTDC = 0, nEnergy = 0;
+  for (size_t ibc = 0; ibc < recSingle.size(); ibc++) {
+    checkEqual(recSingle[ibc], recMulti[ibc]);
+    for (int itdc = 0; itdc < NTDCChannels; itdc++) {
+      nTDC += recSingle[ibc].TDCVal[itdc].size();
+    }
+    nEnergy += recSingle[ibc].ezdc.size();
+  }
+  BOOST_CHECK_GT(nTDC, 0);
+  BOOST_WARN_GT(nEnergy, 0);
+}
+} // namespace
+
+// the reconstruction of independent ranges of bunch crossings in parallel must give the sequential result
+BOOST_AUTO_TEST_CASE(DigiReco_threads)
+{
+  checkThreads(false);
+}
+
+BOOST_AUTO_TEST_CASE(DigiReco_threads_full_interpolation)
+{
+  checkThreads(true);
+}
@@ -66,6 +66,7 @@ void DigitRecoSpec::init(o2::framework::InitContext& ic)
   if (mMaxWave > 0) {
     LOG(warning) << "Limiting the number of waveforms in ourput to " << mMaxWave;
   }
+  mWorker.setNThreads(ic.options().get<int>("nthreads"));
   mRecoFraction = ic.options().get<double>("tf-fraction");
   if (mRecoFraction < 0 || mRecoFraction > 1) {
     LOG(error) << "Unphysical reconstructed fraction " << mRecoFraction << " set to 1.0";
@@ -321,7 +322,8 @@ framework::DataProcessorSpec getDigitRecoSpec(const int verbosity = 0, const boo
     outputs,
     AlgorithmSpec{adaptFromTask<DigitRecoSpec>(verbosity, enableDebugOut, enableZDCTDCCorr, enableZDCEnergyParam, enableZDCTowerParam, enableBaselineParam)},
     o2::framework::Options{{"max-wave", o2::framework::VariantType::Int, 0, {"Maximum number of waveforms per TF in output"}},
-                           {"tf-fraction", o2::framework::VariantType::Double, 1.0, {"Fraction of reconstructed TFs"}}}};
+                           {"tf-fraction", o2::framework::VariantType::Double, 1.0, {"Fraction of reconstructed TFs"}},
+                           {"nthreads", o2::framework::VariantType::Int, 1, {"Number of threads for independent ranges of bunch crossings"}}}};
 }
 
 } // namespace zdc